@@ -64,7 +64,9 @@ set(required_files
     "${package_root}/README.md"
     "${package_root}/release-manifest.json"
     "${package_root}/sdk/include/module_api.h"
+    "${package_root}/sdk/include/wio_btree_map.h"
     "${package_root}/sdk/include/wio_features.h"
+    "${package_root}/sdk/include/wio_flat_hash_map.h"
     "${package_root}/sdk/include/wio_sdk.h"
     "${package_root}/sdk/include/wio_values.h"
     "${package_root}/sdk/include/wio_version.h"
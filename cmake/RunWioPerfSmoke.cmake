@@ -29,6 +29,8 @@ foreach(expected_fragment
         "Wio performance smoke"
         "Scenario: file-check"
         "Scenario: file-run"
+        "Scenario: module-cache-cold"
+        "Scenario: module-cache-warm"
         "Scenario: project-build-cold"
         "Scenario: project-build-warm"
         "Scenario: project-run-warm")
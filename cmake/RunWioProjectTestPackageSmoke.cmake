@@ -100,6 +100,108 @@ if(NOT no_build_test_result EQUAL 0)
     )
 endif()
 
+file(WRITE "${project_root}/tests/parallel.wio"
+    "use std::console;\n\n"
+    "fn Entry() -> i32 {\n"
+    "    std::console::Print(\"project-test-parallel-ok\");\n"
+    "    return 0;\n"
+    "}\n"
+)
+file(WRITE "${project_root}/tests/zz_failing.wio"
+    "use std::console;\n\n"
+    "fn Entry() -> i32 {\n"
+    "    std::console::Print(\"project-test-failure-output\");\n"
+    "    return 3;\n"
+    "}\n"
+)
+
+execute_process(
+    COMMAND "${WIO_EXE}" project test --jobs 2 --filter "lifecycle|parallel"
+    WORKING_DIRECTORY "${project_root}"
+    RESULT_VARIABLE parallel_result
+    OUTPUT_VARIABLE parallel_stdout
+    ERROR_VARIABLE parallel_stderr
+)
+set(parallel_output "${parallel_stdout}${parallel_stderr}")
+if(NOT parallel_result EQUAL 0 OR
+   NOT parallel_output MATCHES "project-test-ok" OR
+   NOT parallel_output MATCHES "project-test-parallel-ok" OR
+   NOT parallel_output MATCHES "Slowest project tests:" OR
+   NOT parallel_output MATCHES "2/2 project test\\(s\\) passed")
+    message(FATAL_ERROR "Parallel project test execution failed.\n${parallel_output}")
+endif()
+
+execute_process(
+    COMMAND "${WIO_EXE}" project test --jobs 2 --keep-going
+    WORKING_DIRECTORY "${project_root}"
+    RESULT_VARIABLE keep_going_result
+    OUTPUT_VARIABLE keep_going_stdout
+    ERROR_VARIABLE keep_going_stderr
+)
+set(keep_going_output "${keep_going_stdout}${keep_going_stderr}")
+if(NOT keep_going_result EQUAL 3 OR
+   NOT keep_going_output MATCHES "project-test-failure-output\n\\[ FAIL  \\] tests/zz_failing\\.wio \\(exit 3\\)" OR
+   NOT keep_going_output MATCHES "2/3 project test\\(s\\) passed" OR
+   NOT keep_going_output MATCHES "1 project test\\(s\\) failed: tests/zz_failing\\.wio")
+    message(FATAL_ERROR "Project test --keep-going did not report every test.\n${keep_going_output}")
+endif()
+
+file(REMOVE "${project_root}/tests/parallel.wio" "${project_root}/tests/zz_failing.wio")
+
+# A test that fails to start must not leave the tests already running
+# behind. Left alive, the sleeper writes its marker after the command exits.
+set(orphan_marker "${WIO_SCRATCH_DIR}/orphan-marker.txt")
+file(WRITE "${project_root}/tests/aa_sleeper.wio"
+    "use std::fs;\nuse std::time;\n\n"
+    "fn Entry() -> i32 {\n"
+    "    std::time::SleepMilliseconds(3000u64);\n"
+    "    std::fs::TryWriteText(\"${orphan_marker}\", \"orphan\");\n"
+    "    return 0;\n"
+    "}\n"
+)
+file(WRITE "${project_root}/tests/ab_unspawnable.wio"
+    "fn Entry() -> i32 {\n"
+    "    return 0;\n"
+    "}\n"
+)
+execute_process(
+    COMMAND "${WIO_EXE}" project test --filter "aa_sleeper|ab_unspawnable"
+    WORKING_DIRECTORY "${project_root}"
+    RESULT_VARIABLE spawn_setup_result
+    OUTPUT_VARIABLE spawn_setup_stdout
+    ERROR_VARIABLE spawn_setup_stderr
+)
+if(NOT spawn_setup_result EQUAL 0)
+    message(FATAL_ERROR
+        "Could not build the spawn failure tests.\n${spawn_setup_stdout}${spawn_setup_stderr}"
+    )
+endif()
+file(REMOVE "${orphan_marker}")
+file(GLOB_RECURSE unspawnable_outputs LIST_DIRECTORIES false "${project_root}/ab_unspawnable")
+if(NOT unspawnable_outputs)
+    message(FATAL_ERROR "The ab_unspawnable test executable was not found.")
+endif()
+file(CHMOD ${unspawnable_outputs} PERMISSIONS OWNER_READ OWNER_WRITE)
+
+execute_process(
+    COMMAND "${WIO_EXE}" project test --no-build --jobs 2 --filter "aa_sleeper|ab_unspawnable"
+    WORKING_DIRECTORY "${project_root}"
+    RESULT_VARIABLE spawn_failure_result
+    OUTPUT_VARIABLE spawn_failure_stdout
+    ERROR_VARIABLE spawn_failure_stderr
+)
+set(spawn_failure_output "${spawn_failure_stdout}${spawn_failure_stderr}")
+if(spawn_failure_result EQUAL 0 OR
+   NOT spawn_failure_output MATCHES "process exec failed")
+    message(FATAL_ERROR "Project test did not report the spawn failure.\n${spawn_failure_output}")
+endif()
+execute_process(COMMAND "${CMAKE_COMMAND}" -E sleep 4)
+if(EXISTS "${orphan_marker}")
+    message(FATAL_ERROR "A running project test outlived a spawn failure.\n${spawn_failure_output}")
+endif()
+
+file(REMOVE "${project_root}/tests/aa_sleeper.wio" "${project_root}/tests/ab_unspawnable.wio")
+
 execute_process(
     COMMAND "${WIO_EXE}" project package
             --output-dir "${package_parent}" --clean
@@ -0,0 +1,142 @@
+if(NOT DEFINED WIO_EXE)
+    message(FATAL_ERROR "WIO_EXE was not provided.")
+endif()
+
+if(NOT DEFINED WIO_SCRATCH_DIR OR WIO_SCRATCH_DIR STREQUAL "")
+    message(FATAL_ERROR "WIO_SCRATCH_DIR was not provided.")
+endif()
+
+if(NOT DEFINED WIO_BENCH_FILTER OR WIO_BENCH_FILTER STREQUAL "")
+    set(WIO_BENCH_FILTER ".*")
+endif()
+
+if(NOT DEFINED WIO_BENCH_RUNS OR WIO_BENCH_RUNS STREQUAL "")
+    set(WIO_BENCH_RUNS 3)
+endif()
+
+# Builds every tests/std_*_run.wio matching WIO_BENCH_FILTER twice, once with
+# stack objects and once with --no-stack-objects, links the allocation counter
+# into both, and compares heap allocations, wall time and program output.
+set(counter_source "${CMAKE_SOURCE_DIR}/tests/native/allocation_counter.cpp")
+file(GLOB bench_sources "${CMAKE_SOURCE_DIR}/tests/std_*_run.wio")
+list(SORT bench_sources)
+
+file(REMOVE_RECURSE "${WIO_SCRATCH_DIR}")
+file(MAKE_DIRECTORY "${WIO_SCRATCH_DIR}")
+
+function(wio_bench_now_us out_var)
+    string(TIMESTAMP stamp "%s|%f" UTC)
+    string(REGEX REPLACE "^([0-9]+)\\|0*([0-9]+)$" "\\1;\\2" stamp "${stamp}")
+    list(GET stamp 0 seconds)
+    list(GET stamp 1 micros)
+    math(EXPR now "${seconds} * 1000000 + ${micros}")
+    set(${out_var} "${now}" PARENT_SCOPE)
+endfunction()
+
+set(total_stack_allocations 0)
+set(total_heap_allocations 0)
+set(total_stack_us 0)
+set(total_heap_us 0)
+set(bench_count 0)
+set(report "")
+
+foreach(source IN LISTS bench_sources)
+    get_filename_component(name "${source}" NAME_WE)
+    if(NOT name MATCHES "${WIO_BENCH_FILTER}")
+        continue()
+    endif()
+
+    set(skipped FALSE)
+    foreach(variant stack heap)
+        set(binary "${WIO_SCRATCH_DIR}/${name}-${variant}")
+        set(variant_args)
+        if(variant STREQUAL "heap")
+            set(variant_args --no-stack-objects)
+        endif()
+
+        execute_process(
+            COMMAND "${WIO_EXE}" "${source}" --output "${binary}"
+                --intermediate-dir "${WIO_SCRATCH_DIR}/${name}-${variant}.build"
+                ${variant_args}
+                --backend-arg "${counter_source}" --backend-arg -O2
+            WORKING_DIRECTORY "${CMAKE_SOURCE_DIR}"
+            RESULT_VARIABLE build_result
+            OUTPUT_VARIABLE build_output
+            ERROR_VARIABLE build_output
+        )
+        if(NOT build_result EQUAL 0)
+            message(FATAL_ERROR "Building ${name} (${variant}) failed with code ${build_result}.\n${build_output}")
+        endif()
+
+        set(elapsed_us 0)
+        foreach(run RANGE 1 ${WIO_BENCH_RUNS})
+            wio_bench_now_us(started)
+            execute_process(
+                COMMAND "${binary}"
+                WORKING_DIRECTORY "${CMAKE_SOURCE_DIR}"
+                RESULT_VARIABLE run_result
+                OUTPUT_VARIABLE run_stdout
+                ERROR_VARIABLE run_stderr
+            )
+            wio_bench_now_us(finished)
+            math(EXPR elapsed_us "${elapsed_us} + ${finished} - ${started}")
+        endforeach()
+
+        if(NOT run_result EQUAL 0)
+            string(APPEND report "  ${name}: skipped, ${variant} build exited with ${run_result}\n")
+            set(skipped TRUE)
+            break()
+        endif()
+
+        string(REGEX MATCH "wio-heap-allocations: ([0-9]+)" allocation_line "${run_stderr}")
+        if(allocation_line STREQUAL "")
+            message(FATAL_ERROR "${name} (${variant}) did not report its allocations.\n${run_stderr}")
+        endif()
+        set(${variant}_allocations "${CMAKE_MATCH_1}")
+        math(EXPR ${variant}_us "${elapsed_us} / ${WIO_BENCH_RUNS}")
+        set(${variant}_stdout "${run_stdout}")
+    endforeach()
+
+    if(skipped)
+        continue()
+    endif()
+
+    if(NOT stack_stdout STREQUAL heap_stdout)
+        message(FATAL_ERROR
+            "${name} prints different output with stack objects.\n"
+            "Stack objects:\n${stack_stdout}\n"
+            "--no-stack-objects:\n${heap_stdout}"
+        )
+    endif()
+    if(stack_allocations GREATER heap_allocations)
+        message(FATAL_ERROR "${name} allocates more with stack objects: ${stack_allocations} > ${heap_allocations}.")
+    endif()
+
+    math(EXPR saved "${heap_allocations} - ${stack_allocations}")
+    math(EXPR stack_ms "${stack_us} / 1000")
+    math(EXPR heap_ms "${heap_us} / 1000")
+    string(APPEND report
+        "  ${name}: allocations ${heap_allocations} -> ${stack_allocations} (-${saved}), "
+        "time ${heap_ms} ms -> ${stack_ms} ms\n")
+
+    math(EXPR total_stack_allocations "${total_stack_allocations} + ${stack_allocations}")
+    math(EXPR total_heap_allocations "${total_heap_allocations} + ${heap_allocations}")
+    math(EXPR total_stack_us "${total_stack_us} + ${stack_us}")
+    math(EXPR total_heap_us "${total_heap_us} + ${heap_us}")
+    math(EXPR bench_count "${bench_count} + 1")
+endforeach()
+
+if(bench_count EQUAL 0)
+    message(FATAL_ERROR "No std_*_run.wio test matched '${WIO_BENCH_FILTER}'.\n${report}")
+endif()
+
+math(EXPR total_stack_ms "${total_stack_us} / 1000")
+math(EXPR total_heap_ms "${total_heap_us} / 1000")
+message(STATUS
+    "Stack object bench (--no-stack-objects -> default, mean of ${WIO_BENCH_RUNS} runs):\n"
+    "${report}"
+    "  total over ${bench_count} tests: allocations ${total_heap_allocations} -> ${total_stack_allocations}, "
+    "time ${total_heap_ms} ms -> ${total_stack_ms} ms"
+)
+
+file(REMOVE_RECURSE "${WIO_SCRATCH_DIR}")
@@ -4,7 +4,7 @@
 #include "wio/sema/type_context.h"
 #include "wio/common/auto_flags.h"
 
-#define COMPILER_FLAGS(X) X(SingleFile) X(ShowTokens) X(ShowAst) X(DryRun) X(EmitCpp) X(ShowBackendInfo) X(NoBuiltin) X(WarnAsError) X(Run)
+#define COMPILER_FLAGS(X) X(SingleFile) X(ShowTokens) X(ShowAst) X(DryRun) X(EmitCpp) X(ShowBackendInfo) X(NoBuiltin) X(WarnAsError) X(Run) X(NoModuleCache) X(NoPch) X(SplitCpp) X(NoStackObjects)
     DEFINE_FLAGS(CompilerFlags, COMPILER_FLAGS);
 #undef COMPILER_FLAGS
 
@@ -7,6 +7,7 @@
  */
 
 #include "wio/lexer/token.h"
+#include "wio/common/arena.h"
 #include "wio/common/location.h"
 #include "wio/common/smart_ptr.h"
 #include "ast_visitor.h"
@@ -208,6 +209,7 @@ namespace wio
         TreeLastValue,
         TreeFloorKeyOr,
         TreeCeilKeyOr,
+        TreeScanRange,
         StringCount,
         StringEmpty,
         StringContains,
@@ -312,10 +314,11 @@ namespace wio
     template <typename T>
     using NodePtrUnchecked = Ref<T>;
 
+    // Nodes live in the active compilation arena when one is installed.
     template <typename T, typename... Args>
-    NodePtr<T> makeNodePtr(Args ...args)
+    NodePtr<T> makeNodePtr(Args&&... args)
     {
-        return Ref<T>::Create(std::forward<Args>(args)...);
+        return common::MakeArenaRef<T>(std::forward<Args>(args)...);
     }
     
     struct ASTNode : RefCountedObject
@@ -661,6 +664,10 @@ namespace wio
         bool unwrapResult = false;
         bool propagateResult = false;
         bool isPipelineCall = false;
+        // Filled by semantic analysis. Set on object constructor calls whose
+        // object never escapes the scope that creates it, so the backend can
+        // place it on the stack instead of behind a heap-allocated Ref.
+        bool allocatesOnStack = false;
 
         FunctionCallExpression(NodePtr<Expression> _callee,
             std::vector<NodePtr<TypeSpecifier>> _explicitTypeArguments,
@@ -687,6 +694,10 @@ namespace wio
         NodePtr<TypeSpecifier> type;
         NodePtr<Expression> defaultValue;
         bool isParameterPack = false;
+        // Filled by semantic analysis. Set when the parameter owns a string,
+        // array, or dictionary that the body never writes, so the backend
+        // can take it by const reference instead of copying it.
+        bool passByConstRef = false;
 
         Parameter(NodePtr<Identifier> _name = nullptr,
             NodePtr<TypeSpecifier> _type = nullptr,
@@ -3,6 +3,7 @@
 #include <sstream>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include "wio/ast/ast.h"
@@ -11,12 +12,31 @@
 
 namespace wio::codegen
 {
+    // One translation unit of a split program. `code` starts by including the
+    // program's shared declarations header.
+    struct GeneratedUnit
+    {
+        std::string name;
+        std::string code;
+    };
+
+    // A program split into a shared declarations header and one translation
+    // unit per source file. Templates live in the header; every non-template
+    // definition lives in exactly one unit, and the "program" unit owns
+    // globals and the module API table. Units without definitions are dropped.
+    struct GeneratedUnits
+    {
+        std::string header;
+        std::vector<GeneratedUnit> units;
+    };
+
     class CppGenerator : public ASTVisitor
     {
     public:
         CppGenerator();
         
         std::string generate(const Ref<Program>& program);
+        GeneratedUnits generateUnits(const Ref<Program>& program, const std::string& headerName);
 
 #include "../ast/visitor_overloads.def"
 
@@ -33,8 +53,21 @@ namespace wio::codegen
         Ref<sema::Type> currentFunctionReturnType_;
         bool currentFunctionIsAsync_ = false;
         std::unordered_map<const sema::Symbol*, const VariableDeclaration*> variableDeclarationsBySymbol_;
+        // Locals declared in the function bodies emitted so far. Each owns
+        // its storage, so a callee cannot reach it except through `ref`.
+        std::unordered_set<const sema::Symbol*> ownedLocalSymbols_;
+
+        // Set while generateUnits routes top-level definitions into units.
+        GeneratedUnits* splitUnits_ = nullptr;
+        std::string splitHeaderName_;
+        std::unordered_map<std::string, size_t> splitUnitsByFile_;
+        // Offset in buffer_ where a top-level function's non-template tail
+        // (export wrappers, explicit instantiations) begins, or -1.
+        std::streamoff definitionTailStart_ = -1;
 
         void emitStatements(const std::vector<NodePtr<Statement>>& statements);
+        void emitSplitDefinition(const NodePtr<Statement>& statement);
+        std::string& splitUnitFor(const std::string& sourceFile);
         void generateHeader();
         bool emitIntrinsicMemberAccess(MemberAccessExpression& node);
 
@@ -44,6 +77,21 @@ namespace wio::codegen
         void emitHeaderLine(const std::string& str = "");
         bool emitAnyBoxingIfNeeded(const NodePtr<Expression>& expression, const Ref<sema::Type>& expectedType);
         void emitReadableExpression(const NodePtr<Expression>& expression);
+
+        // One operand of a flattened string `+` chain or interpolation.
+        // Literal text is emitted as a C++ string literal; interpolated
+        // values are dereferenced, `+` operands are emitted readable.
+        struct ConcatPiece
+        {
+            NodePtr<Expression> expression;
+            std::string literal;
+            bool isLiteral = false;
+            bool isInterpolated = false;
+        };
+        bool isStringConcatenation(BinaryExpression& node) const;
+        void collectConcatPieces(const NodePtr<Expression>& expression, bool isInterpolated, std::vector<ConcatPiece>& pieces);
+        void emitConcat(const std::vector<ConcatPiece>& pieces);
+        bool argumentMayChangeDuringCall(const FunctionCallExpression& node, size_t index) const;
         void emitExpressionWithExpectedType(const NodePtr<Expression>& expression, const Ref<sema::Type>& expectedType, bool allowAutoRef = false);
         Ref<sema::FunctionType> getMangledCallableFunctionType(const Ref<sema::Symbol>& callableSymbol,
                                                                const Ref<sema::FunctionType>& resolvedFunctionType,
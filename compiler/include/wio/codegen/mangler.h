@@ -1,22 +1,25 @@
 ﻿#pragma once
 
 #include <string>
+#include <string_view>
 #include <vector>
 #include "wio/sema/type.h"
 
 namespace wio::codegen
 {
+    // Names are taken as views so interned token names and scope paths
+    // are appended into the result without intermediate strings.
     class Mangler
     {
     public:
-        static std::string mangleFunction(const std::string& name, const std::vector<Ref<sema::Type>>& paramTypes, const std::string& scopePath = "");
+        static std::string mangleFunction(std::string_view name, const std::vector<Ref<sema::Type>>& paramTypes, std::string_view scopePath = {});
         
-        static std::string mangleStruct(const std::string& name, const std::string& scopePath = "");
+        static std::string mangleStruct(std::string_view name, std::string_view scopePath = {});
         
-        static std::string mangleGlobalVar(const std::string& name, const std::string& scopePath = "");
+        static std::string mangleGlobalVar(std::string_view name, std::string_view scopePath = {});
         
         static std::string mangleType(const Ref<sema::Type>& type);
 
-        static std::string mangleInterface(const std::string& name, const std::string& scopePath = "");
+        static std::string mangleInterface(std::string_view name, std::string_view scopePath = {});
     };
 }
\ No newline at end of file
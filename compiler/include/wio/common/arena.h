@@ -0,0 +1,160 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "smart_ptr.h"
+
+namespace wio::common
+{
+    // ============================================================
+    // Arena (Bump Allocator)
+    // ============================================================
+
+    /**
+     * @brief Bump allocator for objects that live as long as a compilation.
+     *
+     * Objects are carved out of large blocks and are never freed one by one.
+     * When the arena is destroyed it runs the destructors of the objects it
+     * created in reverse creation order and then releases its blocks.
+     *
+     * RefCountedObject instances created here are marked arena-owned: Ref and
+     * WeakRef skip reference counting for them entirely, so copying a Ref to
+     * an AST node or a type costs a flag test instead of an atomic update.
+     * Such objects must not outlive their arena.
+     */
+    class Arena
+    {
+    public:
+        static constexpr std::size_t kDefaultBlockSize = 256 * 1024;
+
+        explicit Arena(std::size_t blockSize = kDefaultBlockSize) noexcept
+            : m_BlockSize(blockSize)
+        {
+        }
+
+        Arena(const Arena&) = delete;
+        Arena& operator=(const Arena&) = delete;
+        Arena(Arena&&) = delete;
+        Arena& operator=(Arena&&) = delete;
+
+        ~Arena()
+        {
+            for (auto it = m_Finalizers.rbegin(); it != m_Finalizers.rend(); ++it)
+                it->destroy(it->object);
+        }
+
+        /**
+         * @brief Returns uninitialized storage with the requested size and alignment.
+         */
+        [[nodiscard]] void* Allocate(std::size_t size, std::size_t alignment)
+        {
+            auto address = reinterpret_cast<std::uintptr_t>(m_Cursor);
+            auto aligned = (address + alignment - 1) & ~(static_cast<std::uintptr_t>(alignment) - 1);
+            if (m_Cursor == nullptr || aligned + size > reinterpret_cast<std::uintptr_t>(m_Limit))
+            {
+                AddBlock(size + alignment);
+                address = reinterpret_cast<std::uintptr_t>(m_Cursor);
+                aligned = (address + alignment - 1) & ~(static_cast<std::uintptr_t>(alignment) - 1);
+            }
+            m_Cursor = reinterpret_cast<std::byte*>(aligned + size);
+            m_BytesUsed += size;
+            return reinterpret_cast<void*>(aligned);
+        }
+
+        /**
+         * @brief Constructs a T in the arena. RefCountedObject instances are
+         * marked arena-owned before the pointer is handed out.
+         */
+        template <typename T, typename... Args>
+        [[nodiscard]] T* Create(Args&&... args)
+        {
+            void* storage = Allocate(sizeof(T), alignof(T));
+            T* object = ::new (storage) T(std::forward<Args>(args)...);
+            if constexpr (!std::is_trivially_destructible_v<T>)
+                m_Finalizers.push_back({ object, [](void* ptr) { static_cast<T*>(ptr)->~T(); } });
+            if constexpr (std::is_base_of_v<RefCountedObject, T>)
+                static_cast<RefCountedObject*>(object)->m_ArenaOwned = true;
+            ++m_ObjectCount;
+            return object;
+        }
+
+        [[nodiscard]] std::size_t ObjectCount() const noexcept { return m_ObjectCount; }
+        [[nodiscard]] std::size_t BytesUsed() const noexcept { return m_BytesUsed; }
+        [[nodiscard]] std::size_t BlockCount() const noexcept { return m_Blocks.size(); }
+
+        /** @brief The arena installed by the innermost live ArenaScope, if any. */
+        [[nodiscard]] static Arena* Current() noexcept { return s_Current; }
+
+    private:
+        struct Finalizer
+        {
+            void* object;
+            void (*destroy)(void*);
+        };
+
+        void AddBlock(std::size_t minimumSize)
+        {
+            const std::size_t size = minimumSize > m_BlockSize ? minimumSize : m_BlockSize;
+            m_Blocks.push_back(std::make_unique<std::byte[]>(size));
+            m_Cursor = m_Blocks.back().get();
+            m_Limit = m_Cursor + size;
+        }
+
+        friend class ArenaScope;
+
+        std::size_t m_BlockSize;
+        std::vector<std::unique_ptr<std::byte[]>> m_Blocks;
+        std::vector<Finalizer> m_Finalizers;
+        std::byte* m_Cursor = nullptr;
+        std::byte* m_Limit = nullptr;
+        std::size_t m_ObjectCount = 0;
+        std::size_t m_BytesUsed = 0;
+
+        static inline thread_local Arena* s_Current = nullptr;
+    };
+
+    /**
+     * @brief Installs an arena as Arena::Current() for the lifetime of the scope.
+     */
+    class ArenaScope
+    {
+    public:
+        explicit ArenaScope(Arena& arena) noexcept
+            : m_Previous(Arena::s_Current)
+        {
+            Arena::s_Current = &arena;
+        }
+
+        ~ArenaScope() { Arena::s_Current = m_Previous; }
+
+        ArenaScope(const ArenaScope&) = delete;
+        ArenaScope& operator=(const ArenaScope&) = delete;
+
+    private:
+        Arena* m_Previous;
+    };
+
+    /**
+     * @brief Creates a T in the current arena, or on the heap when no arena is installed.
+     * @tparam T The type of the object to create. Must derive from RefCountedObject.
+     */
+    template <typename T, typename... Args>
+    [[nodiscard]] Ref<T> MakeArenaRef(Args&&... args)
+    {
+        if (Arena* arena = Arena::Current())
+            return Ref<T>(arena->Create<T>(std::forward<Args>(args)...));
+        return Ref<T>::Create(std::forward<Args>(args)...);
+    }
+}
+
+namespace wio
+{
+    using common::Arena;
+    using common::ArenaScope;
+}
@@ -4,13 +4,15 @@
 #include <sstream>
 #include <cstdint>
 
+#include "name.h"
+
 namespace wio
 {
     namespace common
     {
         struct Location
         {
-            std::string file;
+            Name file;
             uint64_t line = 0;
             uint64_t column = 0;
 
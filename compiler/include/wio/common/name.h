@@ -0,0 +1,141 @@
+#pragma once
+
+#include <atomic>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <ostream>
+#include <string>
+#include <string_view>
+
+namespace wio::common
+{
+    // ============================================================
+    // Name (Interned String)
+    // ============================================================
+
+    struct NameEntry
+    {
+        std::string text;
+        std::uint32_t id = 0;
+        mutable std::atomic<std::uint32_t> version{0};
+    };
+
+    inline const NameEntry kEmptyNameEntry{};
+
+    /**
+     * @brief Handle to a string interned in the process-wide name table.
+     *
+     * Equal texts always share one table entry, so comparing, hashing and
+     * copying Names never touches the characters or the heap. Tokens,
+     * source locations and scope keys are Names; the lexer interns each
+     * identifier once per distinct spelling. Entries live until the process
+     * exits and every entry carries a dense integer id.
+     */
+    class Name
+    {
+    public:
+        using Entry = NameEntry;
+
+        Name() noexcept : entry_(&kEmptyNameEntry) {}
+        Name(std::string_view text) : entry_(intern(text)) {}
+        Name(const std::string& text) : entry_(intern(text)) {}
+        Name(const char* text) : entry_(intern(text)) {}
+
+        [[nodiscard]] const std::string& str() const noexcept { return entry_->text; }
+        [[nodiscard]] std::string_view view() const noexcept { return entry_->text; }
+        [[nodiscard]] const char* c_str() const noexcept { return entry_->text.c_str(); }
+        [[nodiscard]] const char* data() const noexcept { return entry_->text.data(); }
+        [[nodiscard]] std::uint32_t id() const noexcept { return entry_->id; }
+
+        // Binding version of the name. Scope bumps it whenever any scope
+        // binds or drops the name, so caches keyed by name can detect that
+        // a cached resolution may now be shadowed.
+        [[nodiscard]] std::uint32_t version() const noexcept { return entry_->version.load(std::memory_order_relaxed); }
+        void bumpVersion() const noexcept { entry_->version.fetch_add(1, std::memory_order_relaxed); }
+
+        [[nodiscard]] std::size_t size() const noexcept { return entry_->text.size(); }
+        [[nodiscard]] std::size_t length() const noexcept { return entry_->text.size(); }
+        [[nodiscard]] bool empty() const noexcept { return entry_->text.empty(); }
+        [[nodiscard]] char operator[](std::size_t index) const noexcept { return entry_->text[index]; }
+        [[nodiscard]] char front() const noexcept { return entry_->text.front(); }
+        [[nodiscard]] char back() const noexcept { return entry_->text.back(); }
+        [[nodiscard]] std::string::const_iterator begin() const noexcept { return entry_->text.begin(); }
+        [[nodiscard]] std::string::const_iterator end() const noexcept { return entry_->text.end(); }
+
+        template <typename... Args>
+        [[nodiscard]] std::size_t find(Args&&... args) const { return entry_->text.find(std::forward<Args>(args)...); }
+        template <typename... Args>
+        [[nodiscard]] std::size_t rfind(Args&&... args) const { return entry_->text.rfind(std::forward<Args>(args)...); }
+        template <typename... Args>
+        [[nodiscard]] std::size_t find_first_of(Args&&... args) const { return entry_->text.find_first_of(std::forward<Args>(args)...); }
+        template <typename... Args>
+        [[nodiscard]] std::size_t find_last_of(Args&&... args) const { return entry_->text.find_last_of(std::forward<Args>(args)...); }
+        [[nodiscard]] std::string substr(std::size_t position = 0, std::size_t count = std::string::npos) const
+        {
+            return entry_->text.substr(position, count);
+        }
+        [[nodiscard]] bool starts_with(std::string_view prefix) const noexcept { return view().starts_with(prefix); }
+        [[nodiscard]] bool starts_with(char prefix) const noexcept { return view().starts_with(prefix); }
+        [[nodiscard]] bool ends_with(std::string_view suffix) const noexcept { return view().ends_with(suffix); }
+        [[nodiscard]] bool ends_with(char suffix) const noexcept { return view().ends_with(suffix); }
+        [[nodiscard]] int compare(std::string_view other) const noexcept { return view().compare(other); }
+
+        operator const std::string&() const noexcept { return entry_->text; }
+        operator std::string_view() const noexcept { return entry_->text; }
+
+        // Names are immutable: build composite text in a std::string and
+        // intern the result once, or every intermediate stays in the table.
+        void assign(std::string_view text) { entry_ = intern(text); }
+        void clear() noexcept { entry_ = &kEmptyNameEntry; }
+
+        // Number of distinct names interned so far, including the empty one.
+        [[nodiscard]] static std::size_t InternedCount();
+
+        friend bool operator==(const Name& lhs, const Name& rhs) noexcept { return lhs.entry_ == rhs.entry_; }
+        friend bool operator==(const Name& lhs, std::string_view rhs) noexcept { return lhs.view() == rhs; }
+        friend bool operator==(const Name& lhs, const std::string& rhs) noexcept { return lhs.view() == rhs; }
+        friend bool operator==(const Name& lhs, const char* rhs) noexcept { return lhs.view() == rhs; }
+
+        friend std::strong_ordering operator<=>(const Name& lhs, const Name& rhs) noexcept
+        {
+            return lhs.entry_ == rhs.entry_ ? std::strong_ordering::equal : lhs.view() <=> rhs.view();
+        }
+        friend std::strong_ordering operator<=>(const Name& lhs, std::string_view rhs) noexcept { return lhs.view() <=> rhs; }
+        friend std::strong_ordering operator<=>(const Name& lhs, const std::string& rhs) noexcept { return lhs.view() <=> std::string_view(rhs); }
+        friend std::strong_ordering operator<=>(const Name& lhs, const char* rhs) noexcept { return lhs.view() <=> std::string_view(rhs); }
+
+    private:
+        [[nodiscard]] static const Entry* intern(std::string_view text);
+
+        const Entry* entry_;
+    };
+
+    [[nodiscard]] inline std::string operator+(const Name& lhs, const Name& rhs) { return lhs.str() + rhs.str(); }
+    [[nodiscard]] inline std::string operator+(const Name& lhs, const std::string& rhs) { return lhs.str() + rhs; }
+    [[nodiscard]] inline std::string operator+(const std::string& lhs, const Name& rhs) { return lhs + rhs.str(); }
+    [[nodiscard]] inline std::string operator+(std::string&& lhs, const Name& rhs) { return std::move(lhs) += rhs.str(); }
+    [[nodiscard]] inline std::string operator+(const Name& lhs, std::string_view rhs) { return std::string(lhs.view()).append(rhs); }
+    [[nodiscard]] inline std::string operator+(std::string_view lhs, const Name& rhs) { return std::string(lhs).append(rhs.view()); }
+    [[nodiscard]] inline std::string operator+(const Name& lhs, const char* rhs) { return lhs.str() + rhs; }
+    [[nodiscard]] inline std::string operator+(const char* lhs, const Name& rhs) { return lhs + rhs.str(); }
+    [[nodiscard]] inline std::string operator+(const Name& lhs, const char rhs) { return lhs.str() + rhs; }
+    [[nodiscard]] inline std::string operator+(const char lhs, const Name& rhs) { return lhs + rhs.str(); }
+
+    inline std::string& operator+=(std::string& lhs, const Name& rhs) { return lhs.append(rhs.view()); }
+
+    inline std::ostream& operator<<(std::ostream& stream, const Name& name)
+    {
+        return stream << name.view();
+    }
+}
+
+template <>
+struct std::hash<wio::common::Name>
+{
+    std::size_t operator()(const wio::common::Name& name) const noexcept
+    {
+        return std::hash<std::uint32_t>{}(name.id());
+    }
+};
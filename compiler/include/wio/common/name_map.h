@@ -0,0 +1,137 @@
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "name.h"
+
+namespace wio::common
+{
+    // ============================================================
+    // NameMap (Flat Table Keyed by Name)
+    // ============================================================
+
+    /**
+     * @brief Open-addressing hash table keyed by interned Name.
+     *
+     * Slots live in one array probed linearly from the name id, so a lookup
+     * is an integer hash and pointer compares with no string access. An
+     * empty table holds no allocation. Entries are only removed by clear().
+     */
+    template <typename T>
+    class NameMap
+    {
+    public:
+        [[nodiscard]] std::size_t size() const noexcept { return size_; }
+        [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+
+        [[nodiscard]] T* find(const Name& name) noexcept
+        {
+            return const_cast<T*>(static_cast<const NameMap&>(*this).find(name));
+        }
+
+        [[nodiscard]] const T* find(const Name& name) const noexcept
+        {
+            if (name.empty())
+                return hasEmptyKey_ ? &emptyKeyValue_ : nullptr;
+            if (slots_.empty())
+                return nullptr;
+
+            for (std::size_t index = slotFor(name);; index = (index + 1) & mask())
+            {
+                const Slot& slot = slots_[index];
+                if (slot.name == name)
+                    return &slot.value;
+                if (slot.name.empty())
+                    return nullptr;
+            }
+        }
+
+        [[nodiscard]] bool contains(const Name& name) const noexcept { return find(name) != nullptr; }
+
+        // Returns the value for `name`, inserting a default one if missing.
+        T& operator[](const Name& name)
+        {
+            if (name.empty())
+            {
+                hasEmptyKey_ = true;
+                return emptyKeyValue_;
+            }
+
+            if ((size_ + 1) * 2 > slots_.size())
+                grow();
+
+            for (std::size_t index = slotFor(name);; index = (index + 1) & mask())
+            {
+                Slot& slot = slots_[index];
+                if (slot.name == name)
+                    return slot.value;
+                if (slot.name.empty())
+                {
+                    slot.name = name;
+                    ++size_;
+                    return slot.value;
+                }
+            }
+        }
+
+        void clear()
+        {
+            slots_.clear();
+            size_ = 0;
+            hasEmptyKey_ = false;
+            emptyKeyValue_ = T{};
+        }
+
+        // Visits every entry as fn(const Name&, const T&), in table order.
+        template <typename Fn>
+        void forEach(Fn&& fn) const
+        {
+            if (hasEmptyKey_)
+                fn(Name{}, emptyKeyValue_);
+            for (const Slot& slot : slots_)
+            {
+                if (!slot.name.empty())
+                    fn(slot.name, slot.value);
+            }
+        }
+
+    private:
+        struct Slot
+        {
+            Name name;
+            T value{};
+        };
+
+        [[nodiscard]] std::size_t mask() const noexcept { return slots_.size() - 1; }
+
+        [[nodiscard]] std::size_t slotFor(const Name& name) const noexcept
+        {
+            // Fibonacci hashing spreads the dense ids over the whole table.
+            const auto hash = static_cast<std::uint32_t>(name.id() * 2654435769u);
+            return static_cast<std::size_t>(hash >> (32 - std::countr_zero(slots_.size())));
+        }
+
+        void grow()
+        {
+            std::vector<Slot> previous = std::move(slots_);
+            slots_ = std::vector<Slot>(previous.empty() ? 8 : previous.size() * 2);
+            for (Slot& slot : previous)
+            {
+                if (slot.name.empty())
+                    continue;
+                std::size_t index = slotFor(slot.name);
+                while (!slots_[index].name.empty())
+                    index = (index + 1) & mask();
+                slots_[index] = std::move(slot);
+            }
+        }
+
+        std::vector<Slot> slots_;
+        std::size_t size_ = 0;
+        bool hasEmptyKey_ = false;
+        T emptyKeyValue_{};
+    };
+}
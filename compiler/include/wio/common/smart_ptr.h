@@ -72,6 +72,15 @@ namespace wio::common
         {
             return m_Strong.load(std::memory_order_acquire);
         }
+
+        /**
+         * @brief Reports whether the object was created by an Arena.
+         * Arena-owned objects are not reference counted; the arena destroys them.
+         */
+        [[nodiscard]] bool IsArenaOwned() const noexcept
+        {
+            return m_ArenaOwned;
+        }
     
     
         /**
@@ -98,6 +107,8 @@ namespace wio::common
          */
         void IncStrong() const noexcept
         {
+            if (m_ArenaOwned)
+                return;
             m_Strong.fetch_add(1, std::memory_order_relaxed);
         }
     
@@ -117,6 +128,8 @@ namespace wio::common
          */
         void IncWeak() const noexcept
         {
+            if (m_ArenaOwned)
+                return;
             m_Weak.fetch_add(1, std::memory_order_relaxed);
         }
     
@@ -137,6 +150,9 @@ namespace wio::common
          */
         [[nodiscard]] bool TryIncStrong() const noexcept
         {
+            if (m_ArenaOwned)
+                return true;
+
             uint32_t count = m_Strong.load(std::memory_order_acquire);
     
             while (count != 0)
@@ -154,10 +170,10 @@ namespace wio::common
             return false;
         }
     
-        void DestroyInternal() const noexcept
-        {
-            delete this;
-        }
+        // Defined out of line so the optimizer never inlines the delete into
+        // a chain of releases and flags later, unrelated checks as reads of
+        // freed memory.
+        void DestroyInternal() const noexcept;
     
         template <typename T>
         friend class Ref;
@@ -167,13 +183,19 @@ namespace wio::common
     
         template <typename T>
         friend struct RefDeleter;
+
+        friend class Arena;
     
         /** @brief Number of active strong references. */
         mutable std::atomic<uint32_t> m_Strong{0};
         /** @brief Number of active weak references + 1 (representing the strong refs' hold on memory). */
         mutable std::atomic<uint32_t> m_Weak{1};
+        /** @brief Set by Arena::Create; copies of an arena object start heap-owned. */
+        bool m_ArenaOwned = false;
     };
     
+    // Drops one counted reference. Callers skip arena-owned objects, which
+    // are not counted, before calling in.
     template<typename T>
     struct RefDeleter
     {
@@ -182,7 +204,6 @@ namespace wio::common
             static_assert(sizeof(T) != 0, "T is an incomplete type! Include the header where this Ref is destroyed.");
     
             RefCountedObject* base = ptr;
-    
             if (base->DecStrong() == 0)
             {
                 base->OnZeroStrong();
@@ -201,7 +222,6 @@ namespace wio::common
     
             static_assert(sizeof(T) != 0, "T is an incomplete type! Include the header where this WeakRef is destroyed.");
             RefCountedObject* base = ptr;
-    
             if (base->DecWeak() == 0)
             {
                 base->DestroyInternal();
@@ -559,8 +579,11 @@ namespace wio::common
             if (!m_Ptr)
                 return;
     
-            RefDeleter<T>::Execute(m_Ptr);
-            m_Ptr = nullptr;
+            // Arena objects are not counted. Decide before the deleter runs,
+            // since the object must not be touched once it may be freed.
+            T* ptr = std::exchange(m_Ptr, nullptr);
+            if (!static_cast<const RefCountedObject*>(ptr)->m_ArenaOwned)
+                RefDeleter<T>::Execute(ptr);
         }
     
         template <typename U>
@@ -673,7 +696,7 @@ namespace wio::common
          */
         [[nodiscard]] bool Expired() const noexcept
         {
-            return !m_BasePtr || m_BasePtr->StrongCount() == 0;
+            return !m_BasePtr || (!m_BasePtr->IsArenaOwned() && m_BasePtr->StrongCount() == 0);
         }
     
         /**
@@ -715,7 +738,7 @@ namespace wio::common
             if (!m_BasePtr)
                 return;
 
-            if (m_BasePtr->DecWeak() == 0)
+            if (!m_BasePtr->m_ArenaOwned && m_BasePtr->DecWeak() == 0)
             {
                 m_BasePtr->DestroyInternal();
             }
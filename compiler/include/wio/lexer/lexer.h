@@ -16,8 +16,10 @@ namespace wio
     {
     public:
         explicit Lexer(std::string source, std::string sourceName = {});
+        // Lexes the whole source. Tokens hold interned names and source
+        // offsets, so the source can be dropped once lexing returns.
         std::vector<Token> lex();
-        [[nodiscard]] std::string toString() const;
+        [[nodiscard]] static std::string toString(const std::vector<Token>& tokens);
     private:
         struct InterpolationFrame
         {
@@ -39,6 +41,7 @@ namespace wio
         bool skipComments();
         bool skipNewline();
         
+        [[nodiscard]] Token makeToken(TokenType type, uint64_t begin, const common::Location& start) const;
         [[nodiscard]] Token readIdentifier();
         [[nodiscard]] Token readNumber();
         [[nodiscard]] Token readChar();
@@ -441,12 +441,17 @@ namespace wio
 
    std::string_view tokenTypeToString(TokenType type);
 
+   // Tokens are trivially copyable: `value` is an interned name and
+   // [offset, offset + length) is the lexeme in the lexed source. Tokens
+   // synthesized by the parser or analyzer have no source range.
    struct Token
    {
       TokenType type = TokenType::invalid;
-      std::string value;
+      common::Name value;
       common::Location loc;
       bool isUnicodeString = false;
+      uint32_t offset = 0;
+      uint32_t length = 0;
 
       [[nodiscard]] static Token invalid();
       
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "token.h"
+
+namespace wio
+{
+    // On-disk cache of lexed modules. An entry is keyed by the module source
+    // and the compiler identity, and stores tokens without their file path,
+    // so a rebuild only re-lexes files whose contents changed and identical
+    // sources share one entry. A disabled cache (empty directory) always lexes.
+    class TokenCache
+    {
+    public:
+        TokenCache() = default;
+        TokenCache(std::filesystem::path directory, std::string compilerIdentity);
+
+        [[nodiscard]] bool enabled() const;
+        [[nodiscard]] const std::filesystem::path& directory() const;
+
+        // Returns the cached tokens for `source` or lexes it and stores the
+        // result. Lexer errors propagate unchanged and are never cached.
+        [[nodiscard]] std::vector<Token> lex(const std::string& source, const std::string& sourceName) const;
+
+        [[nodiscard]] std::optional<std::vector<Token>> load(std::string_view source, const std::string& sourceName) const;
+        void store(std::string_view source, const std::vector<Token>& tokens) const;
+
+        [[nodiscard]] uint64_t hitCount() const;
+        [[nodiscard]] uint64_t missCount() const;
+
+        [[nodiscard]] static std::string serialize(std::string_view identity, std::string_view source, const std::vector<Token>& tokens);
+        [[nodiscard]] static std::optional<std::vector<Token>> deserialize(std::string_view data, std::string_view identity,
+                                                                           std::string_view source, const std::string& sourceName);
+
+    private:
+        [[nodiscard]] std::filesystem::path entryPath(std::string_view source) const;
+
+        std::filesystem::path directory_;
+        std::string identity_;
+        mutable uint64_t hits_ = 0;
+        mutable uint64_t misses_ = 0;
+    };
+}
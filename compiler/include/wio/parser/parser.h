@@ -28,8 +28,8 @@ namespace wio
         std::vector<std::string> asyncScopeNames_;
         bool requiresAsyncModule_ = false;
 
-        Token peek(int offset = 0) const;
-        Token previous() const;
+        const Token& peek(int offset = 0) const;
+        const Token& previous() const;
         Token advance();
         void multiAdvance(int count);
         bool match(TokenType type, bool consume = false);
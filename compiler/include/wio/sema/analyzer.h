@@ -14,9 +14,17 @@ namespace wio::sema
     class SemanticAnalyzer : public ASTVisitor
     {
     public:
+        // Wall time and symbol lookups of the last analyze() call.
+        struct AnalysisStats
+        {
+            double seconds = 0.0;
+            Scope::LookupStats lookups;
+        };
+
         SemanticAnalyzer();
         ~SemanticAnalyzer() override;
         void analyze(const Ref<Program>& program);
+        [[nodiscard]] const AnalysisStats& getStats() const { return stats_; }
 
 #include "../ast/visitor_overloads.def"
 
@@ -33,11 +41,36 @@ namespace wio::sema
             bool allowsObjectLike = false;
         };
 
+        AnalysisStats stats_;
         std::vector<Ref<Scope>> scopes_;
         std::vector<Ref<Symbol>> symbols_;
         std::unordered_map<const Symbol*, const FunctionDeclaration*> functionDeclarationsBySymbol_;
         std::unordered_map<const Symbol*, const VariableDeclaration*> variableDeclarationsBySymbol_;
         std::unordered_set<const Symbol*> nonNullNarrowedSymbols_;
+        std::unordered_set<const Symbol*> writtenParameters_;
+        // Every expression naming a callback parameter, and the subset that
+        // only calls it or forwards it to another non-escaping parameter.
+        std::unordered_map<const Symbol*, std::unordered_set<const Expression*>> callbackParameterUses_;
+        std::unordered_set<const Expression*> nonEscapingCallbackUses_;
+        // Object constructor calls whose result may live on the stack: either
+        // a temporary that is only a member receiver, or the initializer of a
+        // local whose every use is one. Decided once the whole program is
+        // analyzed, since that also needs every method of the object type.
+        struct StackObjectCandidate
+        {
+            const StructType* type = nullptr;
+            std::vector<const Symbol*> locals;
+        };
+        std::unordered_map<FunctionCallExpression*, StackObjectCandidate> stackObjectCandidates_;
+        std::unordered_map<const Symbol*, std::unordered_set<const Expression*>> stackObjectLocalUses_;
+        // Receivers of field and method accesses, and every `self` written
+        // inside an object's own methods.
+        std::unordered_map<const Expression*, const MemberAccessExpression*> objectReceiverUses_;
+        std::unordered_set<const MemberAccessExpression*> calledMemberAccesses_;
+        std::unordered_map<const StructType*, std::unordered_set<const Expression*>> objectSelfUses_;
+        // Objects whose generated methods take a strong reference to `this`:
+        // async methods, native methods and methods containing lambdas.
+        std::unordered_set<const StructType*> selfRetainingObjects_;
         std::unordered_map<const Symbol*, const std::vector<NodePtr<AttributeStatement>>*> attributeListsBySymbol_;
         std::unordered_map<std::string, common::Location> exportedCppSymbolLocations_;
         Ref<Scope> currentScope_ = nullptr;
@@ -79,6 +112,12 @@ namespace wio::sema
         
         void enterScope(ScopeKind kind);
         void exitScope();
+        void noteParameterWrite(const NodePtr<Expression>& target);
+        void noteNonEscapingCallbackUse(const NodePtr<Expression>& expression);
+        void noteForwardedCallbackArguments(const FunctionCallExpression& call, const Ref<Symbol>& callee);
+        void noteObjectReceiverUse(const MemberAccessExpression& access);
+        void noteSelfRetainingObject(const Ref<Type>& type);
+        void markStackObjectConstructions();
 
         [[nodiscard]] std::string getCurrentNamespacePath() const;
         Ref<Symbol> createSymbol(std::string name, Ref<Type> type, SymbolKind kind, common::Location loc, SymbolFlags flags = SymbolFlags::createAllFalse());
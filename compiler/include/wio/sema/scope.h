@@ -1,7 +1,11 @@
 ﻿#pragma once
 
-#include <map>
+#include <cstdint>
 #include <string>
+#include <utility>
+#include <vector>
+#include "wio/common/name.h"
+#include "wio/common/name_map.h"
 #include "wio/common/smart_ptr.h"
 
 namespace wio::sema
@@ -12,20 +16,51 @@ namespace wio::sema
     class Scope : public RefCountedObject
     {
     public:
+        using SymbolEntry = std::pair<common::Name, Ref<Symbol>>;
+
+        // Per-thread counters since the last resetLookupStats(). `lookups`
+        // counts resolve and resolveLocally calls; `cacheHits` the resolves
+        // answered from a resolution cache; `parentSteps` the scopes visited
+        // on the way up when the cache missed.
+        struct LookupStats
+        {
+            uint64_t lookups = 0;
+            uint64_t cacheHits = 0;
+            uint64_t parentSteps = 0;
+        };
+
         Scope(WeakRef<Scope> parent, ScopeKind kind);
+        ~Scope() override;
 
-        void define(const std::string& name, const Ref<Symbol>& symbol);
-        Ref<Symbol> resolve(const std::string& name);
-        Ref<Symbol> resolveLocally(const std::string& name);
-        const std::map<std::string, Ref<Symbol>>& getSymbols() const;
+        // Symbols are keyed by interned name, so lookups hash the name id
+        // instead of comparing characters. Names found in an enclosing scope
+        // are cached here until the name is defined again anywhere.
+        void define(const common::Name& name, const Ref<Symbol>& symbol);
+        Ref<Symbol> resolve(const common::Name& name);
+        Ref<Symbol> resolveLocally(const common::Name& name);
+        // Sorted by name so callers iterate in a deterministic order.
+        std::vector<SymbolEntry> getSymbols() const;
         
         WeakRef<Scope> getParent() const;
         ScopeKind getKind() const;
 
         void clear();
+
+        [[nodiscard]] static LookupStats lookupStats();
+        static void resetLookupStats();
     private:
+        struct CachedResolution
+        {
+            Ref<Symbol> symbol;
+            uint32_t version = 0;
+        };
+
+        Ref<Symbol> resolveInChain(const common::Name& name);
+        void dropBindings();
+
         WeakRef<Scope> parent_;
         ScopeKind kind_;
-        std::map<std::string, Ref<Symbol>> symbols_;
+        common::NameMap<Ref<Symbol>> symbols_;
+        common::NameMap<CachedResolution> resolved_;
     };
 }
@@ -36,6 +36,14 @@ namespace wio::sema
         std::vector<Ref<Type>> genericParameterDefaults;
         bool hasGenericParameterPack = false;
         std::vector<std::vector<Ref<Type>>> resolvedGenericInstantiations;
+        // Aligned with a function's parameters. Set for callback parameters
+        // that are only ever called, so the backend can take them as a
+        // non-owning function view instead of an owning std::function.
+        std::vector<bool> functionRefParameters;
+        // Aligned with a function's parameters. Set for parameters taken by
+        // const reference (Parameter::passByConstRef); call sites copy any
+        // argument the callee could see change while it runs.
+        std::vector<bool> constRefParameters;
         Ref<Type> aliasTargetType = nullptr;
         Ref<Type> extensionTargetType = nullptr;
         std::string extensionMemberName;
@@ -1,10 +1,13 @@
 ﻿#pragma once
 
+#include <cstdint>
 #include <vector>
 #include <memory>
 #include <string>
+#include <unordered_map>
 
 #include "type.h"
+#include "wio/common/arena.h"
 #include "wio/common/smart_ptr.h" 
 
 namespace wio::sema
@@ -71,8 +74,47 @@ namespace wio::sema
         Ref<Type> getOrCreateTypePackViewType(const std::string& packName, std::vector<Ref<Type>> elementTypes = {});
         Ref<Type> getOrCreatePackStorageType(const std::string& packName, std::vector<Ref<Type>> elementTypes = {});
 
+        // Type objects allocated so far, and getOrCreate* calls answered
+        // with an existing interned type instead of a new allocation.
+        [[nodiscard]] uint64_t createdTypeCount() const { return createdTypes_; }
+        [[nodiscard]] uint64_t internedReuseCount() const { return internedReuses_; }
+
     private:
+        // Structural identity of an interned type. Component types are
+        // compared by address, which is exact because they are interned too
+        // (or are nominal types that exist once).
+        struct InternKey
+        {
+            TypeKind kind;
+            uint64_t scalar = 0;
+            std::string text;
+            std::vector<const Type*> parts;
+
+            bool operator==(const InternKey&) const = default;
+        };
+
+        struct InternKeyHash
+        {
+            size_t operator()(const InternKey& key) const noexcept;
+        };
+
+        template <typename T, typename... Args>
+        Ref<Type> intern(InternKey key, Args&&... args)
+        {
+            if (auto it = interned_.find(key); it != interned_.end())
+            {
+                ++internedReuses_;
+                return it->second;
+            }
+            Ref<Type> type = makeType<T>(std::forward<Args>(args)...);
+            interned_.emplace(std::move(key), type);
+            return type;
+        }
+
         std::vector<Ref<Type>> ownedTypes_;
+        std::unordered_map<InternKey, Ref<Type>, InternKeyHash> interned_;
+        uint64_t createdTypes_ = 0;
+        uint64_t internedReuses_ = 0;
 
         Ref<Type> t_void = nullptr;
         Ref<Type> t_bool = nullptr;
@@ -102,11 +144,15 @@ namespace wio::sema
         Ref<Type> t_null = nullptr;
         Ref<Type> t_object = nullptr;
 
+        // Arena-owned types are kept alive by the arena; only heap types
+        // created outside a compilation need an owning reference here.
         template <typename T, typename... Args>
         Ref<T> makeType(Args&&... args)
         {
-            auto uPtr = Ref<T>::Create(std::forward<Args>(args)...);
-            ownedTypes_.push_back(uPtr);
+            auto uPtr = common::MakeArenaRef<T>(std::forward<Args>(args)...);
+            ++createdTypes_;
+            if (!uPtr->IsArenaOwned())
+                ownedTypes_.push_back(uPtr);
             return uPtr;
         }
     };
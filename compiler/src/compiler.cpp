@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <chrono>
 #include <cerrno>
 #include <cctype>
@@ -10,7 +11,9 @@
 #include <cstring>
 #include <filesystem>
 #include <fstream>
+#include <functional>
 #include <iterator>
+#include <mutex>
 #include <optional>
 #include <regex>
 #include <sstream>
@@ -33,10 +36,12 @@
 #endif
 
 #include "wio/codegen/cpp_generator.h"
+#include "wio/common/arena.h"
 #include "wio/common/exception.h"
 #include "wio/common/filesystem/filesystem.h"
 #include "wio/common/logger.h"
 #include "wio/lexer/lexer.h"
+#include "wio/lexer/token_cache.h"
 #include "wio/parser/parser.h"
 #include "wio/sema/analyzer.h"
 
@@ -52,6 +57,9 @@ namespace wio
 
     struct AppData
     {
+        // AST nodes and types of the compilation. Declared first so it is
+        // destroyed after everything that still refers into it.
+        common::Arena programArena;
         std::filesystem::path basePath;
         std::filesystem::path executablePath;
         CompilerFlags flags;
@@ -61,7 +69,9 @@ namespace wio
         std::unordered_map<std::string, std::vector<std::string>> moduleExportedSymbols;
         std::unordered_map<std::string, bool> moduleDeclaresTopLevelRealms;
         std::vector<RequiredCppHeader> requiredCppHeaders;
+        TokenCache tokenCache;
         BuildTarget buildTarget = BuildTarget::Executable;
+        size_t backendJobs = 0;
     };
 
     
@@ -154,6 +164,86 @@ namespace wio
             return {};
         }
 
+        // Same root as std::environment::CacheDirectory, so the CLI caches and
+        // the compiler caches live side by side under Wio/cache.
+        std::filesystem::path getDefaultCacheDir()
+        {
+            auto fromEnvironment = [](const char* name) -> std::filesystem::path
+            {
+                const char* value = std::getenv(name);
+                return value == nullptr || *value == '\0' ? std::filesystem::path{} : std::filesystem::path(value);
+            };
+
+#if defined(_WIN32)
+            std::filesystem::path root = fromEnvironment("LOCALAPPDATA");
+            if (root.empty())
+            {
+                if (const auto home = fromEnvironment("USERPROFILE"); !home.empty())
+                    root = home / "AppData" / "Local";
+            }
+#else
+            std::filesystem::path root = fromEnvironment("XDG_CACHE_HOME");
+            if (root.empty())
+            {
+                if (const auto home = fromEnvironment("HOME"); !home.empty())
+                    root = home / ".cache";
+            }
+#endif
+            if (root.empty())
+            {
+                std::error_code ec;
+                root = std::filesystem::temp_directory_path(ec);
+                if (ec)
+                    return {};
+            }
+            return (root / "Wio" / "cache").make_preferred();
+        }
+
+        // Cache entries are only valid for the exact compiler binary that wrote
+        // them: a rebuilt lexer may tokenize the same source differently.
+        std::string getCompilerIdentity()
+        {
+            const std::filesystem::path executable = getExecutablePath();
+            if (executable.empty())
+                return {};
+
+            std::error_code ec;
+            const auto size = std::filesystem::file_size(executable, ec);
+            if (ec)
+                return {};
+            const auto modified = std::filesystem::last_write_time(executable, ec);
+            if (ec)
+                return {};
+            return common::formatString("{};{};{}", WIO_VERSION, size, static_cast<long long>(modified.time_since_epoch().count()));
+        }
+
+        // An explicit directory argument wins; otherwise the named subdirectory
+        // of the default cache root. Empty when no location can be determined.
+        std::filesystem::path resolveCacheDir(const std::string& argumentName, std::string_view defaultSubdir)
+        {
+            const auto configuredDirs = gAppData.argParser.GetValuesOf<std::string>(argumentName);
+            if (!configuredDirs.empty())
+                return std::filesystem::absolute(std::filesystem::path(configuredDirs.front())).make_preferred();
+
+            const std::filesystem::path root = getDefaultCacheDir();
+            return root.empty() ? root : (root / defaultSubdir).make_preferred();
+        }
+
+        TokenCache makeTokenCache()
+        {
+            if (gAppData.flags.get_NoModuleCache())
+                return {};
+
+            const std::string identity = getCompilerIdentity();
+            if (identity.empty())
+                return {};
+
+            const std::filesystem::path directory = resolveCacheDir("MODULE-CACHE-DIR", "modules");
+            if (directory.empty())
+                return {};
+            return { directory, identity };
+        }
+
         std::vector<std::filesystem::path> getToolchainRootCandidates()
         {
             std::vector<std::filesystem::path> candidates;
@@ -484,6 +574,24 @@ namespace wio
             throw std::invalid_argument("Unknown build target: " + value + ". Expected one of: exe, static, shared.");
         }
 
+        size_t parseBackendJobs(const std::string& value)
+        {
+            size_t parsedLength = 0;
+            unsigned long long jobs = 0;
+            try
+            {
+                jobs = std::stoull(value, &parsedLength);
+            }
+            catch (const std::exception&)
+            {
+                parsedLength = 0;
+            }
+
+            if (parsedLength != value.size() || jobs == 0)
+                throw std::invalid_argument("Invalid backend job count: " + value + ". Expected a positive integer.");
+            return static_cast<size_t>(jobs);
+        }
+
         std::string buildTargetToString(BuildTarget target)
         {
             switch (target)
@@ -1780,6 +1888,323 @@ namespace wio
             return std::string(fallbackSummary);
         }
 
+        // Identifies everything a precompiled prelude depends on: the exact
+        // toolchain, the compile flags, the include path, and the runtime/SDK
+        // headers it was built from. Empty when the toolchain cannot be queried.
+        // Querying the toolchain and walking the headers is done once per
+        // process for each distinct set of inputs.
+        std::string makePrecompiledPreludeKey(const std::filesystem::path& backendCompilerPath,
+                                              const std::vector<std::string>& compileFlags,
+                                              const std::vector<std::filesystem::path>& systemIncludeDirs,
+                                              const std::vector<std::string>& includeDirs)
+        {
+            std::stringstream inputs;
+            inputs << backendCompilerPath.string() << '\n';
+            for (const auto& flag : compileFlags)
+                inputs << "flag:" << flag << '\n';
+            for (const auto& includeDir : includeDirs)
+                inputs << "include:" << includeDir << '\n';
+            for (const auto& includeDir : systemIncludeDirs)
+                inputs << "system:" << includeDir.string() << '\n';
+
+            static std::mutex keysMutex;
+            static std::unordered_map<std::string, std::string> keys;
+            std::lock_guard lock(keysMutex);
+            if (auto cached = keys.find(inputs.str()); cached != keys.end())
+                return cached->second;
+
+            const CommandResult version = runCommandCaptureOutput(
+                quoteCommand(backendCompilerPath.string()) + " -dumpfullversion -dumpmachine",
+                { backendCompilerPath.parent_path() }
+            );
+            if (version.exitCode != 0)
+                return keys[inputs.str()] = {};
+
+            std::stringstream key;
+            key << WIO_VERSION << '\n' << backendCompilerPath.string() << '\n' << trimWhitespace(version.output) << '\n';
+            for (const auto& flag : compileFlags)
+                key << "flag:" << flag << '\n';
+            for (const auto& includeDir : includeDirs)
+                key << "include:" << includeDir << '\n';
+            for (const auto& includeDir : systemIncludeDirs)
+            {
+                key << "system:" << includeDir.string() << '\n';
+                std::error_code ec;
+                for (std::filesystem::recursive_directory_iterator it(includeDir, ec), end; !ec && it != end; it.increment(ec))
+                {
+                    std::error_code entryEc;
+                    if (!it->is_regular_file(entryEc))
+                        continue;
+                    const auto size = it->file_size(entryEc);
+                    const auto modified = it->last_write_time(entryEc);
+                    if (entryEc)
+                        continue;
+                    key << it->path().generic_string() << ';' << size << ';'
+                        << static_cast<long long>(modified.time_since_epoch().count()) << '\n';
+                }
+            }
+
+            std::stringstream hex;
+            hex << std::hex << common::fnv1a(key.str().c_str());
+            return keys[inputs.str()] = hex.str();
+        }
+
+        // Returns a directory holding wio_prelude.h and its precompiled form
+        // for these flags, building it on first use. Callers put the directory
+        // first on the include path; GCC then loads the .gch instead of parsing
+        // the prelude, and parses the copied header as usual if the .gch turns
+        // out to be unusable. An empty result means compile without it.
+        std::filesystem::path preparePrecompiledPrelude(const std::filesystem::path& backendCompilerPath,
+                                                        const std::vector<std::string>& compileFlags,
+                                                        const std::vector<std::filesystem::path>& systemIncludeDirs,
+                                                        const std::vector<std::string>& includeDirs,
+                                                        const std::filesystem::path& runtimeIncludeDir)
+        {
+            // Clang and MSVC do not pick up a .gch through a plain #include.
+            if (gAppData.flags.get_NoPch() || !backendCompilerLooksGnuLike(backendCompilerPath.string()))
+                return {};
+
+            const std::filesystem::path preludeHeader = runtimeIncludeDir / "wio_prelude.h";
+            std::error_code ec;
+            if (!std::filesystem::is_regular_file(preludeHeader, ec))
+                return {};
+
+            const std::filesystem::path cacheRoot = resolveCacheDir("PCH-DIR", "pch");
+            if (cacheRoot.empty())
+                return {};
+            const std::string key = makePrecompiledPreludeKey(backendCompilerPath, compileFlags, systemIncludeDirs, includeDirs);
+            if (key.empty())
+                return {};
+
+            const std::filesystem::path directory = (cacheRoot / key).make_preferred();
+            const std::filesystem::path header = directory / "wio_prelude.h";
+            const std::filesystem::path precompiled = directory / "wio_prelude.h.gch";
+            const std::filesystem::path failedMarker = directory / "failed";
+            if (std::filesystem::is_regular_file(precompiled, ec) && std::filesystem::is_regular_file(header, ec))
+                return directory;
+            // A toolchain that could not build the prelude will not on the next
+            // compile either, so skip straight to the plain build for a while.
+            // The marker expires because the failure may have been transient:
+            // an interrupted build, a full disk or a killed compiler.
+            constexpr auto failedPrecompileRetryDelay = std::chrono::hours(1);
+            if (const auto failedAt = std::filesystem::last_write_time(failedMarker, ec); !ec)
+            {
+                if (std::filesystem::file_time_type::clock::now() - failedAt < failedPrecompileRetryDelay)
+                    return {};
+                std::filesystem::remove(failedMarker, ec);
+            }
+
+            std::filesystem::create_directories(directory, ec);
+            if (ec)
+                return {};
+
+            // Concurrent compilers may race to build the same entry; each writes
+            // its own temporaries and the renames publish complete files only.
+            const std::string unique = common::formatString(
+                ".tmp-{}-{}",
+                std::chrono::steady_clock::now().time_since_epoch().count(),
+                std::hash<std::thread::id>{}(std::this_thread::get_id())
+            );
+            auto temporaryHeader = header;
+            temporaryHeader += unique;
+            auto temporaryPrecompiled = precompiled;
+            temporaryPrecompiled += unique;
+            auto discardTemporaries = [&]()
+            {
+                std::error_code cleanupEc;
+                std::filesystem::remove(temporaryHeader, cleanupEc);
+                std::filesystem::remove(temporaryPrecompiled, cleanupEc);
+            };
+
+            std::filesystem::copy_file(preludeHeader, temporaryHeader, std::filesystem::copy_options::overwrite_existing, ec);
+            if (ec)
+            {
+                discardTemporaries();
+                return {};
+            }
+
+            std::stringstream cmd;
+            cmd << quoteCommand(backendCompilerPath.string());
+            appendBackendArguments(cmd, compileFlags);
+            cmd << " -x c++-header " << quotePath(temporaryHeader);
+            appendIncludeDirectories(cmd, systemIncludeDirs);
+            appendIncludeDirectories(cmd, includeDirs);
+            cmd << " -o " << quotePath(temporaryPrecompiled);
+
+            const CommandResult result = runCommandCaptureOutput(cmd.str(), { backendCompilerPath.parent_path() });
+            if (result.exitCode != 0)
+            {
+                discardTemporaries();
+                filesystem::writeFilepath(result.output, failedMarker);
+                WIO_LOG_INFO("Precompiled runtime prelude unavailable; compiling without it.");
+                return {};
+            }
+
+            std::filesystem::rename(temporaryHeader, header, ec);
+            if (!ec)
+                std::filesystem::rename(temporaryPrecompiled, precompiled, ec);
+            if (ec)
+            {
+                discardTemporaries();
+                return std::filesystem::is_regular_file(precompiled, ec) ? directory : std::filesystem::path{};
+            }
+            return directory;
+        }
+
+        std::filesystem::path makeSplitUnitsDir(const std::filesystem::path& cppPath)
+        {
+            auto unitsDir = cppPath;
+            unitsDir.replace_extension(".units");
+            return unitsDir.make_preferred();
+        }
+
+        // Writes a split program into `unitsDir` and returns the unit sources
+        // in order. Files whose contents did not change are left untouched, and
+        // leftovers from units that no longer exist are removed.
+        std::optional<std::vector<std::filesystem::path>> writeSplitUnits(const codegen::GeneratedUnits& units,
+                                                                          const std::filesystem::path& unitsDir,
+                                                                          const std::string& headerName)
+        {
+            std::error_code ec;
+            std::filesystem::create_directories(unitsDir, ec);
+            if (ec)
+                return std::nullopt;
+
+            auto writeIfChanged = [](const std::string& content, const std::filesystem::path& path)
+            {
+                std::error_code existsEc;
+                if (std::filesystem::is_regular_file(path, existsEc) && filesystem::readFile(path) == content)
+                    return true;
+                return filesystem::writeFilepath(content, path);
+            };
+
+            std::unordered_set<std::string> keep{ headerName };
+            if (!writeIfChanged(units.header, unitsDir / headerName))
+                return std::nullopt;
+
+            std::vector<std::filesystem::path> sources;
+            sources.reserve(units.units.size());
+            for (size_t i = 0; i < units.units.size(); ++i)
+            {
+                const std::string stem = std::to_string(i) + "_" + units.units[i].name;
+                const std::filesystem::path source = (unitsDir / (stem + ".cpp")).make_preferred();
+                if (!writeIfChanged(units.units[i].code, source))
+                    return std::nullopt;
+                keep.insert(stem + ".cpp");
+                keep.insert(stem + ".o");
+                keep.insert(stem + ".o.stamp");
+                sources.push_back(source);
+            }
+
+            for (std::filesystem::directory_iterator it(unitsDir, ec), end; !ec && it != end; it.increment(ec))
+            {
+                std::error_code removeEc;
+                if (!keep.contains(it->path().filename().string()))
+                    std::filesystem::remove(it->path(), removeEc);
+            }
+            return sources;
+        }
+
+        struct SplitCompileResult
+        {
+            std::vector<std::filesystem::path> objects;
+            std::optional<CommandResult> failure;
+            size_t compiledCount = 0;
+        };
+
+        // Compiles every unit into an object next to it, running up to `jobs`
+        // backend compilers at once. A unit is skipped when its object carries
+        // a stamp for the same compile command, header, and unit source, so an
+        // incremental build only recompiles the units whose generated code
+        // changed. `compileCommand` receives a source and object path and
+        // returns the full backend command line.
+        SplitCompileResult compileSplitUnits(const std::vector<std::filesystem::path>& sources,
+                                             const std::string& header,
+                                             const std::function<std::string(const std::filesystem::path&, const std::filesystem::path&)>& compileCommand,
+                                             const std::filesystem::path& backendCompilerPath,
+                                             size_t jobs)
+        {
+            SplitCompileResult result;
+            std::vector<std::string> commands;
+            std::vector<std::string> stamps;
+            std::vector<size_t> pending;
+            for (size_t i = 0; i < sources.size(); ++i)
+            {
+                auto object = sources[i];
+                object.replace_extension(".o");
+                commands.push_back(compileCommand(sources[i], object));
+
+                const std::string fingerprint = commands.back() + '\n' + header + '\n' + filesystem::readFile(sources[i]);
+                std::stringstream stamp;
+                stamp << std::hex << common::fnv1a(fingerprint.c_str());
+                stamps.push_back(stamp.str());
+
+                auto stampPath = object;
+                stampPath += ".stamp";
+                std::error_code ec;
+                if (!std::filesystem::is_regular_file(object, ec) ||
+                    !std::filesystem::is_regular_file(stampPath, ec) ||
+                    filesystem::readFile(stampPath) != stamps.back())
+                {
+                    // Drop the stamp first so an interrupted build never
+                    // pairs it with a stale object.
+                    std::filesystem::remove(stampPath, ec);
+                    pending.push_back(i);
+                }
+                result.objects.push_back(std::move(object));
+            }
+
+            std::vector<CommandResult> results(sources.size());
+            std::atomic<size_t> next{ 0 };
+            std::atomic<bool> failed{ false };
+            auto worker = [&]()
+            {
+                for (size_t slot = next++; slot < pending.size() && !failed; slot = next++)
+                {
+                    const size_t index = pending[slot];
+                    results[index] = runCommandCaptureOutput(commands[index]);
+                    if (results[index].exitCode != 0)
+                    {
+                        failed = true;
+                        continue;
+                    }
+
+                    auto stampPath = result.objects[index];
+                    stampPath += ".stamp";
+                    filesystem::writeFilepath(stamps[index], stampPath);
+                }
+            };
+
+            {
+#if defined(_WIN32)
+                // Workers cannot each patch the process-wide Path, so put the
+                // compiler directory on it once for the whole phase.
+                ScopedWindowsPathOverride scopedPathOverride({ backendCompilerPath.parent_path() });
+#else
+                WIO_UNUSED(backendCompilerPath);
+#endif
+                const size_t threadCount = std::min(std::max<size_t>(jobs, 1), pending.size());
+                std::vector<std::thread> threads;
+                for (size_t i = 1; i < threadCount; ++i)
+                    threads.emplace_back(worker);
+                worker();
+                for (auto& thread : threads)
+                    thread.join();
+            }
+
+            for (const size_t index : pending)
+            {
+                if (results[index].exitCode != 0 && !results[index].command.empty())
+                {
+                    result.failure = results[index];
+                    break;
+                }
+                if (!results[index].command.empty())
+                    ++result.compiledCount;
+            }
+            return result;
+        }
+
         void reportBackendCommandFailure(std::string_view summary,
                                          int exitCode,
                                          const std::string& output,
@@ -2572,6 +2997,46 @@ namespace wio
                     .MultiValue()
                     .SetDescription("Adds an extra library or library file for the backend C++ linker.")
             )
+            .Add(
+                Argonaut::Argument("MODULE-CACHE-DIR")
+                    .AddAlias("--module-cache-dir")
+                    .SetDescription("Overrides the directory used to cache lexed Wio modules between compilations.")
+            )
+            .Add(
+                Argonaut::Argument("NO-MODULE-CACHE")
+                    .AddAlias("--no-module-cache")
+                    .Flag()
+                    .SetDescription("Disables the on-disk Wio module cache.")
+            )
+            .Add(
+                Argonaut::Argument("PCH-DIR")
+                    .AddAlias("--pch-dir")
+                    .SetDescription("Overrides the directory used to cache the precompiled runtime prelude.")
+            )
+            .Add(
+                Argonaut::Argument("NO-PCH")
+                    .AddAlias("--no-pch")
+                    .Flag()
+                    .SetDescription("Compiles generated C++ without the precompiled runtime prelude.")
+            )
+            .Add(
+                Argonaut::Argument("NO-STACK-OBJECTS")
+                    .AddAlias("--no-stack-objects")
+                    .Flag()
+                    .SetDescription("Heap-allocates every object, including those that never escape the scope creating them.")
+            )
+            .Add(
+                Argonaut::Argument("SPLIT-CPP")
+                    .AddAlias("--split-cpp")
+                    .Flag()
+                    .SetDescription("Generates one C++ translation unit per source file and compiles them in parallel.")
+            )
+            .Add(
+                Argonaut::Argument("JOBS")
+                    .AddAlias("-j")
+                    .AddAlias("--jobs")
+                    .SetDescription("Sets how many backend compilers --split-cpp runs at once (default: hardware threads).")
+            )
             .Add(
                 Argonaut::Argument("BACKEND-ARG")
                     .AddAlias("--backend-arg")
@@ -2648,12 +3113,21 @@ namespace wio
             DEFINE_FLAG_VALUE("NO-BUILTIN", NoBuiltin);
             DEFINE_FLAG_VALUE("WARN-AS-ERROR", WarnAsError);
             DEFINE_FLAG_VALUE("RUN", Run);
+            DEFINE_FLAG_VALUE("NO-MODULE-CACHE", NoModuleCache);
+            DEFINE_FLAG_VALUE("NO-PCH", NoPch);
+            DEFINE_FLAG_VALUE("SPLIT-CPP", SplitCpp);
+            DEFINE_FLAG_VALUE("NO-STACK-OBJECTS", NoStackObjects);
             
 #undef DEFINE_FLAG_VALUE
 
             std::vector<std::string> buildTargetValues = gAppData.argParser.GetValuesOf<std::string>("TARGET");
             std::string buildTargetValue = buildTargetValues.empty() ? "exe" : buildTargetValues.front();
             gAppData.buildTarget = parseBuildTarget(buildTargetValue);
+
+            std::vector<std::string> jobValues = gAppData.argParser.GetValuesOf<std::string>("JOBS");
+            gAppData.backendJobs = jobValues.empty()
+                ? std::max<size_t>(1, std::thread::hardware_concurrency())
+                : parseBackendJobs(jobValues.front());
         }
         catch (const std::exception& e)
         {
@@ -2664,6 +3138,7 @@ namespace wio
     // NOLINTNEXTLINE(readability-convert-member-functions-to-static)
     int Compiler::compile() const
     {
+        common::ArenaScope programArenaScope(gAppData.programArena);
         try
         {
             std::vector<std::string> filePaths = gAppData.argParser.GetValuesOf<std::string>("FILE");
@@ -2682,9 +3157,9 @@ namespace wio
             filesystem::stripBOM(source);
 
             // 1. Lexer
+            gAppData.tokenCache = makeTokenCache();
             const std::string sourceDisplayPath = std::filesystem::absolute(sourcePath).make_preferred().string();
-            Lexer lexer(source, sourceDisplayPath);
-            auto tokens = lexer.lex();
+            auto tokens = gAppData.tokenCache.lex(source, sourceDisplayPath);
 
             if (gAppData.flags.get_ShowTokens())
             {
@@ -2919,6 +3394,16 @@ namespace wio
                     linkLibraries,
                     backendArgs
                 );
+                const auto& typeContext = gAppData.typeContext_;
+                WIO_LOG_INFO("  Type objects: {} created, {} reused through interning",
+                             typeContext.createdTypeCount(), typeContext.internedReuseCount());
+                const auto& analysis = analyzer.getStats();
+                const auto lookupsPerSecond = analysis.seconds > 0.0
+                    ? static_cast<uint64_t>(static_cast<double>(analysis.lookups.lookups) / analysis.seconds)
+                    : 0;
+                WIO_LOG_INFO("  Semantic analysis: {} ms, {} symbol lookups ({} per second), {} answered from scope caches",
+                             static_cast<uint64_t>(analysis.seconds * 1000.0), analysis.lookups.lookups,
+                             lookupsPerSecond, analysis.lookups.cacheHits);
             }
 
             if (gAppData.flags.get_DryRun())
@@ -2929,8 +3414,15 @@ namespace wio
 
             // 4. Code Generation
             std::string cppCode;
+            codegen::GeneratedUnits generatedUnits;
+            const bool splitCpp = gAppData.flags.get_SplitCpp();
+            const std::filesystem::path unitsDir = makeSplitUnitsDir(cppPath);
+            const std::string unitsHeaderName = cppPath.stem().string() + ".h";
             codegen::CppGenerator generator;
-            cppCode = generator.generate(program);
+            if (splitCpp)
+                generatedUnits = generator.generateUnits(program, unitsHeaderName);
+            else
+                cppCode = generator.generate(program);
 
             std::error_code intermediateDirEc;
             if (cppPath.has_parent_path())
@@ -2941,13 +3433,28 @@ namespace wio
                 return EXIT_FAILURE;
             }
 
-            if (!filesystem::writeFilepath(cppCode, cppPath))
+            std::vector<std::filesystem::path> unitSources;
+            if (splitCpp)
             {
-                WIO_LOG_FATAL("Generated C++ output could not be written to: {}", cppPath.string());
-                return EXIT_FAILURE;
+                auto writtenUnits = writeSplitUnits(generatedUnits, unitsDir, unitsHeaderName);
+                if (!writtenUnits)
+                {
+                    WIO_LOG_FATAL("Generated C++ units could not be written to: {}", unitsDir.string());
+                    return EXIT_FAILURE;
+                }
+                unitSources = std::move(*writtenUnits);
+                WIO_LOG_INFO("Generated C++ units: {} ({} translation units)", pathToDisplayString(unitsDir), unitSources.size());
             }
+            else
+            {
+                if (!filesystem::writeFilepath(cppCode, cppPath))
+                {
+                    WIO_LOG_FATAL("Generated C++ output could not be written to: {}", cppPath.string());
+                    return EXIT_FAILURE;
+                }
 
-            WIO_LOG_INFO("Generated C++ output: {}", pathToDisplayString(cppPath));
+                WIO_LOG_INFO("Generated C++ output: {}", pathToDisplayString(cppPath));
+            }
 
             if (gAppData.flags.get_EmitCpp())
                 return EXIT_SUCCESS;
@@ -3008,24 +3515,49 @@ namespace wio
                         return objectPath.make_preferred();
                     };
 
-                    auto compileObject = [&](const std::filesystem::path& inputPath, size_t index) -> CommandResult
-                    {
-                        std::filesystem::path objectPath = buildObjectPath(inputPath, index);
-                        objectFiles.push_back(objectPath);
+                    std::vector<std::string> preludeFlags{ "-std=c++20" };
+                    preludeFlags.insert(preludeFlags.end(), backendCompilerArgs.begin(), backendCompilerArgs.end());
+                    const std::filesystem::path preludeDir = preparePrecompiledPrelude(
+                        backendCompilerPath, preludeFlags, systemIncludeDirs, includeDirs, runtimeIncludeDir);
 
+                    auto makeCompileCommand = [&](const std::filesystem::path& inputPath, const std::filesystem::path& objectPath)
+                    {
                         std::stringstream compileCmd;
                         compileCmd << quoteCommand(backendCompiler);
                         compileCmd << " -std=c++20 -c ";
                         compileCmd << quotePath(inputPath);
+                        if (!preludeDir.empty())
+                            compileCmd << " -I" << quotePath(preludeDir);
                         appendIncludeDirectories(compileCmd, systemIncludeDirs);
                         appendIncludeDirectories(compileCmd, includeDirs);
                         appendBackendArguments(compileCmd, backendCompilerArgs);
                         compileCmd << " -o " << quotePath(objectPath);
+                        return compileCmd.str();
+                    };
 
-                        return runCommandCaptureOutput(compileCmd.str(), { backendCompilerPath.parent_path() });
+                    auto compileObject = [&](const std::filesystem::path& inputPath, size_t index) -> CommandResult
+                    {
+                        std::filesystem::path objectPath = buildObjectPath(inputPath, index);
+                        objectFiles.push_back(objectPath);
+                        return runCommandCaptureOutput(makeCompileCommand(inputPath, objectPath), { backendCompilerPath.parent_path() });
                     };
 
-                    CommandResult compileResult = compileObject(cppPath, 0);
+                    CommandResult compileResult;
+                    if (splitCpp)
+                    {
+                        SplitCompileResult unitResult = compileSplitUnits(
+                            unitSources, generatedUnits.header, makeCompileCommand, backendCompilerPath, gAppData.backendJobs);
+                        objectFiles = std::move(unitResult.objects);
+                        if (unitResult.failure)
+                            compileResult = std::move(*unitResult.failure);
+                        else
+                            compileResult.exitCode = EXIT_SUCCESS;
+                        WIO_LOG_INFO("Compiled {} of {} translation units.", unitResult.compiledCount, unitSources.size());
+                    }
+                    else
+                    {
+                        compileResult = compileObject(cppPath, 0);
+                    }
                     exitCode = compileResult.exitCode;
                     if (exitCode == 0)
                     {
@@ -3062,6 +3594,52 @@ namespace wio
                 else
                 {
                     const std::filesystem::path stagingOutputPath = makeBackendStagingPath(outputPath);
+
+                    // Every flag that can change how the prelude compiles; -pthread
+                    // counts because it defines _REENTRANT.
+                    std::vector<std::string> preludeFlags{ "-std=c++20" };
+#ifndef _WIN32
+                    if (gAppData.buildTarget == BuildTarget::SharedLibrary)
+                        preludeFlags.emplace_back("-fPIC");
+                    preludeFlags.emplace_back("-pthread");
+#endif
+                    for (const auto& backendArg : backendArgs)
+                    {
+                        if (!isSourceFilePath(backendArg))
+                            preludeFlags.push_back(backendArg);
+                    }
+                    const std::filesystem::path preludeDir = preparePrecompiledPrelude(
+                        backendCompilerPath, preludeFlags, systemIncludeDirs, includeDirs, runtimeIncludeDir);
+
+                    std::vector<std::filesystem::path> unitObjects;
+                    if (splitCpp)
+                    {
+                        auto makeCompileCommand = [&](const std::filesystem::path& inputPath, const std::filesystem::path& objectPath)
+                        {
+                            std::stringstream compileCmd;
+                            compileCmd << quoteCommand(backendCompiler);
+                            appendBackendArguments(compileCmd, preludeFlags);
+                            compileCmd << " -c " << quotePath(inputPath);
+                            if (!preludeDir.empty())
+                                compileCmd << " -I" << quotePath(preludeDir);
+                            appendIncludeDirectories(compileCmd, systemIncludeDirs);
+                            appendIncludeDirectories(compileCmd, includeDirs);
+                            compileCmd << " -o " << quotePath(objectPath);
+                            return compileCmd.str();
+                        };
+
+                        SplitCompileResult unitResult = compileSplitUnits(
+                            unitSources, generatedUnits.header, makeCompileCommand, backendCompilerPath, gAppData.backendJobs);
+                        if (unitResult.failure)
+                        {
+                            reportBackendCommandFailure("Backend compilation failed", unitResult.failure->exitCode,
+                                                        unitResult.failure->output, unitResult.failure->command);
+                            return EXIT_FAILURE;
+                        }
+                        WIO_LOG_INFO("Compiled {} of {} translation units.", unitResult.compiledCount, unitSources.size());
+                        unitObjects = std::move(unitResult.objects);
+                    }
+
                     std::stringstream cmd;
                     cmd << quoteCommand(backendCompiler);
                     cmd << " -std=c++20 ";
@@ -3079,7 +3657,17 @@ namespace wio
                         cmd << "-static ";
 #endif
 
-                    cmd << quotePath(cppPath);
+                    if (splitCpp)
+                    {
+                        for (size_t i = 0; i < unitObjects.size(); ++i)
+                            cmd << (i == 0 ? "" : " ") << quotePath(unitObjects[i]);
+                    }
+                    else
+                    {
+                        cmd << quotePath(cppPath);
+                    }
+                    if (!preludeDir.empty())
+                        cmd << " -I" << quotePath(preludeDir);
                     appendIncludeDirectories(cmd, systemIncludeDirs);
                     appendIncludeDirectories(cmd, includeDirs);
                     appendBackendArguments(cmd, backendArgs);
@@ -3239,8 +3827,7 @@ namespace wio
         }
         filesystem::stripBOM(source);
 
-        Lexer lexer(source, actualPath.string());
-        Parser parser(lexer.lex());
+        Parser parser(gAppData.tokenCache.lex(source, actualPath.string()));
         auto subProgram = parser.parseProgram();
         // A recovered parser error leaves a deliberately incomplete AST. Do not
         // merge that tree into the importing program: semantic analysis would
@@ -7,11 +7,14 @@
 #include "wio/common/logger.h"
 #include "wio/sema/symbol.h"
 
+#include <cctype>
 #include <cstddef>
 #include <cstdint>
+#include <filesystem>
 #include <functional>
 #include <limits>
 #include <optional>
+#include <string_view>
 #include <unordered_set>
 #include <utility>
 
@@ -21,6 +24,25 @@ namespace wio::codegen
 {
     namespace 
     {
+        // First line of generated code that is not blank or a preprocessor
+        // directive, without its indentation; empty when there is none.
+        std::string_view firstCodeLine(std::string_view code)
+        {
+            size_t lineStart = 0;
+            while (lineStart < code.size())
+            {
+                size_t lineEnd = code.find('\n', lineStart);
+                if (lineEnd == std::string_view::npos)
+                    lineEnd = code.size();
+                const std::string_view line = code.substr(lineStart, lineEnd - lineStart);
+                const size_t firstCharacter = line.find_first_not_of(" \t\r");
+                if (firstCharacter != std::string_view::npos && line[firstCharacter] != '#')
+                    return line.substr(firstCharacter);
+                lineStart = lineEnd + 1;
+            }
+            return {};
+        }
+
         bool isCppReservedIdentifier(std::string_view identifier)
         {
             static const std::unordered_set<std::string_view> reservedIdentifiers = {
@@ -89,7 +111,7 @@ namespace wio::codegen
                 return "typename _wio_missing";
 
             const std::string backendName = sanitizeCppIdentifier(
-                nameOverride.empty() ? parameter->token.value : nameOverride);
+                nameOverride.empty() ? parameter->token.value.view() : nameOverride);
 
             if (parameter->isConstGenericParameter)
             {
@@ -379,6 +401,15 @@ namespace wio::codegen
             return key;
         }
 
+        // Rewrites a lowered `std::function<Sig>` into the matching non-owning view.
+        std::string toFunctionRefCppType(const std::string& functionCppType)
+        {
+            constexpr std::string_view ownedPrefix = "std::function<";
+            if (!functionCppType.starts_with(ownedPrefix))
+                return functionCppType;
+            return "wio::runtime::FunctionRef<" + functionCppType.substr(ownedPrefix.size());
+        }
+
         std::string toCppType(const Ref<sema::Type>& type)
         {
             if (!type) return "void"; // Fallback
@@ -1661,6 +1692,8 @@ namespace wio::codegen
                 return "TreeFloorKeyOr";
             case IntrinsicMember::TreeCeilKeyOr:
                 return "TreeCeilKeyOr";
+            case IntrinsicMember::TreeScanRange:
+                return "TreeScanRange";
             case IntrinsicMember::StringContains:
                 return "StringContains";
             case IntrinsicMember::StringContainsChar:
@@ -3105,6 +3138,134 @@ namespace wio::codegen
             emit(")");
     }
 
+    bool CppGenerator::isStringConcatenation(BinaryExpression& node) const
+    {
+        if (node.op.type != TokenType::opPlus || !node.left || !node.right)
+            return false;
+
+        if (auto operatorSymbol = node.referencedSymbol.Lock();
+            operatorSymbol &&
+            common::isOperatorOverloadName(operatorSymbol->name) &&
+            node.operatorDispatchKind != OperatorDispatchKind::None)
+        {
+            return false;
+        }
+
+        const auto isStringPrimitive = [](const Ref<sema::Type>& type)
+        {
+            return type && type->kind() == sema::TypeKind::Primitive &&
+                   type.AsFast<sema::PrimitiveType>()->name == "string";
+        };
+        return isStringPrimitive(unwrapAliasTypeForCodegen(node.left->refType.Lock())) &&
+               isStringPrimitive(unwrapAliasTypeForCodegen(node.right->refType.Lock()));
+    }
+
+    void CppGenerator::collectConcatPieces(const NodePtr<Expression>& expression,
+                                           const bool isInterpolated,
+                                           std::vector<ConcatPiece>& pieces)
+    {
+        if (auto literal = expression.As<StringLiteral>())
+        {
+            if (literal->token.value.empty())
+                return;
+
+            const std::string text = common::wioStringToEscapedCppString(literal->token.value);
+            if (!pieces.empty() && pieces.back().isLiteral)
+                pieces.back().literal += text;
+            else
+                pieces.push_back({ nullptr, text, true, false });
+            return;
+        }
+
+        // Nested chains and plain interpolations join the enclosing call
+        // instead of building their own temporary string.
+        if (auto binary = expression.As<BinaryExpression>(); binary && isStringConcatenation(*binary))
+        {
+            collectConcatPieces(binary->left, false, pieces);
+            collectConcatPieces(binary->right, false, pieces);
+            return;
+        }
+
+        if (auto interpolated = expression.As<InterpolatedStringLiteral>(); interpolated && !interpolated->isUnicode)
+        {
+            for (const auto& part : interpolated->parts)
+                collectConcatPieces(part, true, pieces);
+            return;
+        }
+
+        pieces.push_back({ expression, {}, false, isInterpolated });
+    }
+
+    void CppGenerator::emitConcat(const std::vector<ConcatPiece>& pieces)
+    {
+        emit("wio::runtime::Concat(");
+        for (std::size_t index = 0; index < pieces.size(); ++index)
+        {
+            const auto& piece = pieces[index];
+            if (index > 0)
+                emit(", ");
+
+            if (piece.isLiteral)
+            {
+                emit("\"" + piece.literal + "\"");
+            }
+            else if (piece.isInterpolated)
+            {
+                int derefCount = 0;
+                Ref<sema::Type> currentType = piece.expression->refType.Lock();
+                while (currentType && currentType->kind() == sema::TypeKind::Reference)
+                {
+                    derefCount++;
+                    currentType = currentType.AsFast<sema::ReferenceType>()->referredType;
+                }
+
+                for (int i = 0; i < derefCount; ++i) emit("*(");
+                piece.expression->accept(*this);
+                for (int i = 0; i < derefCount; ++i) emit(")");
+            }
+            else
+            {
+                emitReadableExpression(piece.expression);
+            }
+        }
+        emit(")");
+    }
+
+    bool CppGenerator::argumentMayChangeDuringCall(const FunctionCallExpression& node, size_t index) const
+    {
+        auto isReferenceType = [](const Ref<sema::Type>& type)
+        {
+            Ref<sema::Type> resolved = unwrapAliasTypeForCodegen(type);
+            return resolved && resolved->kind() == sema::TypeKind::Reference;
+        };
+
+        // Literals and operator results are fresh temporaries nothing else
+        // can reach.
+        const auto& argument = node.arguments[index];
+        if (!argument || argument->is<StringLiteral>() || argument->is<InterpolatedStringLiteral>() ||
+            argument->is<ArrayLiteral>() || argument->is<DictionaryLiteral>() || argument->is<BinaryExpression>())
+            return false;
+
+        // A `ref` argument lets the callee write storage that any other
+        // argument of the same call may share.
+        for (const auto& other : node.arguments)
+        {
+            if (other && (other->is<RefExpression>() || isReferenceType(other->refType.Lock())))
+                return true;
+        }
+
+        if (!argument->is<Identifier>())
+            return true;
+
+        // Parameters and function-body locals own their storage. Globals,
+        // fields, loop bindings and references may view storage the callee
+        // can reach and change.
+        auto symbol = argument->referencedSymbol.Lock();
+        if (!symbol || symbol->flags.get_isGlobal() || isReferenceType(symbol->type))
+            return true;
+        return symbol->kind != sema::SymbolKind::Parameter && !ownedLocalSymbols_.contains(symbol.Get());
+    }
+
     void CppGenerator::emitExpressionWithExpectedType(const NodePtr<Expression>& expression,
                                                       const Ref<sema::Type>& expectedType,
                                                       const bool allowAutoRef)
@@ -3301,9 +3462,115 @@ namespace wio::codegen
         program->accept(*this);
         emitModuleApiTable(program);
 
+        if (splitUnits_)
+        {
+            // emitStatements already moved declarations and definitions out of
+            // buffer_; only the module API table is left for the first unit.
+            splitUnits_->header = "#pragma once\n\n" + header_.str() + splitUnits_->header;
+            splitUnitFor({}) += buffer_.str();
+            buffer_.str("");
+            return {};
+        }
+
         return header_.str() + buffer_.str();
     }
 
+    GeneratedUnits CppGenerator::generateUnits(const Ref<Program>& program, const std::string& headerName)
+    {
+        GeneratedUnits units;
+        splitUnits_ = &units;
+        splitHeaderName_ = headerName;
+        splitUnitsByFile_.clear();
+        splitUnitFor({});
+
+        try
+        {
+            generate(program);
+        }
+        catch (...)
+        {
+            splitUnits_ = nullptr;
+            throw;
+        }
+
+        splitUnits_ = nullptr;
+
+        // A unit holding only directives would just recompile the shared
+        // header, which is the expensive part of every unit.
+        GeneratedUnit fallback = units.units.front();
+        std::erase_if(units.units, [](const GeneratedUnit& unit) { return firstCodeLine(unit.code).empty(); });
+        if (units.units.empty())
+            units.units.push_back(std::move(fallback));
+        return units;
+    }
+
+    std::string& CppGenerator::splitUnitFor(const std::string& sourceFile)
+    {
+        auto [it, inserted] = splitUnitsByFile_.try_emplace(sourceFile, splitUnits_->units.size());
+        if (inserted)
+        {
+            std::string name = sourceFile.empty() ? "program" : std::filesystem::path(sourceFile).stem().string();
+            for (char& ch : name)
+            {
+                if (!std::isalnum(static_cast<unsigned char>(ch)))
+                    ch = '_';
+            }
+            splitUnits_->units.push_back({ std::move(name), "#include \"" + splitHeaderName_ + "\"\n\n" });
+        }
+        return splitUnits_->units[it->second].code;
+    }
+
+    void CppGenerator::emitSplitDefinition(const NodePtr<Statement>& statement)
+    {
+        // A template body must be visible wherever it is instantiated, so it
+        // goes to the shared header. Everything after definitionTailStart_
+        // (export wrappers, explicit instantiations, main) and every ordinary
+        // function goes to the unit of the file that declared it.
+        auto route = [&](const NodePtr<Statement>& definition)
+        {
+            buffer_.str("");
+            definitionTailStart_ = -1;
+            definition->accept(*this);
+            const std::string text = buffer_.str();
+            buffer_.str("");
+
+            const size_t tailStart = definitionTailStart_ < 0
+                ? text.size()
+                : std::min(text.size(), static_cast<size_t>(definitionTailStart_));
+            definitionTailStart_ = -1;
+
+            const std::string_view body(text.data(), tailStart);
+            const bool isTemplate = firstCodeLine(body).starts_with("template");
+
+            std::string& unit = splitUnitFor(definition->location().file);
+            if (isTemplate)
+            {
+                splitUnits_->header.append(body);
+                unit.append(text, tailStart, std::string::npos);
+            }
+            else
+            {
+                unit += text;
+            }
+        };
+
+        if (statement->is<ExtensionDeclaration>())
+        {
+            auto extension = statement->as<ExtensionDeclaration>();
+            const bool previousExtensionMethod = currentExtensionMethod_;
+            currentExtensionMethod_ = true;
+            for (auto& member : extension->members)
+            {
+                if (member.method && member.method->name->referencedSymbol.Lock())
+                    route(member.method);
+            }
+            currentExtensionMethod_ = previousExtensionMethod;
+            return;
+        }
+
+        route(statement);
+    }
+
     void CppGenerator::generateHeader()
     {
         header_.str("");
@@ -3314,33 +3581,9 @@ namespace wio::codegen
         emitHeaderLine("// Source-level diagnostics are remapped back to .wio files through #line");
         emitHeaderLine("// directives, so backend failures should still point to Wio locations.");
         emitHeaderLine();
-        emitHeaderLine("#include <cstdint>");
-        emitHeaderLine("#include <cstddef>");
-        emitHeaderLine("#include <algorithm>");
-        emitHeaderLine("#include <limits>");
-        emitHeaderLine("#include <string>");
-        emitHeaderLine("#include <utility>");
-        emitHeaderLine("#include <vector>");
-        emitHeaderLine("#include <array>");
-        emitHeaderLine("#include \"format.h\"");
-        emitHeaderLine("#include <iostream>");
-        emitHeaderLine("#include <functional>");
-        emitHeaderLine("#include <map>");
-        emitHeaderLine("#include <stdexcept>");
-        emitHeaderLine("#include <unordered_map>");
-        emitHeaderLine();
-        emitHeaderLine("#include <exception.h>");
-        emitHeaderLine("#include <constant_value.h>");
-        emitHeaderLine("#include <any.h>");
-        emitHeaderLine("#include <enum_reflection.h>");
-        emitHeaderLine("#include <type_reflection.h>");
-        emitHeaderLine("#include <fit.h>");
-        emitHeaderLine("#include <intrinsics.h>");
-        emitHeaderLine("#include <meta.h>");
-        emitHeaderLine("#include <module_api.h>");
-        emitHeaderLine("#include <ref.h>");
-        emitHeaderLine("#include <std_async.h>");
-        emitHeaderLine("#include <text.h>");
+        // Must stay the first include: the backend may replace it with a
+        // precompiled header, which GCC only honours before any other code.
+        emitHeaderLine("#include <wio_prelude.h>");
         emitHeaderLine();
         emitHeaderLine("namespace wio::runtime");
         emitHeaderLine("{");
@@ -3371,10 +3614,10 @@ namespace wio::codegen
         emitHeaderLine("using SArray = std::array<T, N>;");
         emitHeaderLine();
         emitHeaderLine("template <typename K, typename V>");
-        emitHeaderLine("using Dict = std::unordered_map<K, V>;");
+        emitHeaderLine("using Dict = FlatHashMap<K, V>;");
         emitHeaderLine();
         emitHeaderLine("template <typename K, typename V>");
-        emitHeaderLine("using Tree = std::map<K, V>;");
+        emitHeaderLine("using Tree = BTreeMap<K, V>;");
         dedent();
         emitHeaderLine("}");
         emitHeaderLine();
@@ -3870,8 +4113,8 @@ namespace wio::codegen
                 if (const auto* realmDecl = stmt->as<RealmDeclaration>())
                 {
                     const std::string nextScopePath = scopePath.empty()
-                        ? realmDecl->name->token.value
-                        : common::formatString("{}::{}", scopePath, realmDecl->name->token.value);
+                        ? realmDecl->name->token.value.str()
+                        : common::formatString("{}::{}", scopePath, realmDecl->name->token.value.str());
                     collectEnumLikeDeclarations(realmDecl->statements, nextScopePath);
                     continue;
                 }
@@ -3879,8 +4122,8 @@ namespace wio::codegen
                 if (const auto* enumDecl = stmt->as<EnumDeclaration>())
                 {
                     const std::string logicalName = scopePath.empty()
-                        ? enumDecl->name->token.value
-                        : common::formatString("{}::{}", scopePath, enumDecl->name->token.value);
+                        ? enumDecl->name->token.value.str()
+                        : common::formatString("{}::{}", scopePath, enumDecl->name->token.value.str());
                     enumDeclarationsByLogicalName.emplace(logicalName, enumDecl);
                     continue;
                 }
@@ -3888,8 +4131,8 @@ namespace wio::codegen
                 if (const auto* flagsetDecl = stmt->as<FlagsetDeclaration>())
                 {
                     const std::string logicalName = scopePath.empty()
-                        ? flagsetDecl->name->token.value
-                        : common::formatString("{}::{}", scopePath, flagsetDecl->name->token.value);
+                        ? flagsetDecl->name->token.value.str()
+                        : common::formatString("{}::{}", scopePath, flagsetDecl->name->token.value.str());
                     flagsetDeclarationsByLogicalName.emplace(logicalName, flagsetDecl);
                 }
             }
@@ -4826,8 +5069,8 @@ namespace wio::codegen
             emitSimpleTypeReflectionSpecialization(
                 enumName,
                 sym && !sym->scopePath.empty()
-                    ? sym->scopePath + "::" + declaration.name->token.value
-                    : declaration.name->token.value,
+                    ? sym->scopePath + "::" + declaration.name->token.value.str()
+                    : declaration.name->token.value.str(),
                 "enum_type");
         };
 
@@ -4927,8 +5170,8 @@ namespace wio::codegen
             emitSimpleTypeReflectionSpecialization(
                 flagsetName,
                 sym && !sym->scopePath.empty()
-                    ? sym->scopePath + "::" + declaration.name->token.value
-                    : declaration.name->token.value,
+                    ? sym->scopePath + "::" + declaration.name->token.value.str()
+                    : declaration.name->token.value.str(),
                 "flagset_type");
         };
 
@@ -5549,6 +5792,14 @@ namespace wio::codegen
             }
         });
 
+        // Everything above declares; everything below defines. A split build
+        // shares the declarations through its header.
+        if (splitUnits_)
+        {
+            splitUnits_->header += buffer_.str();
+            buffer_.str("");
+        }
+
         emitPhase(emitPhase, statements, [&](const auto& stmt)
         {
             if (stmt->template is<VariableDeclaration>())
@@ -5559,11 +5810,20 @@ namespace wio::codegen
             }
         });
 
+        if (splitUnits_)
+        {
+            splitUnitFor({}) += buffer_.str();
+            buffer_.str("");
+        }
+
         emitPhase(emitPhase, statements, [&](const auto& stmt)
         {
-            if (stmt->template is<FunctionDeclaration>())
-                stmt->accept(*this);
-            else if (stmt->template is<ExtensionDeclaration>())
+            if (!stmt->template is<FunctionDeclaration>() && !stmt->template is<ExtensionDeclaration>())
+                return;
+
+            if (splitUnits_)
+                emitSplitDefinition(stmt);
+            else
                 stmt->accept(*this);
         });
     }
@@ -5862,6 +6122,15 @@ namespace wio::codegen
             node.op.type == TokenType::opLessEqual ||
             node.op.type == TokenType::opGreater ||
             node.op.type == TokenType::opGreaterEqual;
+        if (isStringConcatenation(node))
+        {
+            std::vector<ConcatPiece> pieces;
+            collectConcatPieces(node.left, false, pieces);
+            collectConcatPieces(node.right, false, pieces);
+            emitConcat(pieces);
+            return;
+        }
+
         if (isStringBinaryOperator &&
             isStringPrimitive(textualLeftType) &&
             isStringPrimitive(textualRightType))
@@ -6341,47 +6610,13 @@ namespace wio::codegen
             return;
         }
 
-        std::string formatString;
-        std::vector<Ref<Expression>> arguments;
-
-        for (auto& part : node.parts)
-        {
-            if (auto strLiteral = part.As<StringLiteral>()) 
-            {
-                formatString += common::wioStringToEscapedCppString(strLiteral->token.value);
-            }
-            else 
-            {
-                formatString += "{}";
-                arguments.push_back(part);
-            }
-        }
+        std::vector<ConcatPiece> pieces;
+        for (const auto& part : node.parts)
+            collectConcatPieces(part, true, pieces);
 
         if (node.isUnicode)
             emit("wio::runtime::Text::FromUtf8(");
-        emit("wio::runtime::Format(\"" + formatString + "\"");
-
-        for (auto& arg : arguments)
-        {
-            emit(", ");
-        
-            int derefCount = 0;
-            Ref<sema::Type> currentType = arg->refType.Lock();
-        
-            while (currentType && currentType->kind() == sema::TypeKind::Reference)
-            {
-                derefCount++;
-                currentType = currentType.AsFast<sema::ReferenceType>()->referredType;
-            }
-
-            for (int i = 0; i < derefCount; ++i) emit("*(");
-        
-            arg->accept(*this);
-        
-            for (int i = 0; i < derefCount; ++i) emit(")");
-        }
-    
-        emit(")");
+        emitConcat(pieces);
         if (node.isUnicode)
             emit(")");
     }
@@ -7458,7 +7693,10 @@ namespace wio::codegen
             beginResultUnwrap();
             if (structType->isObject)
             {
-                emit("wio::runtime::Ref<" + mangleStructTypeName(structType) + ">::Create(");
+                if (node.allocatesOnStack)
+                    emit("wio::runtime::StackObject<" + mangleStructTypeName(structType) + ">(");
+                else
+                    emit("wio::runtime::Ref<" + mangleStructTypeName(structType) + ">::Create(");
             }
             else
             {
@@ -7618,10 +7856,42 @@ namespace wio::codegen
             if (functionType && i < functionType->paramTypes.size())
                 expectedType = functionType->paramTypes[i];
 
+            // Bind call-only callbacks as a view over the argument, which
+            // lives until the end of the full call expression. The explicit
+            // view type also keeps generic parameters deducible.
+            const bool bindsFunctionRef =
+                shouldEmitDirectFunctionCallee && !emittedExtensionReceiver && expectedType &&
+                i < calleeSym->functionRefParameters.size() && calleeSym->functionRefParameters[i];
+            // A const-reference parameter must not observe its argument
+            // changing while the callee runs, so such arguments get a copy.
+            const bool needsOwnedArgument =
+                shouldEmitDirectFunctionCallee && !emittedExtensionReceiver &&
+                i < calleeSym->constRefParameters.size() && calleeSym->constRefParameters[i] &&
+                argumentMayChangeDuringCall(node, i);
+
             if (node.arguments[i] && node.arguments[i]->is<PackExpansionExpression>())
+            {
                 node.arguments[i]->accept(*this);
+            }
+            else if (bindsFunctionRef)
+            {
+                emit(toFunctionRefCppType(toCppType(expectedType)) + "(");
+                if (node.arguments[i]->is<LambdaExpression>())
+                    node.arguments[i]->accept(*this);
+                else
+                    emitExpressionWithExpectedType(node.arguments[i], expectedType, false);
+                emit(")");
+            }
+            else if (needsOwnedArgument)
+            {
+                emit("wio::runtime::OwnedArgument(");
+                emitExpressionWithExpectedType(node.arguments[i], expectedType, false);
+                emit(")");
+            }
             else
+            {
                 emitExpressionWithExpectedType(node.arguments[i], expectedType, false);
+            }
         }
         emit(")");
         endResultUnwrap();
@@ -8056,6 +8326,8 @@ namespace wio::codegen
     {
         emitSourceDirective(node.location());
         auto sym = node.name->referencedSymbol.Lock();
+        if (sym && currentFunctionReturnType_ && !sym->flags.get_isGlobal())
+            ownedLocalSymbols_.insert(sym.Get());
 
         Ref<sema::Type> varType = (sym && sym->type) ? sym->type : node.name->refType.Lock();
         std::string typeStr = toCppType(varType);
@@ -8082,6 +8354,12 @@ namespace wio::codegen
         if (typeStr.empty())
             typeStr = "auto";
 
+        // The initializer already names the StackObject<T> it builds.
+        const auto* objectConstruction = node.initializer ? node.initializer->as<FunctionCallExpression>() : nullptr;
+        const bool allocatesOnStack = objectConstruction && objectConstruction->allocatesOnStack;
+        if (allocatesOnStack)
+            typeStr = "auto";
+
         std::string prefix;
         std::string suffix;
 
@@ -8140,7 +8418,12 @@ namespace wio::codegen
 
         buffer_ << ((sym && sym->flags.get_isGlobal()) ? Mangler::mangleGlobalVar(varName, sym->scopePath) : varName);
         
-        if (node.initializer)
+        if (allocatesOnStack)
+        {
+            buffer_ << " = ";
+            node.initializer->accept(*this);
+        }
+        else if (node.initializer)
         {
             buffer_ << " = ";
             emitExpressionWithExpectedType(node.initializer, varType, false);
@@ -8159,7 +8442,7 @@ namespace wio::codegen
     {
         emitSourceDirective(node.location());
         auto sym = node.name->referencedSymbol.Lock();
-        const std::string aliasName = sym ? Mangler::mangleStruct(sym->name, sym->scopePath) : node.name->token.value;
+        const std::string aliasName = sym ? Mangler::mangleStruct(sym->name, sym->scopePath) : node.name->token.value.str();
 
         if (!node.genericParameters.empty())
         {
@@ -8227,6 +8510,20 @@ namespace wio::codegen
             return instantiateGenericType(funcType, bindings).AsFast<sema::FunctionType>();
         };
 
+        // Free functions take read-only string, array, and dictionary
+        // parameters by const reference and call-only callbacks as function
+        // views; see Parameter::passByConstRef and Symbol::functionRefParameters.
+        auto formatParameterCppType = [&](size_t parameterIndex, std::string cppType) -> std::string
+        {
+            if (!currentClassName_.empty() || parameterIndex >= node.parameters.size())
+                return cppType;
+            if (sym && parameterIndex < sym->functionRefParameters.size() && sym->functionRefParameters[parameterIndex])
+                return toFunctionRefCppType(cppType);
+            if (node.parameters[parameterIndex].passByConstRef)
+                return "const " + cppType + "&";
+            return cppType;
+        };
+
         auto emitTemplateSpecializationArguments = [&](const std::vector<Ref<sema::Type>>& instantiationTypes)
         {
             emit(formatTemplateArgumentList(instantiationTypes));
@@ -8262,7 +8559,7 @@ namespace wio::codegen
             emit("(");
             for (size_t i = 0; i < instantiatedFunctionType->paramTypes.size(); ++i)
             {
-                emit(toCppType(instantiatedFunctionType->paramTypes[i]));
+                emit(formatParameterCppType(i, toCppType(instantiatedFunctionType->paramTypes[i])));
                 if (i + 1 < instantiatedFunctionType->paramTypes.size())
                     emit(", ");
             }
@@ -8291,7 +8588,7 @@ namespace wio::codegen
             {
                 emit(common::formatString(
                     "{} {}",
-                    toCppType(funcType->paramTypes[i]),
+                    formatParameterCppType(i, toCppType(funcType->paramTypes[i])),
                     sanitizeCppIdentifier(node.parameters[i].name->token.value)
                 ));
                 if (i + 1 < providedFixedParameterCount || funcType->hasParameterPack)
@@ -8457,6 +8754,8 @@ namespace wio::codegen
                 std::string parameterType = toCppType(param.name->refType.Lock());
                 if (param.isParameterPack && parameterType.ends_with("..."))
                     parameterType = parameterType.substr(0, parameterType.size() - 3) + "...";
+                else
+                    parameterType = formatParameterCppType(i, std::move(parameterType));
                 emit(common::formatString("{} {}", parameterType, sanitizeCppIdentifier(param.name->token.value)));
                 if (isEmittingPrototypes_ && funcType && funcType->hasParameterPack && param.defaultValue && !param.isParameterPack)
                 {
@@ -9167,6 +9466,9 @@ namespace wio::codegen
 
         emitDefaultArgumentWrappers();
 
+        if (!isEmittingPrototypes_ && currentClassName_.empty())
+            definitionTailStart_ = static_cast<std::streamoff>(buffer_.tellp());
+
         if (emitsExportWrapper && !isEmittingPrototypes_ && currentClassName_.empty() && node.body)
         {
             emitGeneratedDirective();
@@ -9390,7 +9692,7 @@ namespace wio::codegen
 
         std::string structName = mangleStructTypeName(componentType);
         const std::string declaredClassName = Mangler::mangleStruct(
-            componentType ? componentType->name : node.name->token.value,
+            componentType ? componentType->name : node.name->token.value.str(),
             componentType ? componentType->scopePath : ""
         );
         if (componentType && usesNativePodAliasModelForCodegen(componentType))
@@ -9614,7 +9916,7 @@ namespace wio::codegen
         }
         std::string structName = mangleStructTypeName(objectType);
         const std::string declaredClassName = Mangler::mangleStruct(
-            objectType ? objectType->name : node.name->token.value,
+            objectType ? objectType->name : node.name->token.value.str(),
             objectType ? objectType->scopePath : ""
         );
         emit("struct " + structName); 
@@ -9724,6 +10026,7 @@ namespace wio::codegen
             objectRefFriend += ">";
         }
         emitLine("friend class wio::runtime::Ref<" + objectRefFriend + ">;");
+        emitLine("friend class wio::runtime::StackObject<" + objectRefFriend + ">;");
         auto trustArgs = getAttributeArgs(node.attributes, Attribute::Trust);
         for (const auto& t : trustArgs)
         {
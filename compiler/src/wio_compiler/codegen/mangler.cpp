@@ -9,66 +9,75 @@ namespace wio::codegen
     {
         if (!type) return "unknown";
         std::string typeStr = type->toString();
-        
-        std::ranges::replace(typeStr, ' ', '_');
-        std::ranges::replace(typeStr, '[', 'A');
-        std::ranges::replace(typeStr, ']', 'E');
-        std::ranges::replace(typeStr, ';', 'S');
-        std::ranges::replace(typeStr, '*', 'P');
-        std::ranges::replace(typeStr, '&', 'R');
 
-        std::ranges::replace(typeStr, '(', '_');
-        std::ranges::replace(typeStr, ')', '_');
-        std::ranges::replace(typeStr, ',', '_');
-        std::ranges::replace(typeStr, '<', '_');
-        std::ranges::replace(typeStr, '-', '_');
-        std::ranges::replace(typeStr, '>', '_');
-        std::ranges::replace(typeStr, '.', '_');
-        std::ranges::replace(typeStr, ':', '_');
-        std::ranges::replace(typeStr, '?', 'N');
+        for (char& c : typeStr)
+        {
+            switch (c)
+            {
+            case '[': c = 'A'; break;
+            case ']': c = 'E'; break;
+            case ';': c = 'S'; break;
+            case '*': c = 'P'; break;
+            case '&': c = 'R'; break;
+            case '?': c = 'N'; break;
+            case ' ': case '(': case ')': case ',': case '<':
+            case '-': case '>': case '.': case ':':
+                c = '_';
+                break;
+            default:
+                break;
+            }
+        }
         
         return typeStr;
     }
 
-    std::string Mangler::mangleInterface(const std::string& name, const std::string& scopePath)
+    namespace
     {
-        std::string mangled = "_WI_"; // Wio Interface
-        if (!scopePath.empty()) mangled += scopePath + "_";
-        mangled += name;
-        return mangled;
+        std::string mangleWithPrefix(std::string_view prefix, std::string_view scopePath, std::string_view name)
+        {
+            std::string mangled;
+            mangled.reserve(prefix.size() + scopePath.size() + 1 + name.size());
+            mangled += prefix;
+            if (!scopePath.empty())
+            {
+                mangled += scopePath;
+                mangled += '_';
+            }
+            mangled += name;
+            return mangled;
+        }
     }
 
-    std::string Mangler::mangleFunction(const std::string& name, const std::vector<Ref<sema::Type>>& paramTypes, const std::string& scopePath)
+    std::string Mangler::mangleInterface(std::string_view name, std::string_view scopePath)
+    {
+        return mangleWithPrefix("_WI_", scopePath, name); // Wio Interface
+    }
+
+    std::string Mangler::mangleFunction(std::string_view name, const std::vector<Ref<sema::Type>>& paramTypes, std::string_view scopePath)
     {
         if (name == "main" && scopePath.empty()) return "main";
 
-        std::string mangled = "_WF_"; // Wio Function
-        if (!scopePath.empty()) mangled += scopePath + "_";
-        mangled += name;
+        std::string mangled = mangleWithPrefix("_WF_", scopePath, name); // Wio Function
         
         for (const auto& type : paramTypes)
         {
-            mangled += "_" + mangleType(type);
+            mangled += '_';
+            mangled += mangleType(type);
         }
         
         return mangled;
     }
 
-    std::string Mangler::mangleStruct(const std::string& name, const std::string& scopePath)
+    std::string Mangler::mangleStruct(std::string_view name, std::string_view scopePath)
     {
         if (name == "object") return "wio::runtime::RefCountedObject";
         
-        std::string mangled = "_WS_"; // Wio Struct
-        if (!scopePath.empty()) mangled += scopePath + "_";
-        mangled += name;
-        return mangled;
+        return mangleWithPrefix("_WS_", scopePath, name); // Wio Struct
     }
 
-    std::string Mangler::mangleGlobalVar(const std::string& name, const std::string& scopePath)
+    std::string Mangler::mangleGlobalVar(std::string_view name, std::string_view scopePath)
     {
-        std::string mangled = "_WG_"; // Wio Global Variable
-        if (!scopePath.empty()) mangled += scopePath + "_";
-        mangled += name;
-        return mangled;
+        return mangleWithPrefix("_WG_", scopePath, name); // Wio Global Variable
     }
 }
@@ -0,0 +1,78 @@
+#include "wio/common/name.h"
+
+#include <array>
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+
+namespace wio::common
+{
+    namespace
+    {
+        struct NameTable
+        {
+            std::mutex mutex;
+            // Entries never move once created, so the index keys can view
+            // their text and every Name can hold a plain pointer.
+            std::deque<Name::Entry> entries;
+            std::unordered_map<std::string_view, const Name::Entry*> index;
+        };
+
+        // Per-thread direct-mapped cache in front of the shared table. Source
+        // text repeats the same few identifiers, so most lookups hit here and
+        // never take the table lock.
+        struct RecentNames
+        {
+            static constexpr std::size_t kSlots = 1024;
+            std::array<const Name::Entry*, kSlots> slots{};
+        };
+
+        std::size_t hashText(const std::string_view text)
+        {
+            std::size_t hash = 14695981039346656037ull;
+            for (const char ch : text)
+            {
+                hash ^= static_cast<unsigned char>(ch);
+                hash *= 1099511628211ull;
+            }
+            return hash;
+        }
+
+        NameTable& table()
+        {
+            // Names are held by statics destroyed in unspecified order, so
+            // the table is intentionally never torn down.
+            static auto* instance = new NameTable();
+            return *instance;
+        }
+    }
+
+    const Name::Entry* Name::intern(const std::string_view text)
+    {
+        if (text.empty())
+            return &kEmptyNameEntry;
+
+        thread_local RecentNames recent;
+        const Entry*& slot = recent.slots[hashText(text) & (RecentNames::kSlots - 1)];
+        if (slot && slot->text == text)
+            return slot;
+
+        auto& names = table();
+        std::lock_guard lock(names.mutex);
+        if (const auto it = names.index.find(text); it != names.index.end())
+            return slot = it->second;
+
+        auto& entry = names.entries.emplace_back();
+        entry.text.assign(text);
+        entry.id = static_cast<std::uint32_t>(names.entries.size());
+        names.index.emplace(entry.text, &entry);
+        return slot = &entry;
+    }
+
+    std::size_t Name::InternedCount()
+    {
+        auto& names = table();
+        std::lock_guard lock(names.mutex);
+        return names.entries.size() + 1;
+    }
+}
@@ -0,0 +1,9 @@
+#include "wio/common/smart_ptr.h"
+
+namespace wio::common
+{
+    void RefCountedObject::DestroyInternal() const noexcept
+    {
+        delete this;
+    }
+}
@@ -2,6 +2,7 @@
 #include "wio/common/exception.h"
 #include "wio/common/utility.h"
 
+#include <array>
 #include <ranges>
 
 namespace
@@ -52,6 +53,7 @@ namespace wio
     {
         position_ = 0;
         tokens_.clear();
+        tokens_.reserve(source_.size() / 5 + 16);
         interpolationStack_.clear();
         flags_ = LexerFlags::createAllFalse();
         location_.line = 1;
@@ -112,7 +114,7 @@ namespace wio
             else if (isAtEnd())
             {
                 // It's probably not necessary, but it's okay to have it here for security reasons.
-                tokens_.emplace_back(TokenType::endOfFile, "eof", location_);
+                tokens_.push_back(Token{ .type = TokenType::endOfFile, .value = "eof", .loc = location_ });
                 break;
             }
             else
@@ -121,10 +123,10 @@ namespace wio
             }
         }
 
-        return tokens_;
+        return std::move(tokens_);
     }
 
-    std::string Lexer::toString() const
+    std::string Lexer::toString(const std::vector<Token>& tokens)
     {
         auto escapeForDebug = [](std::string_view s)
         {
@@ -163,7 +165,7 @@ namespace wio
 
         std::stringstream ss;
 
-        for (const auto& token : tokens_)
+        for (const auto& token : tokens)
         {
             const std::string typeStr{tokenTypeToString(token.type)};
 
@@ -301,68 +303,77 @@ namespace wio
     }
 
 
+    Token Lexer::makeToken(const TokenType type, const uint64_t begin, const Location& start) const
+    {
+        const std::string_view lexeme(source_.data() + begin, position_ - begin);
+        return Token{
+            .type = type,
+            .value = lexeme,
+            .loc = start,
+            .offset = static_cast<uint32_t>(begin),
+            .length = static_cast<uint32_t>(lexeme.size())
+        };
+    }
+
     Token Lexer::readIdentifier()
     {
         Location start = location_;
-        std::string result;
+        const uint64_t begin = position_;
 
         while (std::isalnum(upeek()) || match('_'))
-            result += advance();
+            advance();
 
         TokenType tType = TokenType::identifier;
         
-        if (auto it = keywordMap.find(result); it != keywordMap.end())
+        if (auto it = keywordMap.find(std::string_view(source_.data() + begin, position_ - begin)); it != keywordMap.end())
             tType = it->second;
         
-        return Token{
-            .type = tType,
-            .value = std::move(result),
-            .loc = start
-        };
+        return makeToken(tType, begin, start);
     }
     
     Token Lexer::readNumber()
     {
         Location start = location_;
-        std::string result;
+        const uint64_t begin = position_;
         bool isFloat = false;
 
         if (match('0'))
         {
-            result += advance();
+            advance();
             if (matchOneOf("bB"))
             {
-                result += advance();
+                advance();
                 if (!matchOneOf("01"))
                     throw InvalidNumberError("Invalid binary number!", location_);
 
                 while (matchOneOf("01"))
-                    result += advance();
+                    advance();
             }
             else if (matchOneOf("xX"))
             {
-                result += advance();
+                advance();
                 if (!std::isxdigit(upeek()))
                     throw InvalidNumberError("Invalid hexadecimal number!", location_);
 
                 while (std::isxdigit(upeek()))
-                    result += advance();
+                    advance();
             }
             else if (matchOneOf("oO"))
             {
-                result += advance();
+                advance();
                 if (!matchOneOf("01234567"))
                     throw InvalidNumberError("Invalid octal number!", location_);
 
                 while (matchOneOf("01234567"))
-                    result += advance();
+                    advance();
             }
         }
 
-        if (result.empty() || result == "0")
+        // Nothing consumed yet, or a lone leading zero: plain decimal digits.
+        if (position_ - begin <= 1)
         {
             while (std::isdigit(upeek()))
-                result += advance();
+                advance();
         }
 
         if (peek() == '.')
@@ -370,33 +381,31 @@ namespace wio
             if (peek(1) != '.') 
             {
                 isFloat = true;
-                result += advance();
+                advance();
 
                 while (std::isdigit(upeek()))
-                    result += advance();
+                    advance();
             }
         }
 
         if (matchOneOf("eE"))
         {
-            result += advance();
+            advance();
             if (matchOneOf("+-"))
-                result += advance();
+                advance();
 
             if (!std::isdigit(upeek()))
                 throw InvalidNumberError("Invalid scientific notation!", location_);
 
             while (std::isdigit(upeek()))
-                result += advance();
+                advance();
         }
 
-        std::string suffix;
+        const uint64_t suffixBegin = position_;
         while (std::isalnum(upeek()) || match('_'))
-        {
-            suffix += advance();
-        }
-        
-        result += suffix;
+            advance();
+
+        const std::string_view suffix(source_.data() + suffixBegin, position_ - suffixBegin);
 
         TokenType type = isFloat ? TokenType::floatLiteral : TokenType::integerLiteral;
 
@@ -423,20 +432,17 @@ namespace wio
             }
             else
             {
-                throw InvalidNumberError(("Unknown literal suffix: '" + suffix + "'").c_str(), location_);
+                throw InvalidNumberError(("Unknown literal suffix: '" + std::string(suffix) + "'").c_str(), location_);
             }
         }
 
-        return {
-            .type = type,
-            .value = result,
-            .loc = start
-        };
+        return makeToken(type, begin, start);
     }
 
     Token Lexer::readChar()
     {
         Location start = location_;
+        const uint64_t begin = position_;
         advance();
 
         std::string result;
@@ -455,40 +461,35 @@ namespace wio
             throw UnterminatedCharError("Unterminated character literal", location_);
 
 
-        Token token_result{
-            .type = TokenType::charLiteral,
-            .value = result,
-            .loc = start
-        };
-
         if (match('\''))
             advance();
         else
             throw InvalidCharError("Invalid character literal!", location_);
         
-        return token_result;
+        return Token{
+            .type = TokenType::charLiteral,
+            .value = result,
+            .loc = start,
+            .offset = static_cast<uint32_t>(begin),
+            .length = static_cast<uint32_t>(position_ - begin)
+        };
     }
 
     Token Lexer::readOperator()
     {
         Location start = location_;
-        std::string op(1, advance());
-
-        if (operatorMap.contains(op + peek() + peek(1)))
-        {
-            op += advance();
-            op += advance();
-        }
-        else if (operatorMap.contains(op + peek()))
-        {
-            op += advance();
-        }
-
-        return {
-            .type = operatorMap.at(op),
-            .value = op,
-            .loc = start
-        };
+        const uint64_t begin = position_;
+        const std::string_view rest(source_.data() + begin, source_.size() - begin);
+
+        int length = 1;
+        if (rest.size() >= 3 && operatorMap.contains(rest.substr(0, 3)))
+            length = 3;
+        else if (rest.size() >= 2 && operatorMap.contains(rest.substr(0, 2)))
+            length = 2;
+
+        const TokenType type = operatorMap.at(rest.substr(0, static_cast<size_t>(length)));
+        advance(length);
+        return makeToken(type, begin, start);
     }
 
     Token Lexer::readSymbol()
@@ -497,8 +498,10 @@ namespace wio
 
         Token tok {
             .type = symbolMap.at(peek()),
-            .value = std::string(1, peek()),
-            .loc = start
+            .value = std::string_view(source_.data() + position_, 1),
+            .loc = start,
+            .offset = static_cast<uint32_t>(position_),
+            .length = 1
         };
 
         if(multiMatch("$\""))
@@ -531,6 +534,7 @@ namespace wio
     void Lexer::readString()
     {
         Location start = location_;
+        uint64_t begin = position_;
         std::string buffer;
 
         const bool isContinuation =
@@ -571,9 +575,11 @@ namespace wio
                 throw InvalidStringError("Unicode text literal contains invalid UTF-8", segmentLocation);
             tokens_.push_back(Token{
                 .type = TokenType::stringLiteral,
-                .value = std::move(value),
+                .value = value,
                 .loc = segmentLocation,
-                .isUnicodeString = isUnicode
+                .isUnicodeString = isUnicode,
+                .offset = static_cast<uint32_t>(begin),
+                .length = static_cast<uint32_t>(position_ - begin)
             });
         };
 
@@ -599,20 +605,16 @@ namespace wio
                 buffer.clear();
 
                 // $
-                tokens_.emplace_back(
-                    TokenType::dollar,
-                    "$",
-                    location_
-                );
+                begin = position_;
+                const Location dollarLocation = location_;
                 advance();
+                tokens_.push_back(makeToken(TokenType::dollar, begin, dollarLocation));
 
                 // {
-                tokens_.emplace_back(
-                    TokenType::leftBrace,
-                    "{",
-                    location_
-                );
+                begin = position_;
+                const Location braceLocation = location_;
                 advance();
+                tokens_.push_back(makeToken(TokenType::leftBrace, begin, braceLocation));
 
                 if (isContinuation)
                 {
@@ -662,13 +664,14 @@ namespace wio
 
     bool Lexer::isOperator(char c)
     {
-        return std::ranges::any_of(
-            std::views::keys(operatorMap).begin(),
-            std::views::keys(operatorMap).end(),
-            [c](const auto& op)
-            {
-                return !op.empty() && op[0] == c;
-            });
+        static const auto startsOperator = []
+        {
+            std::array<bool, 256> table{};
+            for (const auto& op : std::views::keys(operatorMap))
+                table[static_cast<unsigned char>(op[0])] = true;
+            return table;
+        }();
+        return startsOperator[static_cast<unsigned char>(c)];
     }
     
     bool Lexer::isSymbol(char c)
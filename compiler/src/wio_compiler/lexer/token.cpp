@@ -271,8 +271,7 @@ namespace wio
 
    bool Token::isValid() const
    {
-       Token inv = invalid();
-       return !(type == inv.type && value == inv.value);
+       return !(type == TokenType::invalid && value.empty());
    }
 
    bool Token::isKeyword() const
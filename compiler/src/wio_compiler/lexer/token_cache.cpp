@@ -0,0 +1,263 @@
+#include "wio/lexer/token_cache.h"
+
+#include "wio/lexer/lexer.h"
+
+#include <chrono>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <system_error>
+#include <thread>
+
+namespace
+{
+    // Bump when the entry layout or the meaning of a serialized token changes.
+    constexpr std::string_view kEntryMagic = "WTC2";
+
+    // Token flag bits. Most token values are their own lexeme, so the entry
+    // stores only the source range and the value is re-sliced on load.
+    constexpr unsigned char kUnicodeStringFlag = 1u;
+    constexpr unsigned char kSourceSliceFlag = 2u;
+
+    uint64_t hashBytes(std::string_view bytes, uint64_t hash = 1469598103934665603ull)
+    {
+        for (const char ch : bytes)
+        {
+            hash ^= static_cast<unsigned char>(ch);
+            hash *= 1099511628211ull;
+        }
+        return hash;
+    }
+
+    void writeVarint(std::string& out, uint64_t value)
+    {
+        while (value >= 0x80u)
+        {
+            out.push_back(static_cast<char>((value & 0x7fu) | 0x80u));
+            value >>= 7u;
+        }
+        out.push_back(static_cast<char>(value));
+    }
+
+    bool readVarint(std::string_view data, size_t& offset, uint64_t& value)
+    {
+        value = 0;
+        for (unsigned shift = 0; shift < 64; shift += 7)
+        {
+            if (offset >= data.size())
+                return false;
+            const auto byte = static_cast<unsigned char>(data[offset++]);
+            value |= static_cast<uint64_t>(byte & 0x7fu) << shift;
+            if ((byte & 0x80u) == 0)
+                return true;
+        }
+        return false;
+    }
+
+    void writeBytes(std::string& out, std::string_view bytes)
+    {
+        writeVarint(out, bytes.size());
+        out.append(bytes);
+    }
+
+    bool readBytes(std::string_view data, size_t& offset, std::string_view& bytes)
+    {
+        uint64_t size = 0;
+        if (!readVarint(data, offset, size) || size > data.size() - offset)
+            return false;
+        bytes = data.substr(offset, static_cast<size_t>(size));
+        offset += static_cast<size_t>(size);
+        return true;
+    }
+
+    std::string toHex(uint64_t value)
+    {
+        static constexpr char digits[] = "0123456789abcdef";
+        std::string text(16, '0');
+        for (int index = 15; index >= 0; --index)
+        {
+            text[static_cast<size_t>(index)] = digits[value & 0xfu];
+            value >>= 4u;
+        }
+        return text;
+    }
+}
+
+namespace wio
+{
+    TokenCache::TokenCache(std::filesystem::path directory, std::string compilerIdentity)
+        : directory_(std::move(directory)), identity_(std::move(compilerIdentity))
+    {
+    }
+
+    bool TokenCache::enabled() const
+    {
+        return !directory_.empty();
+    }
+
+    const std::filesystem::path& TokenCache::directory() const
+    {
+        return directory_;
+    }
+
+    std::vector<Token> TokenCache::lex(const std::string& source, const std::string& sourceName) const
+    {
+        if (enabled())
+        {
+            if (auto cached = load(source, sourceName))
+            {
+                ++hits_;
+                return std::move(*cached);
+            }
+            ++misses_;
+        }
+
+        Lexer lexer(source, sourceName);
+        auto tokens = lexer.lex();
+        if (enabled())
+            store(source, tokens);
+        return tokens;
+    }
+
+    std::optional<std::vector<Token>> TokenCache::load(std::string_view source, const std::string& sourceName) const
+    {
+        std::ifstream input(entryPath(source), std::ios::binary);
+        if (!input)
+            return std::nullopt;
+        const std::string data{ std::istreambuf_iterator<char>(input), std::istreambuf_iterator<char>() };
+        return deserialize(data, identity_, source, sourceName);
+    }
+
+    void TokenCache::store(std::string_view source, const std::vector<Token>& tokens) const
+    {
+        // Entries are published with a rename so concurrent compilers never
+        // observe a partially written file. Failures only cost a later miss.
+        std::error_code ec;
+        std::filesystem::create_directories(directory_, ec);
+        if (ec)
+            return;
+
+        const auto target = entryPath(source);
+        const auto unique = std::to_string(std::chrono::steady_clock::now().time_since_epoch().count()) + "-" +
+                            std::to_string(std::hash<std::thread::id>{}(std::this_thread::get_id()));
+        auto temporary = target;
+        temporary += ".tmp-" + unique;
+        {
+            std::ofstream output(temporary, std::ios::binary | std::ios::trunc);
+            if (!output)
+                return;
+            const auto data = serialize(identity_, source, tokens);
+            output.write(data.data(), static_cast<std::streamsize>(data.size()));
+            if (!output)
+            {
+                output.close();
+                std::filesystem::remove(temporary, ec);
+                return;
+            }
+        }
+        std::filesystem::rename(temporary, target, ec);
+        if (ec)
+            std::filesystem::remove(temporary, ec);
+    }
+
+    uint64_t TokenCache::hitCount() const
+    {
+        return hits_;
+    }
+
+    uint64_t TokenCache::missCount() const
+    {
+        return misses_;
+    }
+
+    std::string TokenCache::serialize(std::string_view identity, std::string_view source, const std::vector<Token>& tokens)
+    {
+        std::string out;
+        out.reserve(64 + tokens.size() * 8);
+        out.append(kEntryMagic);
+        writeBytes(out, identity);
+        writeVarint(out, source.size());
+        writeVarint(out, hashBytes(source));
+        writeVarint(out, tokens.size());
+        for (const auto& token : tokens)
+        {
+            const bool isSlice = token.length != 0 && static_cast<size_t>(token.offset) + token.length <= source.size() &&
+                                 source.substr(token.offset, token.length) == token.value;
+            unsigned char flags = token.isUnicodeString ? kUnicodeStringFlag : 0u;
+            if (isSlice)
+                flags |= kSourceSliceFlag;
+            out.push_back(static_cast<char>(token.type));
+            out.push_back(static_cast<char>(flags));
+            writeVarint(out, token.loc.line);
+            writeVarint(out, token.loc.column);
+            writeVarint(out, token.offset);
+            writeVarint(out, token.length);
+            if (!isSlice)
+                writeBytes(out, token.value);
+        }
+        return out;
+    }
+
+    std::optional<std::vector<Token>> TokenCache::deserialize(std::string_view data, std::string_view identity,
+                                                              std::string_view source, const std::string& sourceName)
+    {
+        if (data.substr(0, kEntryMagic.size()) != kEntryMagic)
+            return std::nullopt;
+        size_t offset = kEntryMagic.size();
+
+        std::string_view storedIdentity;
+        uint64_t sourceSize = 0;
+        uint64_t sourceHash = 0;
+        uint64_t count = 0;
+        if (!readBytes(data, offset, storedIdentity) || storedIdentity != identity ||
+            !readVarint(data, offset, sourceSize) || sourceSize != source.size() ||
+            !readVarint(data, offset, sourceHash) || sourceHash != hashBytes(source) ||
+            !readVarint(data, offset, count) || count > data.size())
+            return std::nullopt;
+
+        const common::Name file(sourceName);
+        std::vector<Token> tokens;
+        tokens.reserve(static_cast<size_t>(count));
+        for (uint64_t index = 0; index < count; ++index)
+        {
+            if (data.size() - offset < 2)
+                return std::nullopt;
+            // newline is the last TokenType; anything above it is not a token.
+            const auto type = static_cast<unsigned char>(data[offset++]);
+            if (type > static_cast<unsigned char>(TokenType::newline))
+                return std::nullopt;
+            Token token;
+            token.type = static_cast<TokenType>(type);
+            const auto flags = static_cast<unsigned char>(data[offset++]);
+            token.isUnicodeString = (flags & kUnicodeStringFlag) != 0;
+            uint64_t tokenOffset = 0;
+            uint64_t tokenLength = 0;
+            if (!readVarint(data, offset, token.loc.line) ||
+                !readVarint(data, offset, token.loc.column) ||
+                !readVarint(data, offset, tokenOffset) ||
+                !readVarint(data, offset, tokenLength) ||
+                tokenOffset > source.size() || tokenLength > source.size() - tokenOffset)
+                return std::nullopt;
+            token.offset = static_cast<uint32_t>(tokenOffset);
+            token.length = static_cast<uint32_t>(tokenLength);
+
+            std::string_view value;
+            if ((flags & kSourceSliceFlag) != 0)
+                value = source.substr(token.offset, token.length);
+            else if (!readBytes(data, offset, value))
+                return std::nullopt;
+            token.value.assign(value);
+            token.loc.file = file;
+            tokens.push_back(token);
+        }
+        if (offset != data.size())
+            return std::nullopt;
+        return tokens;
+    }
+
+    std::filesystem::path TokenCache::entryPath(std::string_view source) const
+    {
+        const uint64_t key = hashBytes(source, hashBytes(identity_));
+        return directory_ / (toHex(key) + ".wtc");
+    }
+}
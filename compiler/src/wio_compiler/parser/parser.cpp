@@ -116,8 +116,12 @@ namespace wio
         return makeNodePtr<Program>(std::move(statements));
     }
 
-    Token Parser::peek(int offset) const
+    const Token& Parser::peek(int offset) const
     {
+        // References stay valid until the next consumeGenericClose() split,
+        // which is the only place the token stream is edited.
+        static const Token invalidToken = Token::invalid();
+
         using SignedIndex = std::ptrdiff_t;
 
         const SignedIndex baseIndex = static_cast<SignedIndex>(currentTokenIndex_);
@@ -128,10 +132,10 @@ namespace wio
             return tokens_[static_cast<size_t>(candidateIndex)];
         }
 
-        return Token::invalid();
+        return invalidToken;
     }
 
-    Token Parser::previous() const
+    const Token& Parser::previous() const
     {
         return peek(-1);
     }
@@ -151,7 +155,7 @@ namespace wio
 
     bool Parser::match(TokenType type, bool consume)
     {
-        Token current = peek();
+        const Token& current = peek();
         
         if (current.type != type)
             return false;
@@ -164,7 +168,7 @@ namespace wio
 
     bool Parser::match(TokenType type, std::string_view value, bool consume)
     {
-        Token current = peek();
+        const Token& current = peek();
         
         if (current.type != type)
         {
@@ -1037,12 +1041,13 @@ namespace wio
         if (arg.type != TokenType::identifier || !match(TokenType::opScope))
             return arg;
 
+        std::string qualifiedName = arg.value;
         while (match(TokenType::opScope, true))
         {
             Token nextSegment = consumeIdentifier();
-            arg.value += "::" + nextSegment.value;
-            arg.type = TokenType::identifier;
+            qualifiedName += "::" + nextSegment.value;
         }
+        arg.value = qualifiedName;
 
         return arg;
     }
@@ -1236,10 +1241,15 @@ namespace wio
         else
             utError("Expected type name.", peek().loc);
 
-        while (typeName.type == TokenType::identifier && match(TokenType::opScope, true))
+        if (typeName.type == TokenType::identifier && peek().type == TokenType::opScope)
         {
-            Token nextSegment = consumeIdentifier();
-            typeName.value += "::" + nextSegment.value;
+            std::string qualifiedName = typeName.value;
+            while (match(TokenType::opScope, true))
+            {
+                Token nextSegment = consumeIdentifier();
+                qualifiedName += "::" + nextSegment.value;
+            }
+            typeName.value = qualifiedName;
         }
         
         Location startLoc = typeName.loc;
@@ -2396,7 +2406,7 @@ namespace wio
                 constraint->generics.push_back(std::move(operand));
 
                 Token rawConstraint = constraint->name;
-                rawConstraint.value += "<" + parameterToken.value + (isPack ? "...>" : ">");
+                rawConstraint.value = rawConstraint.value + "<" + parameterToken.value + (isPack ? "...>" : ">");
                 argumentGroups[parameterIndex].push_back(std::move(rawConstraint));
                 typeArgumentGroups[parameterIndex].push_back(std::move(constraint));
 
@@ -2,6 +2,7 @@
 
 #include <array>
 #include <cctype>
+#include <chrono>
 #include <functional>
 #include <limits>
 #include <optional>
@@ -1074,6 +1075,23 @@ namespace wio::sema
                    resolvedType.AsFast<PrimitiveType>()->name == "string";
         }
 
+        bool isFunctionType(const Ref<Type>& type)
+        {
+            Ref<Type> resolvedType = unwrapAliasType(type);
+            return resolvedType && resolvedType->kind() == TypeKind::Function;
+        }
+
+        // Values whose copy allocates and duplicates their whole contents.
+        bool isCopyHeavyValueType(const Ref<Type>& type)
+        {
+            Ref<Type> resolvedType = unwrapAliasType(type);
+            if (!resolvedType)
+                return false;
+            return isStringType(resolvedType) ||
+                   resolvedType->kind() == TypeKind::Array ||
+                   resolvedType->kind() == TypeKind::Dictionary;
+        }
+
         bool isTextType(const Ref<Type>& type)
         {
             Ref<Type> resolvedType = unwrapAliasType(type);
@@ -2086,7 +2104,7 @@ namespace wio::sema
                     right->type == TokenType::stringLiteral &&
                     left->isUnicodeString == right->isUnicodeString)
                 {
-                    left->value += right->value;
+                    left->value = left->value + right->value;
                     left->loc = expression->location();
                     return left;
                 }
@@ -2094,12 +2112,7 @@ namespace wio::sema
 
             if (const auto* interpolated = expression->as<InterpolatedStringLiteral>())
             {
-                Token result{
-                    .type = TokenType::stringLiteral,
-                    .value = {},
-                    .loc = expression->location(),
-                    .isUnicodeString = interpolated->isUnicode
-                };
+                std::string text;
                 for (const auto& part : interpolated->parts)
                 {
                     auto value = tryEvaluateStaticAttributeConstant(
@@ -2109,19 +2122,24 @@ namespace wio::sema
                         return std::nullopt;
 
                     if (value->type == TokenType::integerLiteral)
-                        result.value += common::stripIntegerLiteralTypeSuffix(value->value);
+                        text += common::stripIntegerLiteralTypeSuffix(value->value);
                     else if (value->type == TokenType::floatLiteral)
-                        result.value += common::stripFloatLiteralTypeSuffix(value->value);
+                        text += common::stripFloatLiteralTypeSuffix(value->value);
                     else if (value->type == TokenType::stringLiteral ||
                              value->type == TokenType::kwTrue ||
                              value->type == TokenType::kwFalse ||
                              value->type == TokenType::charLiteral ||
                              value->type == TokenType::byteLiteral)
-                        result.value += value->value;
+                        text += value->value;
                     else
                         return std::nullopt;
                 }
-                return result;
+                return Token{
+                    .type = TokenType::stringLiteral,
+                    .value = text,
+                    .loc = expression->location(),
+                    .isUnicodeString = interpolated->isUnicode
+                };
             }
 
             Ref<Type> expressionType = unwrapAliasType(expression->refType.Lock());
@@ -4206,7 +4224,7 @@ namespace wio::sema
             std::vector<std::string> parameterNames;
             parameterNames.reserve(parameters.size());
             for (const auto& parameter : parameters)
-                parameterNames.push_back(parameter ? parameter->token.value : std::string{});
+                parameterNames.push_back(parameter ? parameter->token.value.str() : std::string{});
 
             for (size_t index = 0; index < parameters.size(); ++index)
             {
@@ -6282,6 +6300,23 @@ namespace wio::sema
             default: return "@UnknownModuleLifecycle";
             }
         }
+
+        // The object type built by a plain `Type(args)` constructor call, or
+        // null for anything else.
+        const StructType* getObjectConstructionType(const FunctionCallExpression& call)
+        {
+            if (!call.callee || call.unwrapResult || call.propagateResult ||
+                call.operatorDispatchKind != OperatorDispatchKind::None)
+            {
+                return nullptr;
+            }
+
+            Ref<Type> constructedType = unwrapAliasType(call.callee->refType.Lock());
+            if (!constructedType || constructedType->kind() != TypeKind::Struct)
+                return nullptr;
+            auto structType = constructedType.AsFast<StructType>();
+            return structType->isObject && !structType->isInterface ? structType.Get() : nullptr;
+        }
     }
     
     SemanticAnalyzer::SemanticAnalyzer() = default;
@@ -6325,8 +6360,20 @@ namespace wio::sema
         seenModuleUnload_ = false;
         seenModuleSaveState_ = false;
         seenModuleRestoreState_ = false;
-        
+
+        stackObjectCandidates_.clear();
+        stackObjectLocalUses_.clear();
+        objectReceiverUses_.clear();
+        calledMemberAccesses_.clear();
+        objectSelfUses_.clear();
+        selfRetainingObjects_.clear();
+
+        const auto started = std::chrono::steady_clock::now();
+        Scope::resetLookupStats();
         program->accept(*this);
+        markStackObjectConstructions();
+        stats_.lookups = Scope::lookupStats();
+        stats_.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count();
     }
 
     void SemanticAnalyzer::enterScope(ScopeKind kind)
@@ -6342,6 +6389,172 @@ namespace wio::sema
             currentScope_ = currentScope_->getParent().Lock();
     }
 
+    void SemanticAnalyzer::noteParameterWrite(const NodePtr<Expression>& target)
+    {
+        // Element and member writes mutate the parameter that owns them, so
+        // walk down to the root identifier.
+        Expression* current = target.Get();
+        while (current)
+        {
+            if (auto* access = current->as<ArrayAccessExpression>())
+                current = access->object.Get();
+            else if (auto* member = current->as<MemberAccessExpression>())
+                current = member->object.Get();
+            else
+                break;
+        }
+
+        if (!current || !current->is<Identifier>())
+            return;
+        if (auto symbol = current->referencedSymbol.Lock(); symbol && symbol->kind == SymbolKind::Parameter)
+            writtenParameters_.insert(symbol.Get());
+    }
+
+    void SemanticAnalyzer::noteNonEscapingCallbackUse(const NodePtr<Expression>& expression)
+    {
+        if (!expression || !expression->is<Identifier>())
+            return;
+
+        auto symbol = expression->referencedSymbol.Lock();
+        if (!symbol || !callbackParameterUses_.contains(symbol.Get()))
+            return;
+
+        // A lambda capture copies the view into a closure that may outlive the call.
+        for (const auto& context : lambdaCaptureContexts_)
+        {
+            if (context.capturedSymbols.contains(symbol.Get()))
+                return;
+        }
+        nonEscapingCallbackUses_.insert(expression.Get());
+    }
+
+    void SemanticAnalyzer::noteObjectReceiverUse(const MemberAccessExpression& access)
+    {
+        // Reading or writing a field and calling a method leave the object
+        // where it is. A closure that captures the receiver may outlive it.
+        Expression* receiver = access.object.Get();
+        if (!receiver)
+            return;
+
+        if (receiver->is<SelfExpression>())
+        {
+            if (!lambdaCaptureContexts_.empty())
+                return;
+        }
+        else if (receiver->is<Identifier>())
+        {
+            auto symbol = receiver->referencedSymbol.Lock();
+            if (!symbol || !stackObjectLocalUses_.contains(symbol.Get()))
+                return;
+            for (const auto& context : lambdaCaptureContexts_)
+            {
+                if (context.capturedSymbols.contains(symbol.Get()))
+                    return;
+            }
+        }
+        else if (auto* construction = receiver->as<FunctionCallExpression>())
+        {
+            const StructType* objectType = getObjectConstructionType(*construction);
+            if (!objectType)
+                return;
+            stackObjectCandidates_[construction].type = objectType;
+        }
+        else
+        {
+            return;
+        }
+
+        objectReceiverUses_.insert_or_assign(receiver, &access);
+    }
+
+    void SemanticAnalyzer::noteSelfRetainingObject(const Ref<Type>& type)
+    {
+        Ref<Type> objectType = unwrapAliasType(type);
+        if (objectType && objectType->kind() == TypeKind::Struct)
+            selfRetainingObjects_.insert(objectType.AsFast<StructType>().Get());
+    }
+
+    void SemanticAnalyzer::markStackObjectConstructions()
+    {
+        if (Compiler::get().getFlags().get_NoStackObjects())
+            return;
+
+        auto isReceiverUse = [&](const Expression* use)
+        {
+            auto receiver = objectReceiverUses_.find(use);
+            if (receiver == objectReceiverUses_.end())
+                return false;
+            auto member = receiver->second->referencedSymbol.Lock();
+            if (!member)
+                return false;
+            if (member->kind == SymbolKind::Variable)
+                return true;
+            return (member->kind == SymbolKind::Function || member->kind == SymbolKind::FunctionGroup) &&
+                   calledMemberAccesses_.contains(receiver->second);
+        };
+
+        auto keepsSelf = [&](const StructType* type)
+        {
+            if (selfRetainingObjects_.contains(type))
+                return true;
+            auto selfUses = objectSelfUses_.find(type);
+            return selfUses != objectSelfUses_.end() && !std::ranges::all_of(selfUses->second, isReceiverUse);
+        };
+
+        // Generic, native and derived objects are left on the heap; interface
+        // bases only add virtual dispatch, unless a default method keeps self.
+        const Ref<Type> rootObjectType = Compiler::get().getTypeContext().getObject();
+        auto canLiveOnStack = [&](const StructType* type)
+        {
+            if (!type->genericParameterNames.empty() || !type->genericArguments.empty() ||
+                !type->nativeCppName.empty() || keepsSelf(type))
+            {
+                return false;
+            }
+            return std::ranges::all_of(type->baseTypes, [&](const Ref<Type>& baseType)
+            {
+                Ref<Type> resolvedBase = unwrapAliasType(baseType);
+                if (resolvedBase == rootObjectType)
+                    return true;
+                if (!resolvedBase || resolvedBase->kind() != TypeKind::Struct)
+                    return false;
+                auto baseStruct = resolvedBase.AsFast<StructType>();
+                return baseStruct->isInterface && !keepsSelf(baseStruct.Get());
+            });
+        };
+
+        for (auto& [construction, candidate] : stackObjectCandidates_)
+        {
+            bool allocatesOnStack = candidate.type && canLiveOnStack(candidate.type);
+            if (allocatesOnStack && candidate.locals.empty())
+                allocatesOnStack = isReceiverUse(construction);
+            for (const Symbol* local : candidate.locals)
+            {
+                if (!allocatesOnStack)
+                    break;
+                Ref<Type> localType = unwrapAliasType(local->type);
+                auto uses = stackObjectLocalUses_.find(local);
+                allocatesOnStack = localType.Get() == candidate.type && uses != stackObjectLocalUses_.end() &&
+                                   std::ranges::all_of(uses->second, isReceiverUse);
+            }
+            construction->allocatesOnStack = allocatesOnStack;
+        }
+    }
+
+    void SemanticAnalyzer::noteForwardedCallbackArguments(const FunctionCallExpression& call, const Ref<Symbol>& callee)
+    {
+        // Forwarding a callback to a parameter that is itself only called
+        // keeps it within this call.
+        if (!callee)
+            return;
+        const auto& forwardedParameters = callee->functionRefParameters;
+        for (size_t i = 0; i < call.arguments.size() && i < forwardedParameters.size(); ++i)
+        {
+            if (forwardedParameters[i])
+                noteNonEscapingCallbackUse(call.arguments[i]);
+        }
+    }
+
     std::string SemanticAnalyzer::getCurrentNamespacePath() const
     {
         std::string namespacePath;
@@ -8694,6 +8907,7 @@ namespace wio::sema
     void SemanticAnalyzer::visit(AssignmentExpression& node)
     {
         node.left->accept(*this);
+        noteParameterWrite(node.left);
         Ref<Symbol> directlyAssignedSymbol = node.left->is<Identifier>()
             ? node.left->referencedSymbol.Lock()
             : nullptr;
@@ -9592,6 +9806,10 @@ namespace wio::sema
         }
 
         node.referencedSymbol = sym;
+        if (sym->kind == SymbolKind::Parameter && isFunctionType(sym->type))
+            callbackParameterUses_[sym.Get()].insert(&node);
+        if (auto uses = stackObjectLocalUses_.find(sym.Get()); uses != stackObjectLocalUses_.end())
+            uses->second.insert(&node);
         if (!sym->flags.get_isGlobal() &&
             (sym->kind == SymbolKind::Variable || sym->kind == SymbolKind::Parameter))
         {
@@ -10662,10 +10880,14 @@ namespace wio::sema
             memberId->referencedSymbol = foundMember;
             memberId->refType = memberType;
         }
+        noteObjectReceiverUse(node);
     }
 
     void SemanticAnalyzer::visit(FunctionCallExpression& node)
     {
+        if (auto* calledMember = node.callee ? node.callee->as<MemberAccessExpression>() : nullptr)
+            calledMemberAccesses_.insert(calledMember);
+
         auto formatAppliedTypeName = [](const std::string& baseName, const std::vector<Ref<Type>>& typeArguments) -> std::string
         {
             if (typeArguments.empty())
@@ -10786,6 +11008,7 @@ namespace wio::sema
         };
 
         node.callee->accept(*this);
+        noteNonEscapingCallbackUse(node.callee);
         Ref<Symbol> calleeSym = node.callee->referencedSymbol.Lock();
         Ref<Symbol> genericOwnerSym = calleeSym;
         node.operatorDispatchKind = OperatorDispatchKind::None;
@@ -12573,6 +12796,8 @@ namespace wio::sema
             {
                 node.callee->referencedSymbol = bestMatch->symbol;
                 node.callee->refType = bestMatch->functionType;
+
+                noteForwardedCallbackArguments(node, bestMatch->symbol);
             }
             else if (constructorStructType && !constructorGenericParameterNames.empty() && (!constructorGenericBindings.empty() || !constructorGenericBindingSet.packBindings.empty()))
             {
@@ -12737,6 +12962,7 @@ namespace wio::sema
             resolvedArgumentTypes.has_value())
         {
             argTypes = std::move(*resolvedArgumentTypes);
+            noteForwardedCallbackArguments(node, calleeSym);
         }
         else
         {
@@ -12902,6 +13128,10 @@ namespace wio::sema
 
     void SemanticAnalyzer::visit(LambdaExpression& node)
     {
+        // Closures inside an object's methods keep `this` alive through a
+        // strong guard, whether or not they name `self`.
+        noteSelfRetainingObject(currentStructType_);
+
         Ref<FunctionType> expectedFunctionType = nullptr;
         if (currentExpectedExpressionType_)
         {
@@ -13032,6 +13262,8 @@ namespace wio::sema
     void SemanticAnalyzer::visit(RefExpression& node)
     {
         node.operand->accept(*this);
+        if (node.isMut)
+            noteParameterWrite(node.operand);
 
         if (!isAddressableRefOperand(node.operand))
         {
@@ -13617,6 +13849,11 @@ namespace wio::sema
         }
         
         Ref<Type> selfType = currentExtensionTargetType_ ? currentExtensionTargetType_ : currentStructType_;
+        if (Ref<Type> selfStructType = unwrapAliasType(selfType);
+            selfStructType && selfStructType->kind() == TypeKind::Struct)
+        {
+            objectSelfUses_[selfStructType.AsFast<StructType>().Get()].insert(&node);
+        }
         for (auto& context : lambdaCaptureContexts_)
         {
             if (context.node)
@@ -14476,7 +14713,7 @@ namespace wio::sema
                 WIO_LOG_ADD_ERROR(
                     parameter.defaultValue->location(),
                     "Default value for attribute parameter '{}' must be '{}', got '{}'.",
-                    parameter.name ? parameter.name->token.value : std::to_string(index),
+                    parameter.name ? parameter.name->token.value.str() : std::to_string(index),
                     expectedType->toString(),
                     actualType->toString()
                 );
@@ -14498,7 +14735,7 @@ namespace wio::sema
                     WIO_LOG_ADD_ERROR(
                         parameter.defaultValue->location(),
                         "Default value for attribute parameter '{}' must be a compile-time scalar, string, or text expression.",
-                        parameter.name ? parameter.name->token.value : std::to_string(index)
+                        parameter.name ? parameter.name->token.value.str() : std::to_string(index)
                     );
                 }
             }
@@ -14663,6 +14900,16 @@ namespace wio::sema
                 return true;
             };
 
+            // Track the local before its initializer runs, so that even a
+            // self-reference there counts as a use.
+            auto* objectConstruction = node.initializer->as<FunctionCallExpression>();
+            const bool mayLiveOnStack =
+                objectConstruction && !currentFunctionIsAsync_ && !sym->flags.get_isGlobal() &&
+                node.mutability != Mutability::Const &&
+                (currentScope_->getKind() == ScopeKind::Function || currentScope_->getKind() == ScopeKind::Block);
+            if (mayLiveOnStack)
+                stackObjectLocalUses_.try_emplace(sym.Get());
+
             Ref<Type> previousExpectedExpressionType = currentExpectedExpressionType_;
             bool previousAllowContextualNumericLiteralTyping = allowContextualNumericLiteralTyping_;
             currentExpectedExpressionType_ = sym->type;
@@ -14672,6 +14919,20 @@ namespace wio::sema
             allowContextualNumericLiteralTyping_ = previousAllowContextualNumericLiteralTyping;
             Ref<Type> initType = node.initializer->refType.Lock();
 
+            if (mayLiveOnStack)
+            {
+                if (const StructType* objectType = getObjectConstructionType(*objectConstruction))
+                {
+                    auto& candidate = stackObjectCandidates_[objectConstruction];
+                    candidate.type = objectType;
+                    candidate.locals.push_back(sym.Get());
+                }
+                else
+                {
+                    stackObjectLocalUses_.erase(sym.Get());
+                }
+            }
+
             if (containsInferredArrayExtent(sym->type))
             {
                 Ref<Type> resolvedInitializer = unwrapAliasType(initType);
@@ -15060,6 +15321,11 @@ namespace wio::sema
         bool hasApply = hasAttribute(node.attributes, Attribute::Apply);
         bool isStructMethod = currentScope_ && currentScope_->getKind() == ScopeKind::Struct;
         auto currentStruct = currentStructType_ ? currentStructType_.AsFast<StructType>() : nullptr;
+        if (isStructMethod &&
+            (node.isAsync || !node.body || isNative || isExported || isCommand || isEvent || isGenericFunction))
+        {
+            noteSelfRetainingObject(currentStructType_);
+        }
         const bool isLifecycleMethod =
             node.name->token.value == "OnConstruct" || node.name->token.value == "OnDestruct";
         const bool isOperatorMethod = common::isOperatorOverloadName(node.name->token.value);
@@ -15108,7 +15374,7 @@ namespace wio::sema
                     continue;
 
                 const std::string parameterName = parameterIndex < node.parameters.size() && node.parameters[parameterIndex].name
-                    ? node.parameters[parameterIndex].name->token.value
+                    ? node.parameters[parameterIndex].name->token.value.str()
                     : common::formatString("param{}", parameterIndex);
                 WIO_LOG_ADD_ERROR(
                     node.parameters[parameterIndex].name ? node.parameters[parameterIndex].name->location() : node.location(),
@@ -15257,7 +15523,7 @@ namespace wio::sema
                 WIO_LOG_ADD_ERROR(
                     node.location(),
                     "Operator '{}' must return bool.",
-                    operatorDisplay.has_value() ? std::string(*operatorDisplay) : node.name->token.value
+                    operatorDisplay.has_value() ? std::string(*operatorDisplay) : node.name->token.value.str()
                 );
             }
         }
@@ -15832,7 +16098,7 @@ namespace wio::sema
             {
                 const std::string parameterName =
                     parameterIndex < node.parameters.size() && node.parameters[parameterIndex].name
-                        ? node.parameters[parameterIndex].name->token.value
+                        ? node.parameters[parameterIndex].name->token.value.str()
                         : common::formatString("param{}", parameterIndex);
                 validateNativeComponentInteropType(funcType->paramTypes[parameterIndex], "parameter", parameterName);
             }
@@ -16149,6 +16415,35 @@ namespace wio::sema
         if (node.body)
             node.body->accept(*this);
 
+        // Coroutine frames and foreign or exported signatures keep owning
+        // parameters; methods do too, so overrides keep matching signatures.
+        const bool allowsBorrowedParameters =
+            node.body && !node.isAsync && !isNative && !isExported && !isCommand && !isEvent &&
+            !hasModuleLifecycle && !isStructMethod && !currentExtensionTargetType_;
+        funcSym->functionRefParameters.assign(node.parameters.size(), false);
+        funcSym->constRefParameters.assign(node.parameters.size(), false);
+        for (size_t i = 0; i < node.parameters.size(); ++i)
+        {
+            auto& param = node.parameters[i];
+            auto paramSymbol = param.name->referencedSymbol.Lock();
+            if (!allowsBorrowedParameters || param.isParameterPack || !paramSymbol)
+            {
+                param.passByConstRef = false;
+                continue;
+            }
+
+            param.passByConstRef = !writtenParameters_.contains(paramSymbol.Get()) &&
+                                   isCopyHeavyValueType(paramSymbol->type);
+            funcSym->constRefParameters[i] = param.passByConstRef;
+            if (auto uses = callbackParameterUses_.find(paramSymbol.Get()); uses != callbackParameterUses_.end())
+            {
+                funcSym->functionRefParameters[i] = std::ranges::all_of(uses->second, [&](const Expression* use)
+                {
+                    return nonEscapingCallbackUses_.contains(use);
+                });
+            }
+        }
+
         const bool requiresReturnValue = currentFunctionReturnType_ &&
                                          !currentFunctionReturnType_->isUnknown() &&
                                          !currentFunctionReturnType_->isVoid();
@@ -16603,7 +16898,7 @@ namespace wio::sema
             structType.AsFast<StructType>()->nativeCppName =
                 isExplicitSpecialization && genericPrimaryType
                     ? genericPrimaryType->nativeCppName
-                    : node.name ? node.name->token.value : "";
+                    : node.name ? node.name->token.value.str() : std::string{};
             structType.AsFast<StructType>()->nativeCppHeader =
                 isExplicitSpecialization && genericPrimaryType
                     ? genericPrimaryType->nativeCppHeader
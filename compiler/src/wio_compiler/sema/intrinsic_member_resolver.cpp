@@ -304,6 +304,11 @@ namespace wio::sema
                 appendMethodResolution(overloads, IntrinsicMember::TreeFloorKeyOr, keyType, { keyType, keyType }, typeContext, false);
             else if (memberName == "CeilKeyOr")
                 appendMethodResolution(overloads, IntrinsicMember::TreeCeilKeyOr, keyType, { keyType, keyType }, typeContext, false);
+            else if (memberName == "ScanRange")
+            {
+                Ref<Type> visitType = typeContext.getOrCreateFunctionType(typeContext.getVoid(), { keyType, valueType });
+                appendMethodResolution(overloads, IntrinsicMember::TreeScanRange, typeContext.getVoid(), { keyType, keyType, visitType }, typeContext, false);
+            }
 
             return overloads;
         }
@@ -3,70 +3,105 @@
 
 #include "wio/common/exception.h"
 
+#include <algorithm>
+
 namespace wio::sema
 {
+    namespace
+    {
+        thread_local Scope::LookupStats tLookupStats;
+    }
+
     Scope::Scope(WeakRef<Scope> parent, ScopeKind kind)
         : parent_(std::move(parent)), kind_(kind)
     {
     }
 
-    void Scope::define(const std::string& name, const Ref<Symbol>& symbol)
+    Scope::~Scope()
+    {
+        dropBindings();
+    }
+
+    void Scope::define(const common::Name& name, const Ref<Symbol>& symbol)
     {
-        if (auto it = symbols_.find(name); it != symbols_.end())
+        // Any scope below this one may have cached an outer binding of the
+        // name that this definition now shadows.
+        name.bumpVersion();
+
+        if (auto* existing = symbols_.find(name); existing && *existing)
         {
             if (symbol->kind == SymbolKind::Function)
             {
-                if (it->second->kind == SymbolKind::Function)
+                if ((*existing)->kind == SymbolKind::Function)
                 {
-                    auto group = Ref<Symbol>::Create(name, nullptr, SymbolKind::FunctionGroup, it->second->flags, symbol->definitionLoc);
-                    group->overloads.push_back(it->second);
+                    auto group = Ref<Symbol>::Create(name, nullptr, SymbolKind::FunctionGroup, (*existing)->flags, symbol->definitionLoc);
+                    group->overloads.push_back(*existing);
                     group->overloads.push_back(symbol);
-                    symbols_[name] = group;
+                    *existing = group;
                     return;
                 }
                 
-                if (it->second->kind == SymbolKind::FunctionGroup)
+                if ((*existing)->kind == SymbolKind::FunctionGroup)
                 {
-                    it->second->overloads.push_back(symbol);
+                    (*existing)->overloads.push_back(symbol);
                     return;
                 }
             }
 
             if (symbol)
-                throw RedefinitionError(("Symbol already defined here: " + it->second->definitionLoc.toString()).c_str());
+                throw RedefinitionError(("Symbol already defined here: " + (*existing)->definitionLoc.toString()).c_str());
         }
         
         symbols_[name] = symbol;
     }
 
-    Ref<Symbol> Scope::resolve(const std::string& name)
+    Ref<Symbol> Scope::resolve(const common::Name& name)
     {
-        if (auto it = symbols_.find(name); it != symbols_.end())
-        {
-            return it->second;
-        }
+        ++tLookupStats.lookups;
+        return resolveInChain(name);
+    }
 
-        if (auto locked = parent_.Lock(); locked)
+    Ref<Symbol> Scope::resolveInChain(const common::Name& name)
+    {
+        if (const auto* symbol = symbols_.find(name))
+            return *symbol;
+
+        const uint32_t version = name.version();
+        if (const auto* cached = resolved_.find(name); cached && cached->version == version)
         {
-            return locked->resolve(name);
+            ++tLookupStats.cacheHits;
+            return cached->symbol;
         }
 
-        return nullptr;
+        auto locked = parent_.Lock();
+        if (!locked)
+            return nullptr;
+
+        ++tLookupStats.parentSteps;
+        auto symbol = locked->resolveInChain(name);
+        resolved_[name] = { .symbol = symbol, .version = version };
+        return symbol;
     }
 
-    Ref<Symbol> Scope::resolveLocally(const std::string& name)
+    Ref<Symbol> Scope::resolveLocally(const common::Name& name)
     {
-        if (auto it = symbols_.find(name); it != symbols_.end())
-        {
-            return it->second;
-        }
+        ++tLookupStats.lookups;
+        if (const auto* symbol = symbols_.find(name))
+            return *symbol;
 
         return nullptr;
     }
 
-    const std::map<std::string, Ref<Symbol>>& Scope::getSymbols() const
+    std::vector<Scope::SymbolEntry> Scope::getSymbols() const
     {
-        return symbols_;
+        std::vector<SymbolEntry> symbols;
+        symbols.reserve(symbols_.size());
+        symbols_.forEach([&](const common::Name& name, const Ref<Symbol>& symbol)
+        {
+            symbols.emplace_back(name, symbol);
+        });
+        std::ranges::sort(symbols, {}, &SymbolEntry::first);
+        return symbols;
     }
 
     WeakRef<Scope> Scope::getParent() const
@@ -81,6 +116,27 @@ namespace wio::sema
 
     void Scope::clear()
     {
+        dropBindings();
         symbols_.clear();
+        resolved_.clear();
+    }
+
+    Scope::LookupStats Scope::lookupStats()
+    {
+        return tLookupStats;
+    }
+
+    void Scope::resetLookupStats()
+    {
+        tLookupStats = {};
+    }
+
+    void Scope::dropBindings()
+    {
+        // Names cached below this scope must not outlive their bindings.
+        symbols_.forEach([](const common::Name& name, const Ref<Symbol>&)
+        {
+            name.bumpVersion();
+        });
     }
 }
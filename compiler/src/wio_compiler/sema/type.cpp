@@ -58,7 +58,10 @@ namespace wio::sema
                 const Ref<ArrayType> initializerArrayType = rhs.AsFast<ArrayType>();
                 Ref<ArrayType> lhsArrayType = lhs.AsFast<ArrayType>();
             
-                if (lhsArrayType->size == 0 && initializerArrayType->size != 0)
+                // Only fixed arrays take their extent from the initializer;
+                // dynamic array types are interned and shared.
+                if (lhsArrayType->arrayKind != ArrayType::ArrayKind::Dynamic &&
+                    lhsArrayType->size == 0 && initializerArrayType->size != 0)
                     lhsArrayType->size = initializerArrayType->size;
             }
         
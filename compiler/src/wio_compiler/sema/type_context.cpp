@@ -2,6 +2,17 @@
 
 namespace wio::sema
 {
+    size_t TypeContext::InternKeyHash::operator()(const InternKey& key) const noexcept
+    {
+        size_t hash = std::hash<uint64_t>{}((static_cast<uint64_t>(key.kind) << 56u) ^ key.scalar);
+        auto mix = [&hash](size_t value) { hash ^= value + 0x9e3779b97f4a7c15ull + (hash << 6u) + (hash >> 2u); };
+        if (!key.text.empty())
+            mix(std::hash<std::string>{}(key.text));
+        for (const Type* part : key.parts)
+            mix(std::hash<const Type*>{}(part));
+        return hash;
+    }
+
     TypeContext::TypeContext()
     {
         t_void   = makeType<PrimitiveType>("void");
@@ -36,9 +47,12 @@ namespace wio::sema
 
     Ref<Type> TypeContext::getOrCreateReferenceType(Ref<Type> referredType, bool isMutable)
     {
-        return makeType<ReferenceType>(std::move(referredType), isMutable);
+        InternKey key{ TypeKind::Reference, isMutable ? 1u : 0u, {}, { referredType.Get() } };
+        return intern<ReferenceType>(std::move(key), std::move(referredType), isMutable);
     }
 
+    // Null literal types are refined in place when bound to a target type,
+    // so every literal keeps its own.
     Ref<Type> TypeContext::getOrCreateNullType(Ref<Type> transformedType)
     {
         return makeType<NullType>(std::move(transformedType));
@@ -48,35 +62,60 @@ namespace wio::sema
     {
         if (valueType && valueType->kind() == TypeKind::Nullable)
             return valueType;
-        return makeType<NullableType>(std::move(valueType));
+        InternKey key{ TypeKind::Nullable, 0, {}, { valueType.Get() } };
+        return intern<NullableType>(std::move(key), std::move(valueType));
     }
 
     Ref<Type> TypeContext::getOrCreateArrayType(Ref<Type> elementType, ArrayType::ArrayKind arrayKind,
                                                 size_t size, Ref<Type> extentType,
                                                 bool hasInferredExtent)
     {
-        return makeType<ArrayType>(std::move(elementType), arrayKind, size,
-                                   std::move(extentType), hasInferredExtent);
+        // A fixed array without a known size takes its extent from the first
+        // initializer it is matched against, so it cannot be shared.
+        if (arrayKind != ArrayType::ArrayKind::Dynamic && size == 0)
+        {
+            return makeType<ArrayType>(std::move(elementType), arrayKind, size,
+                                       std::move(extentType), hasInferredExtent);
+        }
+        InternKey key{
+            TypeKind::Array,
+            (static_cast<uint64_t>(size) << 8u) | (static_cast<uint64_t>(arrayKind) << 1u) | (hasInferredExtent ? 1u : 0u),
+            {},
+            { elementType.Get(), extentType.Get() }
+        };
+        return intern<ArrayType>(std::move(key), std::move(elementType), arrayKind, size,
+                                 std::move(extentType), hasInferredExtent);
     }
     
     Ref<Type> TypeContext::getOrCreateDictionaryType(Ref<Type> keyType, Ref<Type> valueType, bool isOrdered)
     {
-        return makeType<DictionaryType>(std::move(keyType), std::move(valueType), isOrdered);
+        // Empty dictionary literals start with unknown key/value types that
+        // are filled in from the declaration they initialize.
+        if ((keyType && keyType->isUnknown()) || (valueType && valueType->isUnknown()))
+            return makeType<DictionaryType>(std::move(keyType), std::move(valueType), isOrdered);
+        InternKey key{ TypeKind::Dictionary, isOrdered ? 1u : 0u, {}, { keyType.Get(), valueType.Get() } };
+        return intern<DictionaryType>(std::move(key), std::move(keyType), std::move(valueType), isOrdered);
     }
 
     Ref<Type> TypeContext::getOrCreateTreeType(Ref<Type> keyType, Ref<Type> valueType)
     {
-        return makeType<DictionaryType>(std::move(keyType), std::move(valueType), true);
+        return getOrCreateDictionaryType(std::move(keyType), std::move(valueType), true);
     }
 
     Ref<Type> TypeContext::getOrCreateAsyncTaskType(Ref<Type> valueType)
     {
-        return makeType<AsyncTaskType>(std::move(valueType));
+        InternKey key{ TypeKind::AsyncTask, 0, {}, { valueType.Get() } };
+        return intern<AsyncTaskType>(std::move(key), std::move(valueType));
     }
 
     Ref<Type> TypeContext::getOrCreateFunctionType(Ref<Type> returnType, std::vector<Ref<Type>> paramTypes, bool hasParameterPack)
     {
-        return makeType<FunctionType>(std::move(paramTypes), std::move(returnType), hasParameterPack);
+        InternKey key{ TypeKind::Function, hasParameterPack ? 1u : 0u, {}, {} };
+        key.parts.reserve(paramTypes.size() + 1);
+        key.parts.push_back(returnType.Get());
+        for (const auto& paramType : paramTypes)
+            key.parts.push_back(paramType.Get());
+        return intern<FunctionType>(std::move(key), std::move(paramTypes), std::move(returnType), hasParameterPack);
     }
 
     Ref<Type> TypeContext::getOrCreateStructType(const std::string& name,
@@ -104,7 +143,8 @@ namespace wio::sema
 
     Ref<Type> TypeContext::getOrCreateConstValueType(std::string value, Ref<Type> valueType)
     {
-        return makeType<ConstValueType>(std::move(value), std::move(valueType));
+        InternKey key{ TypeKind::ConstValue, 0, value, { valueType.Get() } };
+        return intern<ConstValueType>(std::move(key), std::move(value), std::move(valueType));
     }
 
     Ref<Type> TypeContext::getOrCreateGenericParameterPackType(const std::string& name)
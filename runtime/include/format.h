@@ -1,9 +1,13 @@
 #pragma once
 
+#include <array>
+#include <charconv>
+#include <cstddef>
 #include <iterator>
 #include <sstream>
 #include <string>
 #include <string_view>
+#include <tuple>
 #include <type_traits>
 #include <utility>
 
@@ -125,4 +129,120 @@ namespace wio::runtime
         detail::appendFormatLiterals(stream, format, std::forward<TArgs>(args)...);
         return stream.str();
     }
+
+    namespace detail
+    {
+        // A piece of a Concat result whose length is known before anything
+        // is appended. Text pieces view their argument, which outlives the
+        // Concat call; numbers are formatted into an inline buffer.
+        class ConcatTextPiece
+        {
+        public:
+            explicit ConcatTextPiece(std::string_view text) noexcept : text_(text) {}
+
+            [[nodiscard]] std::size_t size() const noexcept { return text_.size(); }
+            void appendTo(std::string& out) const { out.append(text_); }
+
+        private:
+            std::string_view text_;
+        };
+
+        class ConcatNumberPiece
+        {
+        public:
+            template <typename TNumber>
+            explicit ConcatNumberPiece(TNumber value) noexcept
+            {
+                std::to_chars_result result{};
+                if constexpr (std::is_floating_point_v<TNumber>)
+                    // Matches the default std::ostream float format (%g).
+                    result = std::to_chars(digits_.data(), digits_.data() + digits_.size(), value,
+                                           std::chars_format::general, 6);
+                else
+                    result = std::to_chars(digits_.data(), digits_.data() + digits_.size(), value);
+                size_ = static_cast<std::size_t>(result.ptr - digits_.data());
+            }
+
+            [[nodiscard]] std::size_t size() const noexcept { return size_; }
+            void appendTo(std::string& out) const { out.append(digits_.data(), size_); }
+
+        private:
+            std::array<char, 32> digits_{};
+            std::size_t size_ = 0;
+        };
+
+        class ConcatCharPiece
+        {
+        public:
+            explicit ConcatCharPiece(char value) noexcept : value_(value) {}
+
+            [[nodiscard]] static constexpr std::size_t size() noexcept { return 1; }
+            void appendTo(std::string& out) const { out.push_back(value_); }
+
+        private:
+            char value_;
+        };
+
+        class ConcatOwnedPiece
+        {
+        public:
+            explicit ConcatOwnedPiece(std::string text) noexcept : text_(std::move(text)) {}
+
+            [[nodiscard]] std::size_t size() const noexcept { return text_.size(); }
+            void appendTo(std::string& out) const { out.append(text_); }
+
+        private:
+            std::string text_;
+        };
+
+        template <typename TValue>
+        auto makeConcatPiece(TValue&& value)
+        {
+            using RawValue = std::remove_cvref_t<TValue>;
+
+            if constexpr (std::is_same_v<RawValue, std::string> || std::is_same_v<RawValue, std::string_view>)
+                return ConcatTextPiece(value);
+            else if constexpr (std::is_same_v<std::decay_t<TValue>, const char*> ||
+                               std::is_same_v<std::decay_t<TValue>, char*>)
+                return ConcatTextPiece(value != nullptr ? std::string_view(value) : std::string_view("null"));
+            else if constexpr (std::is_same_v<RawValue, bool>)
+                return ConcatTextPiece(value ? "true" : "false");
+            else if constexpr (std::is_same_v<RawValue, char>)
+                return ConcatCharPiece(value);
+            else if constexpr (std::is_same_v<RawValue, signed char>)
+                return ConcatNumberPiece(static_cast<int>(value));
+            else if constexpr (std::is_same_v<RawValue, unsigned char>)
+                return ConcatNumberPiece(static_cast<unsigned int>(value));
+            else if constexpr ((std::is_integral_v<RawValue> && !std::is_same_v<RawValue, wchar_t> &&
+                                !std::is_same_v<RawValue, char8_t> && !std::is_same_v<RawValue, char16_t> &&
+                                !std::is_same_v<RawValue, char32_t>) ||
+                               std::is_same_v<RawValue, float> || std::is_same_v<RawValue, double>)
+                return ConcatNumberPiece(value);
+            else if constexpr (std::is_enum_v<RawValue>)
+                return makeConcatPiece(static_cast<std::underlying_type_t<RawValue>>(value));
+            else
+            {
+                std::ostringstream stream;
+                appendFormattedValue(stream, std::forward<TValue>(value));
+                return ConcatOwnedPiece(std::move(stream).str());
+            }
+        }
+    }
+
+    // Joins string-convertible values into one string, formatting each like
+    // Format's "{}" does. The result length is computed first, so it is
+    // allocated once; numbers are written with std::to_chars. Generated code
+    // lowers string interpolation and `+` chains on strings to one call.
+    template <typename... TValues>
+    std::string Concat(TValues&&... values)
+    {
+        const std::tuple pieces{ detail::makeConcatPiece(std::forward<TValues>(values))... };
+        std::string result;
+        std::apply([&](const auto&... piece)
+        {
+            result.reserve((std::size_t{0} + ... + piece.size()));
+            (piece.appendTo(result), ...);
+        }, pieces);
+        return result;
+    }
 }
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace wio::runtime
+{
+    template <typename Signature>
+    class FunctionRef;
+
+    // Non-owning view of a callable, used for Wio callback parameters that
+    // the compiler has proven are only invoked during the call. Binding a
+    // lambda or a std::function never allocates, and a call is one indirect
+    // jump through a plain function pointer instead of std::function's
+    // type-erased manager. The referenced callable must outlive the view,
+    // which holds for arguments bound at the call site.
+    template <typename R, typename... Args>
+    class FunctionRef<R(Args...)>
+    {
+    public:
+        template <typename F>
+            requires (!std::is_same_v<std::remove_cvref_t<F>, FunctionRef> &&
+                      std::is_invocable_r_v<R, F&, Args...>)
+        FunctionRef(F&& callable) noexcept // NOLINT(google-explicit-constructor)
+        {
+            using Callable = std::remove_reference_t<F>;
+            if constexpr (std::is_function_v<Callable>)
+            {
+                target_.function = reinterpret_cast<void (*)()>(&callable);
+                invoke_ = [](Target target, Args... args) -> R
+                {
+                    return std::invoke(reinterpret_cast<Callable*>(target.function), std::forward<Args>(args)...);
+                };
+            }
+            else
+            {
+                target_.object = const_cast<void*>(static_cast<const void*>(std::addressof(callable)));
+                invoke_ = [](Target target, Args... args) -> R
+                {
+                    return std::invoke(*static_cast<Callable*>(target.object), std::forward<Args>(args)...);
+                };
+            }
+        }
+
+        FunctionRef(const FunctionRef&) noexcept = default;
+        FunctionRef& operator=(const FunctionRef&) noexcept = default;
+
+        R operator()(Args... args) const
+        {
+            return invoke_(target_, std::forward<Args>(args)...);
+        }
+
+    private:
+        union Target
+        {
+            void* object;
+            void (*function)();
+        };
+
+        Target target_{};
+        R (*invoke_)(Target, Args...) = nullptr;
+    };
+}
@@ -1149,6 +1149,16 @@ namespace wio::intrinsics
         return static_cast<typename TTree::key_type>(std::forward<TFallback>(fallback));
     }
 
+    // Calls `visit` for each entry with from <= key < to, in key order,
+    // walking the tree in place from lower_bound(from).
+    template <typename TTree, typename TKey, typename TVisit>
+    inline void TreeScanRange(const TTree& values, const TKey& from, const TKey& to, TVisit&& visit)
+    {
+        const auto& compare = values.key_comp();
+        for (auto it = values.lower_bound(from); it != values.end() && compare(it->first, to); ++it)
+            visit(it->first, it->second);
+    }
+
     inline bool StringContains(const std::string& value, const std::string& needle)
     {
         return value.find(needle) != std::string::npos;
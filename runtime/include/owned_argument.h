@@ -0,0 +1,17 @@
+#pragma once
+
+#include <type_traits>
+#include <utility>
+
+namespace wio::runtime
+{
+    // Copies an argument bound to a const-reference parameter when the
+    // callee could otherwise watch it change during the call: a global, a
+    // member of a shared object, or storage also passed by `ref`. Rvalues
+    // are moved, so the callee always reads a value only it can see.
+    template <typename T>
+    std::decay_t<T> OwnedArgument(T&& value)
+    {
+        return std::forward<T>(value);
+    }
+}
@@ -761,7 +761,48 @@ namespace wio::runtime
     {
         return Ref<T>(static_cast<T*>(value.Get()));
     }
-    
+
+    // ============================================================
+    // Stack objects
+    // ============================================================
+
+    /**
+     * Inline storage for a Wio object that semantic analysis proved never
+     * escapes the scope creating it: every use is a field access or method
+     * call, and none of the object's methods take a reference to `self`.
+     *
+     * No Ref is ever formed, so the reference counts stay untouched. Leaving
+     * the scope runs the same OnZeroStrong() hook and destructor that
+     * releasing the last Ref would. Like a Ref, a `let` binding may still
+     * mutate the object, hence the mutable storage.
+     */
+    template <typename T>
+    class StackObject
+    {
+    public:
+        template <typename... Args>
+        explicit StackObject(Args&&... args)
+            : m_Object(std::forward<Args>(args)...)
+        {
+        }
+
+        StackObject(const StackObject&) = delete;
+        StackObject& operator=(const StackObject&) = delete;
+        StackObject(StackObject&&) = delete;
+        StackObject& operator=(StackObject&&) = delete;
+
+        ~StackObject()
+        {
+            static_cast<RefCountedObject&>(m_Object).OnZeroStrong();
+        }
+
+        [[nodiscard]] T* operator->() const noexcept { return &m_Object; }
+        [[nodiscard]] T& operator*() const noexcept { return m_Object; }
+
+    private:
+        mutable T m_Object;
+    };
+
     // ============================================================
     // WeakRef
     // ============================================================
@@ -1,7 +1,11 @@
 #pragma once
 
+#include "any.h"
+
 #include <algorithm>
+#include <array>
 #include <atomic>
+#include <bit>
 #include <chrono>
 #include <condition_variable>
 #include <coroutine>
@@ -11,6 +15,7 @@
 #include <deque>
 #include <exception>
 #include <functional>
+#include <limits>
 #include <memory>
 #include <mutex>
 #include <optional>
@@ -53,11 +58,62 @@ namespace wio::runtime
         AsyncIoQueueFull() : std::runtime_error("asynchronous I/O queue is full") {}
     };
 
+    // Continuation scheduler. Each worker owns a bounded lock-free run queue
+    // plus a LIFO slot holding the continuation it most recently made ready,
+    // so a resumed awaiter usually runs next on the same thread while its
+    // data is still hot. Idle workers steal from the head of other run
+    // queues. Threads outside the pool publish through a shared injection
+    // queue, and delayed work lives in a hierarchical timer wheel serviced
+    // by its own thread, so ready work never pays for deadline ordering.
     class AsyncScheduler final
     {
     public:
         using Clock = std::chrono::steady_clock;
 
+        // Handle for work armed with PostAfter. Cancelling an armed timer
+        // unlinks it from the wheel and releases its action immediately, so
+        // abandoned deadlines do not accumulate until they would have fired.
+        class Timer final
+        {
+        public:
+            // Returns true when this call prevented the action from running.
+            bool Cancel() noexcept
+            {
+                int expected = armed;
+                if (state_.compare_exchange_strong(expected, cancelled, std::memory_order_acq_rel))
+                {
+                    scheduler_->CancelTimer(*this);
+                    return true;
+                }
+                expected = queued;
+                return state_.compare_exchange_strong(expected, cancelled, std::memory_order_acq_rel);
+            }
+
+            bool Cancelled() const noexcept
+            {
+                return state_.load(std::memory_order_acquire) == cancelled;
+            }
+
+        private:
+            friend class AsyncScheduler;
+
+            // armed: linked into the wheel; queued: handed to the workers;
+            // finished: the action ran or was released by shutdown.
+            enum State : int { armed, queued, cancelled, finished };
+
+            AsyncScheduler* scheduler_ = nullptr;
+            std::function<void()> action_;
+            // The wheel owns an armed timer, so a caller may drop the handle.
+            std::shared_ptr<Timer> self_;
+            Timer* previous_ = nullptr;
+            Timer* next_ = nullptr;
+            std::uint64_t deadline_ = 0;
+            std::uint32_t level_ = 0;
+            std::uint32_t slot_ = 0;
+            bool linked_ = false;
+            std::atomic<int> state_{armed};
+        };
+
         explicit AsyncScheduler(std::size_t workerCount = 0)
         {
             if (workerCount == 0)
@@ -66,29 +122,105 @@ namespace wio::runtime
                 workerCount = hardware == 0 ? 2 : hardware;
             }
             workerCount = workerCount < 2 ? 2 : workerCount;
+            queues_.reserve(workerCount);
+            for (std::size_t index = 0; index < workerCount; ++index)
+                queues_.push_back(std::make_unique<WorkerQueue>());
             workers_.reserve(workerCount);
             for (std::size_t index = 0; index < workerCount; ++index)
-                workers_.emplace_back([this] { RunWorker(); });
+                workers_.emplace_back([this, index] { RunWorker(index); });
+            timerThread_ = std::thread([this] { RunTimers(); });
         }
 
         AsyncScheduler(const AsyncScheduler&) = delete;
         AsyncScheduler& operator=(const AsyncScheduler&) = delete;
 
-        ~AsyncScheduler() { Shutdown(); }
+        ~AsyncScheduler()
+        {
+            Shutdown();
+            std::unique_lock shutdownLock(shutdownMutex_);
+            for (auto* work : injected_)
+                delete work;
+            for (auto& queue : queues_)
+            {
+                delete queue->lifo;
+                while (auto* work = queue->Pop())
+                    delete work;
+            }
+            std::lock_guard timerLock(timerMutex_);
+            while (auto* timer = wheel_.TakeAny())
+                timer->self_.reset();
+        }
 
         bool Post(std::function<void()> action)
         {
-            return PostAt(Clock::now(), std::move(action), nullptr);
+            if (stopping_.load(std::memory_order_acquire))
+                return false;
+            auto* work = new Work{std::move(action), {}};
+            pending_.fetch_add(1, std::memory_order_relaxed);
+
+            auto& context = CurrentWorker();
+            if (context.scheduler == this)
+            {
+                auto& queue = *queues_[context.index];
+                auto* displaced = queue.lifo;
+                queue.lifo = work;
+                if (!displaced)
+                    return true;
+                PushLocal(queue, displaced);
+            }
+            else
+            {
+                std::lock_guard lock(injectMutex_);
+                if (stopping_.load(std::memory_order_acquire))
+                {
+                    pending_.fetch_sub(1, std::memory_order_relaxed);
+                    delete work;
+                    return false;
+                }
+                injected_.push_back(work);
+                injectedCount_.fetch_add(1, std::memory_order_release);
+            }
+            WakeIdleWorker();
+            return true;
         }
 
-        std::shared_ptr<std::atomic<bool>> PostAfter(
+        std::shared_ptr<Timer> PostAfter(
             std::chrono::milliseconds delay,
             std::function<void()> action)
         {
-            auto cancelled = std::make_shared<std::atomic<bool>>(false);
-            if (!PostAt(Clock::now() + delay, std::move(action), cancelled))
-                return nullptr;
-            return cancelled;
+            auto timer = std::make_shared<Timer>();
+            timer->scheduler_ = this;
+            timer->action_ = std::move(action);
+            const auto target = std::chrono::ceil<std::chrono::milliseconds>(
+                Clock::now() - origin_ + (delay.count() < 0 ? std::chrono::milliseconds(0) : delay));
+            bool wake = false;
+            {
+                std::lock_guard lock(timerMutex_);
+                if (stopping_.load(std::memory_order_acquire))
+                    return nullptr;
+                pending_.fetch_add(1, std::memory_order_relaxed);
+                const auto deadline = std::min(
+                    static_cast<std::uint64_t>(target.count()), wheel_.elapsed + TimerWheel::maximumDelay);
+                if (deadline <= wheel_.elapsed)
+                {
+                    timer->state_.store(Timer::queued, std::memory_order_relaxed);
+                    Inject(new Work{std::move(timer->action_), timer});
+                    return timer;
+                }
+                timer->deadline_ = deadline;
+                timer->self_ = timer;
+                wheel_.Insert(*timer);
+                // The timer thread only needs a wakeup when this deadline is
+                // earlier than the one it is already sleeping towards.
+                if (deadline < timerWakeTick_)
+                {
+                    timerWakeTick_ = deadline;
+                    wake = true;
+                }
+            }
+            if (wake)
+                timerChanged_.notify_one();
+            return timer;
         }
 
         std::size_t WorkerCount() const noexcept
@@ -98,24 +230,54 @@ namespace wio::runtime
 
         std::size_t PendingCount() const noexcept
         {
-            std::lock_guard lock(mutex_);
-            return work_.size();
+            return pending_.load(std::memory_order_acquire);
         }
 
         bool IsRunning() const noexcept
         {
-            std::lock_guard lock(mutex_);
-            return !stopping_;
+            return !stopping_.load(std::memory_order_acquire);
+        }
+
+        std::size_t TimerCount() const
+        {
+            std::lock_guard lock(timerMutex_);
+            return wheel_.size;
+        }
+
+        // Called before the current thread blocks synchronously. A worker's
+        // LIFO slot cannot be stolen, so its continuation moves to the run
+        // queue where an idle worker can take it; otherwise a task blocking on
+        // the continuation it just resumed would wait forever.
+        static void PublishBeforeBlocking()
+        {
+            const auto context = CurrentWorker();
+            if (!context.scheduler)
+                return;
+            auto& queue = *context.scheduler->queues_[context.index];
+            if (!queue.lifo)
+                return;
+            auto* work = queue.lifo;
+            queue.lifo = nullptr;
+            context.scheduler->PushLocal(queue, work);
+            context.scheduler->WakeIdleWorker();
         }
 
         void Shutdown() noexcept
         {
             std::unique_lock shutdownLock(shutdownMutex_);
             {
-                std::lock_guard lock(mutex_);
-                stopping_ = true;
+                // Taking both publication locks orders the flag against
+                // in-flight injections and timer arms.
+                std::scoped_lock lock(injectMutex_, timerMutex_);
+                stopping_.store(true, std::memory_order_release);
             }
-            changed_.notify_all();
+            timerChanged_.notify_all();
+            if (timerThread_.joinable() && timerThread_.get_id() != std::this_thread::get_id())
+                timerThread_.join();
+            {
+                std::lock_guard lock(parkMutex_);
+            }
+            parked_.notify_all();
             for (auto& worker : workers_)
             {
                 if (!worker.joinable())
@@ -130,78 +292,336 @@ namespace wio::runtime
     private:
         struct Work final
         {
-            Clock::time_point readyAt;
-            std::uint64_t sequence = 0;
             std::function<void()> action;
-            std::shared_ptr<std::atomic<bool>> cancelled;
+            // Set for expired timers, which may still be cancelled until a
+            // worker claims them.
+            std::shared_ptr<Timer> timer;
         };
 
-        struct LaterWork final
-        {
-            bool operator()(const Work& left, const Work& right) const noexcept
+        // Hierarchical timing wheel with one-millisecond ticks. Six levels of
+        // 64 slots cover roughly 2.2 years; each slot is an intrusive list and
+        // each level keeps an occupancy mask, so arming, cancelling, and
+        // finding the next deadline are constant time. A timer lives on the
+        // level of the highest 6-bit group in which its deadline differs from
+        // the current tick and cascades towards level 0 as the wheel reaches
+        // its slot. Guarded by timerMutex_.
+        struct TimerWheel final
+        {
+            static constexpr std::uint32_t levels = 6;
+            static constexpr std::uint32_t slotBits = 6;
+            static constexpr std::uint64_t slotMask = (1ull << slotBits) - 1;
+            static constexpr std::uint64_t maximumDelay = (1ull << (levels * slotBits)) - 1;
+
+            // Each slot is a FIFO list, so timers due on the same tick expire
+            // in the order they were armed.
+            std::array<std::array<Timer*, slotMask + 1>, levels> slots{};
+            std::array<std::array<Timer*, slotMask + 1>, levels> tails{};
+            std::array<std::uint64_t, levels> occupied{};
+            std::uint64_t elapsed = 0;
+            std::size_t size = 0;
+
+            // Requires deadline_ > elapsed.
+            void Insert(Timer& timer) noexcept
             {
-                if (left.readyAt != right.readyAt)
-                    return left.readyAt > right.readyAt;
-                return left.sequence > right.sequence;
+                auto masked = (elapsed ^ timer.deadline_) | slotMask;
+                if (masked > maximumDelay)
+                    masked = maximumDelay;
+                const auto level = static_cast<std::uint32_t>((63 - std::countl_zero(masked)) / slotBits);
+                const auto slot = static_cast<std::uint32_t>((timer.deadline_ >> (level * slotBits)) & slotMask);
+                auto*& tail = tails[level][slot];
+                timer.level_ = level;
+                timer.slot_ = slot;
+                timer.previous_ = tail;
+                timer.next_ = nullptr;
+                if (tail)
+                    tail->next_ = &timer;
+                else
+                    slots[level][slot] = &timer;
+                tail = &timer;
+                occupied[level] |= 1ull << slot;
+                timer.linked_ = true;
+                ++size;
+            }
+
+            void Remove(Timer& timer) noexcept
+            {
+                auto*& head = slots[timer.level_][timer.slot_];
+                if (timer.previous_)
+                    timer.previous_->next_ = timer.next_;
+                else
+                    head = timer.next_;
+                if (timer.next_)
+                    timer.next_->previous_ = timer.previous_;
+                else
+                    tails[timer.level_][timer.slot_] = timer.previous_;
+                if (!head)
+                    occupied[timer.level_] &= ~(1ull << timer.slot_);
+                timer.previous_ = nullptr;
+                timer.next_ = nullptr;
+                timer.linked_ = false;
+                --size;
+            }
+
+            // The start tick of the earliest occupied slot. Lower levels always
+            // expire before higher ones, so the first occupied level decides.
+            bool NextExpiration(std::uint32_t& level, std::uint32_t& slot, std::uint64_t& deadline) const noexcept
+            {
+                for (level = 0; level < levels; ++level)
+                {
+                    if (!occupied[level])
+                        continue;
+                    const auto shift = level * slotBits;
+                    const auto current = static_cast<int>((elapsed >> shift) & slotMask);
+                    const auto distance = std::countr_zero(std::rotr(occupied[level], current));
+                    slot = static_cast<std::uint32_t>((current + distance) & slotMask);
+                    const auto levelRange = 1ull << (shift + slotBits);
+                    deadline = (elapsed & ~(levelRange - 1)) + (static_cast<std::uint64_t>(slot) << shift);
+                    // Only the top level can wrap behind the current tick.
+                    if (deadline <= elapsed && level != 0)
+                        deadline += levelRange;
+                    return true;
+                }
+                return false;
+            }
+
+            Timer* TakeSlot(const std::uint32_t level, const std::uint32_t slot) noexcept
+            {
+                auto* head = slots[level][slot];
+                slots[level][slot] = nullptr;
+                tails[level][slot] = nullptr;
+                occupied[level] &= ~(1ull << slot);
+                for (auto* timer = head; timer; timer = timer->next_)
+                {
+                    timer->linked_ = false;
+                    --size;
+                }
+                return head;
+            }
+
+            Timer* TakeAny() noexcept
+            {
+                std::uint32_t level = 0;
+                std::uint32_t slot = 0;
+                std::uint64_t deadline = 0;
+                if (!NextExpiration(level, slot, deadline))
+                    return nullptr;
+                auto* timer = slots[level][slot];
+                Remove(*timer);
+                return timer;
             }
         };
 
-        bool PostAt(
-            Clock::time_point readyAt,
-            std::function<void()> action,
-            std::shared_ptr<std::atomic<bool>> cancelled)
+        // Single-producer, multi-consumer ring. Only the owning worker pushes
+        // at the tail; the owner and thieves claim from the head with a CAS.
+        // A claimed slot cannot have been overwritten: the owner only reuses
+        // a slot once the head has moved past it.
+        struct WorkerQueue final
         {
+            static constexpr std::size_t capacity = 256;
+
+            std::array<std::atomic<Work*>, capacity> slots{};
+            alignas(64) std::atomic<std::uint64_t> head{0};
+            alignas(64) std::atomic<std::uint64_t> tail{0};
+            // Owner-only; never stolen.
+            Work* lifo = nullptr;
+            std::uint32_t lifoStreak = 0;
+
+            bool TryPush(Work* work) noexcept
             {
-                std::lock_guard lock(mutex_);
-                if (stopping_)
+                const auto currentTail = tail.load(std::memory_order_relaxed);
+                if (currentTail - head.load(std::memory_order_acquire) >= capacity)
                     return false;
-                work_.push(Work{readyAt, nextSequence_++, std::move(action), std::move(cancelled)});
+                slots[currentTail % capacity].store(work, std::memory_order_relaxed);
+                tail.store(currentTail + 1, std::memory_order_release);
+                return true;
             }
-            changed_.notify_one();
-            return true;
+
+            Work* Pop() noexcept
+            {
+                auto currentHead = head.load(std::memory_order_acquire);
+                for (;;)
+                {
+                    if (currentHead == tail.load(std::memory_order_acquire))
+                        return nullptr;
+                    auto* work = slots[currentHead % capacity].load(std::memory_order_relaxed);
+                    if (head.compare_exchange_weak(currentHead, currentHead + 1,
+                            std::memory_order_acq_rel, std::memory_order_acquire))
+                        return work;
+                }
+            }
+
+            bool Empty() const noexcept
+            {
+                return head.load(std::memory_order_acquire) == tail.load(std::memory_order_acquire);
+            }
+        };
+
+        struct WorkerContext final
+        {
+            AsyncScheduler* scheduler = nullptr;
+            std::size_t index = 0;
+        };
+
+        // Runs the LIFO slot at most this many times in a row before taking
+        // queued work, so a task that keeps re-posting itself cannot starve
+        // its siblings.
+        static constexpr std::uint32_t maxLifoStreak = 3;
+        // Every Nth dispatch a worker checks the injection queue first, so
+        // work published from outside the pool is not starved by local work.
+        static constexpr std::uint32_t injectionInterval = 61;
+
+        static WorkerContext& CurrentWorker() noexcept
+        {
+            thread_local WorkerContext context;
+            return context;
         }
 
-        void RunWorker()
+        void PushLocal(WorkerQueue& queue, Work* work)
         {
+            if (queue.TryPush(work))
+                return;
+            // A full ring spills half of its oldest work plus the new item to
+            // the injection queue, where any worker can pick it up.
+            std::lock_guard lock(injectMutex_);
+            for (std::size_t moved = 0; moved < WorkerQueue::capacity / 2; ++moved)
+            {
+                auto* spilled = queue.Pop();
+                if (!spilled)
+                    break;
+                injected_.push_back(spilled);
+                injectedCount_.fetch_add(1, std::memory_order_release);
+            }
+            injected_.push_back(work);
+            injectedCount_.fetch_add(1, std::memory_order_release);
+        }
+
+        Work* PopInjected()
+        {
+            if (injectedCount_.load(std::memory_order_acquire) == 0)
+                return nullptr;
+            std::lock_guard lock(injectMutex_);
+            if (injected_.empty())
+                return nullptr;
+            auto* work = injected_.front();
+            injected_.pop_front();
+            injectedCount_.fetch_sub(1, std::memory_order_release);
+            return work;
+        }
+
+        Work* Steal(const std::size_t thief)
+        {
+            const auto count = queues_.size();
+            const auto start = static_cast<std::size_t>(
+                stealCursor_.fetch_add(1, std::memory_order_relaxed)) % count;
+            for (std::size_t offset = 0; offset < count; ++offset)
+            {
+                const auto victim = (start + offset) % count;
+                if (victim == thief)
+                    continue;
+                if (auto* work = queues_[victim]->Pop())
+                    return work;
+            }
+            return nullptr;
+        }
+
+        Work* NextWork(const std::size_t index, std::uint32_t& tick)
+        {
+            auto& queue = *queues_[index];
+            if (++tick % injectionInterval == 0)
+            {
+                if (auto* work = PopInjected())
+                    return work;
+            }
+            if (queue.lifo && queue.lifoStreak < maxLifoStreak)
+            {
+                auto* work = queue.lifo;
+                queue.lifo = nullptr;
+                ++queue.lifoStreak;
+                return work;
+            }
+            queue.lifoStreak = 0;
+            if (queue.lifo)
+            {
+                // The streak is over: the slot joins the FIFO order behind
+                // the work it was starving.
+                auto* work = queue.lifo;
+                queue.lifo = nullptr;
+                PushLocal(queue, work);
+            }
+            if (auto* work = queue.Pop())
+                return work;
+            if (auto* work = PopInjected())
+                return work;
+            return Steal(index);
+        }
+
+        bool HasVisibleWork() const noexcept
+        {
+            if (injectedCount_.load(std::memory_order_acquire) != 0)
+                return true;
+            for (const auto& queue : queues_)
+            {
+                if (!queue->Empty())
+                    return true;
+            }
+            return false;
+        }
+
+        void WakeIdleWorker()
+        {
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (idleWorkers_.load(std::memory_order_seq_cst) == 0)
+                return;
+            {
+                std::lock_guard lock(parkMutex_);
+            }
+            parked_.notify_one();
+        }
+
+        void RunWorker(const std::size_t index)
+        {
+            CurrentWorker() = WorkerContext{this, index};
+            std::uint32_t tick = 0;
             for (;;)
             {
-                std::function<void()> action;
+                auto* work = NextWork(index, tick);
+                if (!work)
                 {
-                    std::unique_lock lock(mutex_);
-                    for (;;)
+                    std::unique_lock lock(parkMutex_);
+                    idleWorkers_.fetch_add(1, std::memory_order_seq_cst);
+                    std::atomic_thread_fence(std::memory_order_seq_cst);
+                    if (!HasVisibleWork())
                     {
-                        if (stopping_ && work_.empty())
-                            return;
-                        if (work_.empty())
-                        {
-                            changed_.wait(lock);
-                            continue;
-                        }
-
-                        if (work_.top().cancelled &&
-                            work_.top().cancelled->load(std::memory_order_acquire))
+                        // Shutdown drains: a worker leaves only after the timer
+                        // thread has flushed its queue and nothing is left to
+                        // run or steal.
+                        if (timersDrained_.load(std::memory_order_acquire))
                         {
-                            work_.pop();
-                            continue;
-                        }
-
-                        const auto now = Clock::now();
-                        const auto readyAt = work_.top().readyAt;
-                        if (readyAt > now && !stopping_)
-                        {
-                            changed_.wait_until(lock, readyAt);
-                            continue;
+                            idleWorkers_.fetch_sub(1, std::memory_order_seq_cst);
+                            lock.unlock();
+                            parked_.notify_all();
+                            return;
                         }
-
-                        action = work_.top().action;
-                        work_.pop();
-                        break;
+                        parked_.wait(lock);
                     }
+                    idleWorkers_.fetch_sub(1, std::memory_order_seq_cst);
+                    continue;
                 }
 
+                pending_.fetch_sub(1, std::memory_order_relaxed);
+                if (work->timer)
+                {
+                    int expected = Timer::queued;
+                    if (!work->timer->state_.compare_exchange_strong(
+                            expected, Timer::finished, std::memory_order_acq_rel))
+                    {
+                        delete work;
+                        continue;
+                    }
+                }
                 try
                 {
-                    action();
+                    work->action();
                 }
                 catch (...)
                 {
@@ -209,16 +629,137 @@ namespace wio::runtime
                     // actions are isolated so one bad native callback cannot
                     // terminate the worker pool.
                 }
+                delete work;
             }
         }
 
-        mutable std::mutex mutex_;
-        std::mutex shutdownMutex_;
-        std::condition_variable changed_;
-        std::priority_queue<Work, std::vector<Work>, LaterWork> work_;
+        void Inject(Work* work)
+        {
+            {
+                std::lock_guard lock(injectMutex_);
+                injected_.push_back(work);
+                injectedCount_.fetch_add(1, std::memory_order_release);
+            }
+            WakeIdleWorker();
+        }
+
+        void CancelTimer(Timer& timer) noexcept
+        {
+            std::function<void()> released;
+            std::shared_ptr<Timer> owner;
+            {
+                std::lock_guard lock(timerMutex_);
+                if (!timer.linked_)
+                    return;
+                wheel_.Remove(timer);
+                released = std::move(timer.action_);
+                owner = std::move(timer.self_);
+                pending_.fetch_sub(1, std::memory_order_relaxed);
+            }
+        }
+
+        // Hands an expired (or, during shutdown, any) unlinked timer to the
+        // workers unless a canceller claimed it first.
+        void Expire(Timer& timer)
+        {
+            auto owner = std::move(timer.self_);
+            int expected = Timer::armed;
+            if (!timer.state_.compare_exchange_strong(expected, Timer::queued, std::memory_order_acq_rel))
+            {
+                timer.action_ = nullptr;
+                pending_.fetch_sub(1, std::memory_order_relaxed);
+                return;
+            }
+            Inject(new Work{std::move(timer.action_), std::move(owner)});
+        }
+
+        std::uint64_t CurrentTick() const noexcept
+        {
+            return static_cast<std::uint64_t>(
+                std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now() - origin_).count());
+        }
+
+        void AdvanceTimers(const std::uint64_t now)
+        {
+            std::uint32_t level = 0;
+            std::uint32_t slot = 0;
+            std::uint64_t deadline = 0;
+            while (wheel_.NextExpiration(level, slot, deadline) && deadline <= now)
+            {
+                wheel_.elapsed = deadline;
+                auto* timer = wheel_.TakeSlot(level, slot);
+                while (timer)
+                {
+                    auto* next = timer->next_;
+                    timer->previous_ = nullptr;
+                    timer->next_ = nullptr;
+                    if (timer->deadline_ <= wheel_.elapsed)
+                        Expire(*timer);
+                    else
+                        wheel_.Insert(*timer);
+                    timer = next;
+                }
+            }
+            if (now > wheel_.elapsed)
+                wheel_.elapsed = now;
+        }
+
+        void RunTimers()
+        {
+            std::unique_lock lock(timerMutex_);
+            for (;;)
+            {
+                if (stopping_.load(std::memory_order_acquire))
+                {
+                    // Shutdown releases every armed timer immediately.
+                    while (auto* timer = wheel_.TakeAny())
+                        Expire(*timer);
+                    break;
+                }
+
+                AdvanceTimers(CurrentTick());
+                std::uint32_t level = 0;
+                std::uint32_t slot = 0;
+                std::uint64_t deadline = 0;
+                if (!wheel_.NextExpiration(level, slot, deadline))
+                {
+                    timerWakeTick_ = std::numeric_limits<std::uint64_t>::max();
+                    timerChanged_.wait(lock);
+                    continue;
+                }
+                timerWakeTick_ = deadline;
+                timerChanged_.wait_until(lock, origin_ + std::chrono::milliseconds(deadline));
+            }
+            timersDrained_.store(true, std::memory_order_release);
+            lock.unlock();
+            {
+                std::lock_guard parkLock(parkMutex_);
+            }
+            parked_.notify_all();
+        }
+
+        std::vector<std::unique_ptr<WorkerQueue>> queues_;
         std::vector<std::thread> workers_;
-        std::uint64_t nextSequence_ = 0;
-        bool stopping_ = false;
+        std::thread timerThread_;
+        std::mutex shutdownMutex_;
+
+        std::mutex injectMutex_;
+        std::deque<Work*> injected_;
+        std::atomic<std::size_t> injectedCount_{0};
+
+        const Clock::time_point origin_ = Clock::now();
+        mutable std::mutex timerMutex_;
+        std::condition_variable timerChanged_;
+        TimerWheel wheel_;
+        std::uint64_t timerWakeTick_ = std::numeric_limits<std::uint64_t>::max();
+
+        std::mutex parkMutex_;
+        std::condition_variable parked_;
+        std::atomic<std::size_t> idleWorkers_{0};
+        std::atomic<std::uint64_t> stealCursor_{0};
+        std::atomic<std::size_t> pending_{0};
+        std::atomic<bool> stopping_{false};
+        std::atomic<bool> timersDrained_{false};
     };
 
     class AsyncBlockingScheduler final
@@ -733,11 +1274,20 @@ namespace wio::runtime
                 std::coroutine_handle<> continuation)
             {
                 auto registration = std::make_shared<AsyncContinuationRegistration>(continuation);
+                if (!AddContinuation(registration))
+                    return nullptr;
+                return registration;
+            }
+
+            // Shares one registration across several states; the first
+            // completion resumes it and the rest are ignored.
+            bool AddContinuation(const std::shared_ptr<AsyncContinuationRegistration>& registration)
+            {
                 std::lock_guard lock(mutex);
                 if (completed)
-                    return nullptr;
+                    return false;
                 continuations.push_back(registration);
-                return registration;
+                return true;
             }
 
             std::shared_ptr<AsyncCancellationRegistration> AddCancellationCallback(
@@ -763,6 +1313,7 @@ namespace wio::runtime
             void Wait()
             {
                 Start();
+                AsyncScheduler::PublishBeforeBlocking();
                 std::unique_lock lock(mutex);
                 changed.wait(lock, [this] { return completed; });
             }
@@ -770,6 +1321,7 @@ namespace wio::runtime
             bool WaitFor(const std::chrono::milliseconds timeout)
             {
                 Start();
+                AsyncScheduler::PublishBeforeBlocking();
                 std::unique_lock lock(mutex);
                 return changed.wait_for(lock, timeout, [this] { return completed; });
             }
@@ -1265,7 +1817,8 @@ namespace wio::runtime
         {
             try
             {
-                co_await AsyncStateAwaiter{child};
+                AsyncStateAwaiter completion{child};
+                co_await completion;
             }
             catch (...)
             {
@@ -1393,7 +1946,7 @@ namespace wio::runtime
                 {
                     state->AddCancellationCallback([registration, timer]
                     {
-                        timer->store(true, std::memory_order_release);
+                        timer->Cancel();
                         registration->ResumeOnce();
                     });
                 }
@@ -1407,14 +1960,58 @@ namespace wio::runtime
         }
     };
 
+    // Suspends until a task completes or a deadline passes, whichever comes
+    // first. The deadline is a single wheel timer that is removed as soon as
+    // the task wins.
+    struct AsyncDeadlineAwaiter final
+    {
+        std::shared_ptr<detail::AsyncTaskStateBase> state;
+        std::chrono::milliseconds delay;
+        std::shared_ptr<AsyncScheduler::Timer> timer;
+        std::weak_ptr<detail::AsyncTaskStateBase> taskState;
+
+        bool await_ready() const { return state->Ready(); }
+        template<typename Promise>
+        bool await_suspend(std::coroutine_handle<Promise> continuation)
+        {
+            if constexpr (requires(Promise& promise) { promise.state; })
+                taskState = continuation.promise().state;
+
+            auto registration = state->AddContinuation(continuation);
+            if (!registration)
+                return false;
+            state->Start();
+            timer = DefaultAsyncScheduler().PostAfter(
+                delay, [registration] { registration->ResumeOnce(); });
+            if (!timer)
+                throw AsyncRuntimeStopped();
+
+            if constexpr (requires(Promise& promise) { promise.state; })
+            {
+                if (auto parent = taskState.lock())
+                    parent->AddCancellationCallback([registration] { registration->ResumeOnce(); });
+            }
+            return registration->Arm();
+        }
+        void await_resume() const
+        {
+            if (timer)
+                timer->Cancel();
+            if (auto parent = taskState.lock(); parent && parent->Cancelled())
+                throw AsyncCancelled();
+        }
+    };
+
     inline AsyncTask<void> AsyncYield()
     {
-        co_await AsyncScheduleAwaiter{};
+        AsyncScheduleAwaiter schedule{};
+        co_await schedule;
     }
 
     inline AsyncTask<void> AsyncSleep(const std::uint64_t milliseconds)
     {
-        co_await AsyncDelayAwaiter{std::chrono::milliseconds(milliseconds)};
+        AsyncDelayAwaiter delay{std::chrono::milliseconds(milliseconds)};
+        co_await delay;
     }
 
     template<typename T>
@@ -1480,13 +2077,15 @@ namespace wio::runtime
     template<typename T>
     AsyncTask<T> RunAsync(std::function<T()> action)
     {
-        co_await AsyncScheduleAwaiter{};
+        AsyncScheduleAwaiter schedule{};
+        co_await schedule;
         co_return action();
     }
 
     inline AsyncTask<void> RunAsync(std::function<void()> action)
     {
-        co_await AsyncScheduleAwaiter{};
+        AsyncScheduleAwaiter schedule{};
+        co_await schedule;
         action();
     }
 
@@ -1563,12 +2162,16 @@ namespace wio::runtime
     template<typename T>
     AsyncTask<T> RunBlockingAsync(std::function<T()> action)
     {
-        co_return co_await AsyncBlockingAwaiter<T>{std::move(action)};
+        // GCC 12 destroys a braced awaiter temporary twice when it is the
+        // operand of `co_return co_await`; a named awaiter avoids that.
+        AsyncBlockingAwaiter<T> awaiter{std::move(action)};
+        co_return co_await awaiter;
     }
 
     inline AsyncTask<void> RunBlockingAsync(std::function<void()> action)
     {
-        co_await AsyncBlockingAwaiter<void>{std::move(action)};
+        AsyncBlockingAwaiter<void> awaiter{std::move(action)};
+        co_await awaiter;
     }
 
     template<typename T>
@@ -1666,12 +2269,34 @@ namespace wio::runtime
     template<typename T>
     AsyncTask<T> RunIoAsync(std::function<T()> action)
     {
-        co_return co_await AsyncIoAwaiter<T>{std::move(action)};
+        // GCC 12 destroys a braced awaiter temporary twice when it is the
+        // operand of `co_return co_await`; a named awaiter avoids that.
+        AsyncIoAwaiter<T> awaiter{std::move(action)};
+        co_return co_await awaiter;
     }
 
     inline AsyncTask<void> RunIoAsync(std::function<void()> action)
     {
-        co_await AsyncIoAwaiter<void>{std::move(action)};
+        AsyncIoAwaiter<void> awaiter{std::move(action)};
+        co_await awaiter;
+    }
+
+    // Native async operations complete with their result struct boxed in a
+    // reference-counted `any` instead of a serialized string. An abandoned
+    // task still releases the box, and the one std-side consumer moves large
+    // buffers out of it without copying.
+    template<typename TResult>
+    Any MakeAsyncCompletion(TResult result)
+    {
+        return Any::Box(std::move(result));
+    }
+
+    template<typename TResult>
+    TResult& TakeAsyncCompletion(Any& completion, const char* domain)
+    {
+        if (!completion.IsBoxed<TResult>())
+            throw std::invalid_argument(std::string("invalid asynchronous ") + domain + " completion");
+        return completion.AsBoxed<TResult>();
     }
 
     template<typename T>
@@ -1713,6 +2338,43 @@ namespace wio::runtime
         }
     }
 
+    // Resumes once any of the states completes, with one registration shared
+    // by every candidate instead of polling them.
+    struct AsyncAnyReadyAwaiter final
+    {
+        std::vector<std::shared_ptr<detail::AsyncTaskStateBase>> states;
+        std::weak_ptr<detail::AsyncTaskStateBase> taskState;
+
+        bool await_ready() const
+        {
+            return std::any_of(states.begin(), states.end(), [](const auto& state) { return state->Ready(); });
+        }
+        template<typename Promise>
+        bool await_suspend(std::coroutine_handle<Promise> continuation)
+        {
+            if constexpr (requires(Promise& promise) { promise.state; })
+                taskState = continuation.promise().state;
+
+            auto registration = std::make_shared<detail::AsyncContinuationRegistration>(continuation);
+            for (const auto& state : states)
+            {
+                if (!state->AddContinuation(registration))
+                    return false;
+            }
+            if constexpr (requires(Promise& promise) { promise.state; })
+            {
+                if (auto parent = taskState.lock())
+                    parent->AddCancellationCallback([registration] { registration->ResumeOnce(); });
+            }
+            return registration->Arm();
+        }
+        void await_resume() const
+        {
+            if (auto parent = taskState.lock(); parent && parent->Cancelled())
+                throw AsyncCancelled();
+        }
+    };
+
     template<typename T>
     AsyncTask<std::size_t> WhenAny(std::vector<AsyncTask<T>> tasks)
     {
@@ -1728,14 +2390,19 @@ namespace wio::runtime
                 if (tasks[index].IsReady())
                     co_return index;
             }
-            co_await AsyncDelayAwaiter{std::chrono::milliseconds(1)};
+            AsyncAnyReadyAwaiter anyReady;
+            anyReady.states.reserve(tasks.size());
+            for (const auto& task : tasks)
+                anyReady.states.push_back(task.SharedState());
+            co_await anyReady;
         }
     }
 
     template<typename T>
     AsyncTask<T> Race(std::vector<AsyncTask<T>> tasks)
     {
-        const std::size_t index = co_await WhenAny(tasks);
+        auto first = WhenAny(tasks);
+        const std::size_t index = co_await first;
         try
         {
             T value = co_await tasks[index];
@@ -1757,7 +2424,8 @@ namespace wio::runtime
     template<typename T>
     AsyncTask<void> CancelAfter(AsyncTask<T> task, const std::uint64_t milliseconds)
     {
-        co_await AsyncDelayAwaiter{std::chrono::milliseconds(milliseconds)};
+        AsyncDelayAwaiter delay{std::chrono::milliseconds(milliseconds)};
+        co_await delay;
         if (!task.IsReady())
             task.Cancel();
     }
@@ -1765,32 +2433,24 @@ namespace wio::runtime
     template<typename T>
     AsyncTask<T> WithTimeout(AsyncTask<T> task, const std::uint64_t milliseconds)
     {
-        task.Start();
-        const auto deadline = AsyncScheduler::Clock::now() + std::chrono::milliseconds(milliseconds);
-        while (!task.IsReady())
+        AsyncDeadlineAwaiter deadline{task.SharedState(), std::chrono::milliseconds(milliseconds)};
+        co_await deadline;
+        if (!task.IsReady())
         {
-            if (AsyncScheduler::Clock::now() >= deadline)
-            {
-                task.Cancel();
-                throw AsyncTimeout();
-            }
-            co_await AsyncDelayAwaiter{std::chrono::milliseconds(1)};
+            task.Cancel();
+            throw AsyncTimeout();
         }
         co_return co_await task;
     }
 
     inline AsyncTask<void> WithTimeout(AsyncTask<void> task, const std::uint64_t milliseconds)
     {
-        task.Start();
-        const auto deadline = AsyncScheduler::Clock::now() + std::chrono::milliseconds(milliseconds);
-        while (!task.IsReady())
+        AsyncDeadlineAwaiter deadline{task.SharedState(), std::chrono::milliseconds(milliseconds)};
+        co_await deadline;
+        if (!task.IsReady())
         {
-            if (AsyncScheduler::Clock::now() >= deadline)
-            {
-                task.Cancel();
-                throw AsyncTimeout();
-            }
-            co_await AsyncDelayAwaiter{std::chrono::milliseconds(1)};
+            task.Cancel();
+            throw AsyncTimeout();
         }
         co_await task;
     }
@@ -3,10 +3,12 @@
 #include "std_async.h"
 #include "std_fs.h"
 
-#include <bit>
+#include <algorithm>
+#include <chrono>
+#include <coroutine>
 #include <cstdint>
 #include <functional>
-#include <stdexcept>
+#include <memory>
 #include <string>
 #include <utility>
 #include <vector>
@@ -27,103 +29,131 @@ namespace wio::runtime::std_async_fs
         std::int64_t size = -1;
         std::int64_t lastWriteTime = 0;
         bool executable = false;
+        std::vector<std::int32_t> kinds;
     };
 
     namespace detail
     {
-        inline void AppendU64(std::string& output, std::uint64_t value)
+        inline OperationResult& Take(Any& completion)
         {
-            for (unsigned shift = 0; shift < 64; shift += 8)
-                output.push_back(static_cast<char>((value >> shift) & 0xffu));
+            return TakeAsyncCompletion<OperationResult>(completion, "filesystem");
         }
 
-        inline void AppendString(std::string& output, const std::string& value)
+        inline AsyncTask<Any> Ready(OperationResult result)
         {
-            AppendU64(output, static_cast<std::uint64_t>(value.size()));
-            output.append(value);
+            co_return MakeAsyncCompletion(std::move(result));
         }
 
-        inline std::uint64_t ReadU64(const std::string& input, std::size_t& offset)
+        // Parks the awaiting coroutine until the watch has inotify events, the
+        // watch closes, or the owning task is cancelled. Watched() is false
+        // when the watch polls; the caller then rescans on its interval.
+        struct WatchReadinessAwaiter final
         {
-            if (input.size() - offset < 8)
-                throw std::invalid_argument("invalid asynchronous filesystem payload");
-            std::uint64_t value = 0;
-            for (unsigned shift = 0; shift < 64; shift += 8)
-                value |= static_cast<std::uint64_t>(static_cast<unsigned char>(input[offset++])) << shift;
-            return value;
-        }
+            void* handle = nullptr;
+            std::uint64_t token = 0;
+            std::weak_ptr<runtime::detail::AsyncTaskStateBase> taskState;
 
-        inline std::string ReadString(const std::string& input, std::size_t& offset)
-        {
-            const auto size = ReadU64(input, offset);
-            if (size > static_cast<std::uint64_t>(input.size() - offset))
-                throw std::invalid_argument("invalid asynchronous filesystem payload");
-            std::string value = input.substr(offset, static_cast<std::size_t>(size));
-            offset += static_cast<std::size_t>(size);
-            return value;
-        }
+            bool await_ready() const noexcept { return false; }
 
-        inline std::string Encode(const OperationResult& result)
-        {
-            std::string output("WAF1", 4);
-            output.push_back(result.succeeded ? '\1' : '\0');
-            AppendU64(output, static_cast<std::uint64_t>(static_cast<std::int64_t>(result.error)));
-            AppendU64(output, static_cast<std::uint64_t>(result.nativeError));
-            AppendString(output, result.message);
-            AppendString(output, result.text);
-            output.push_back(result.boolean ? '\1' : '\0');
-            output.push_back(result.isFile ? '\1' : '\0');
-            output.push_back(result.isDirectory ? '\1' : '\0');
-            output.push_back(result.executable ? '\1' : '\0');
-            AppendU64(output, static_cast<std::uint64_t>(result.size));
-            AppendU64(output, static_cast<std::uint64_t>(result.lastWriteTime));
-            AppendU64(output, static_cast<std::uint64_t>(result.texts.size()));
-            for (const auto& value : result.texts)
-                AppendString(output, value);
-            return output;
-        }
+            template<typename Promise>
+            bool await_suspend(std::coroutine_handle<Promise> continuation)
+            {
+                if constexpr (requires(Promise& promise) { promise.state; })
+                    taskState = continuation.promise().state;
+
+                auto registration =
+                    std::make_shared<runtime::detail::AsyncContinuationRegistration>(continuation);
+                token = std_fs::WatchNotify(handle, [registration] { registration->ResumeOnce(); });
+                if (token == 0)
+                    return false;
 
-        inline OperationResult Decode(const std::string& input)
+                if constexpr (requires(Promise& promise) { promise.state; })
+                {
+                    if (auto state = taskState.lock())
+                    {
+                        state->AddCancellationCallback([registration]
+                        {
+                            registration->ResumeOnce();
+                        });
+                    }
+                }
+                return registration->Arm();
+            }
+
+            void await_resume()
+            {
+                std_fs::WatchCancelNotify(token);
+                if (auto state = taskState.lock(); state && state->Cancelled())
+                    throw AsyncCancelled();
+            }
+
+            bool Watched() const noexcept { return token != 0; }
+        };
+
+        // Completes with the first non-empty batch of changes. After the
+        // first event the watch must stay quiet for `settle` before the batch
+        // is taken, so a burst of writes coalesces into one report; a polling
+        // watch rescans on the same interval.
+        inline AsyncTask<Any> WatchNextOwned(std::shared_ptr<void> lease, const std::uint64_t settleMilliseconds)
         {
-            if (input.size() < 5 || input.compare(0, 4, "WAF1") != 0)
-                throw std::invalid_argument("invalid asynchronous filesystem payload");
-            std::size_t offset = 4;
-            OperationResult result;
-            result.succeeded = input[offset++] != '\0';
-            result.error = static_cast<std::int32_t>(
-                std::bit_cast<std::int64_t>(ReadU64(input, offset)));
-            result.nativeError = std::bit_cast<std::int64_t>(ReadU64(input, offset));
-            result.message = ReadString(input, offset);
-            result.text = ReadString(input, offset);
-            if (input.size() - offset < 4)
-                throw std::invalid_argument("invalid asynchronous filesystem payload");
-            result.boolean = input[offset++] != '\0';
-            result.isFile = input[offset++] != '\0';
-            result.isDirectory = input[offset++] != '\0';
-            result.executable = input[offset++] != '\0';
-            result.size = std::bit_cast<std::int64_t>(ReadU64(input, offset));
-            result.lastWriteTime = std::bit_cast<std::int64_t>(ReadU64(input, offset));
-            const auto count = ReadU64(input, offset);
-            if (count > static_cast<std::uint64_t>(input.size()))
-                throw std::invalid_argument("invalid asynchronous filesystem payload");
-            result.texts.reserve(static_cast<std::size_t>(count));
-            for (std::uint64_t index = 0; index < count; ++index)
-                result.texts.push_back(ReadString(input, offset));
-            if (offset != input.size())
-                throw std::invalid_argument("invalid asynchronous filesystem payload");
-            return result;
+            const std::chrono::milliseconds settle(settleMilliseconds);
+            const std::chrono::milliseconds pollInterval(std::max<std::uint64_t>(settleMilliseconds, 1));
+            // Changes collected by an earlier refresh are still pending.
+            bool observed = true;
+            while (true)
+            {
+                OperationResult result;
+                bool changed = false;
+                result.succeeded = std_fs::WatchRefresh(
+                    lease.get(), changed, result.error, result.nativeError, result.message);
+                if (result.succeeded && !changed && observed)
+                {
+                    result.succeeded = std_fs::WatchTake(
+                        lease.get(), result.texts, result.kinds,
+                        result.error, result.nativeError, result.message);
+                    if (result.succeeded && result.texts.empty())
+                        observed = false;
+                    else
+                    {
+                        lease.reset();
+                        co_return MakeAsyncCompletion(std::move(result));
+                    }
+                }
+                if (!result.succeeded)
+                {
+                    lease.reset();
+                    co_return MakeAsyncCompletion(std::move(result));
+                }
+                if (changed)
+                {
+                    observed = true;
+                    AsyncDelayAwaiter delay{settle};
+                    co_await delay;
+                    continue;
+                }
+                WatchReadinessAwaiter readiness{lease.get()};
+                co_await readiness;
+                if (!readiness.Watched())
+                {
+                    AsyncDelayAwaiter delay{pollInterval};
+                    co_await delay;
+                }
+            }
         }
     }
 
     template<typename Action>
-    AsyncTask<std::string> Submit(Action action)
+    AsyncTask<Any> Submit(Action action)
     {
-        OperationResult result = co_await RunIoAsync<OperationResult>(
-            std::function<OperationResult()>(std::move(action)));
-        co_return detail::Encode(result);
+        // Named locals: GCC 12 double-destroys closure temporaries that
+        // appear inside a co_await operand.
+        std::function<OperationResult()> operation(std::move(action));
+        auto task = RunIoAsync<OperationResult>(std::move(operation));
+        OperationResult result = co_await task;
+        co_return MakeAsyncCompletion(std::move(result));
     }
 
-    inline AsyncTask<std::string> ReadText(const std::string& path)
+    inline AsyncTask<Any> ReadText(const std::string& path)
     {
         return Submit([path]
         {
@@ -134,7 +164,7 @@ namespace wio::runtime::std_async_fs
         });
     }
 
-    inline AsyncTask<std::string> WriteText(const std::string& path, const std::string& text)
+    inline AsyncTask<Any> WriteText(const std::string& path, const std::string& text)
     {
         return Submit([path, text]
         {
@@ -145,7 +175,7 @@ namespace wio::runtime::std_async_fs
         });
     }
 
-    inline AsyncTask<std::string> AppendText(const std::string& path, const std::string& text)
+    inline AsyncTask<Any> AppendText(const std::string& path, const std::string& text)
     {
         return Submit([path, text]
         {
@@ -156,7 +186,7 @@ namespace wio::runtime::std_async_fs
         });
     }
 
-    inline AsyncTask<std::string> CreateDirectories(const std::string& path)
+    inline AsyncTask<Any> CreateDirectories(const std::string& path)
     {
         return Submit([path]
         {
@@ -167,7 +197,7 @@ namespace wio::runtime::std_async_fs
         });
     }
 
-    inline AsyncTask<std::string> Remove(const std::string& path)
+    inline AsyncTask<Any> Remove(const std::string& path)
     {
         return Submit([path]
         {
@@ -178,7 +208,7 @@ namespace wio::runtime::std_async_fs
         });
     }
 
-    inline AsyncTask<std::string> RemoveAll(const std::string& path)
+    inline AsyncTask<Any> RemoveAll(const std::string& path)
     {
         return Submit([path]
         {
@@ -189,7 +219,7 @@ namespace wio::runtime::std_async_fs
         });
     }
 
-    inline AsyncTask<std::string> CopyFile(const std::string& source, const std::string& target)
+    inline AsyncTask<Any> CopyFile(const std::string& source, const std::string& target)
     {
         return Submit([source, target]
         {
@@ -200,7 +230,7 @@ namespace wio::runtime::std_async_fs
         });
     }
 
-    inline AsyncTask<std::string> MoveFile(const std::string& source, const std::string& target)
+    inline AsyncTask<Any> MoveFile(const std::string& source, const std::string& target)
     {
         return Submit([source, target]
         {
@@ -211,7 +241,7 @@ namespace wio::runtime::std_async_fs
         });
     }
 
-    inline AsyncTask<std::string> ReplaceFileAtomic(const std::string& source, const std::string& target)
+    inline AsyncTask<Any> ReplaceFileAtomic(const std::string& source, const std::string& target)
     {
         return Submit([source, target]
         {
@@ -222,7 +252,7 @@ namespace wio::runtime::std_async_fs
         });
     }
 
-    inline AsyncTask<std::string> ListFilesRecursive(const std::string& path)
+    inline AsyncTask<Any> ListFilesRecursive(const std::string& path)
     {
         return Submit([path]
         {
@@ -233,7 +263,7 @@ namespace wio::runtime::std_async_fs
         });
     }
 
-    inline AsyncTask<std::string> Metadata(const std::string& path)
+    inline AsyncTask<Any> Metadata(const std::string& path)
     {
         return Submit([path]
         {
@@ -246,60 +276,75 @@ namespace wio::runtime::std_async_fs
         });
     }
 
+    inline AsyncTask<Any> WatchNext(void* handle, const std::uint64_t settleMilliseconds)
+    {
+        if (!std_fs::WatchRetain(handle))
+        {
+            OperationResult closed;
+            closed.error = static_cast<std::int32_t>(std_fs::ErrorCode::Io);
+            closed.message = "file watch is closed";
+            return detail::Ready(std::move(closed));
+        }
+        std::shared_ptr<void> lease(handle, [](void* value) { std_fs::WatchRelease(value); });
+        return detail::WatchNextOwned(std::move(lease), settleMilliseconds);
+    }
+
+    // Each Decode* call consumes the completion of one awaited operation and
+    // moves its buffers out.
     inline void DecodeUnit(
-        const std::string& payload, bool& succeeded, std::int32_t& error,
+        Any completion, bool& succeeded, std::int32_t& error,
         std::int64_t& nativeError, std::string& message)
     {
-        const auto result = detail::Decode(payload);
+        auto& result = detail::Take(completion);
         succeeded = result.succeeded;
         error = result.error;
         nativeError = result.nativeError;
-        message = result.message;
+        message = std::move(result.message);
     }
 
     inline void DecodeText(
-        const std::string& payload, bool& succeeded, std::string& value,
+        Any completion, bool& succeeded, std::string& value,
         std::int32_t& error, std::int64_t& nativeError, std::string& message)
     {
-        const auto result = detail::Decode(payload);
+        auto& result = detail::Take(completion);
         succeeded = result.succeeded;
-        value = result.text;
+        value = std::move(result.text);
         error = result.error;
         nativeError = result.nativeError;
-        message = result.message;
+        message = std::move(result.message);
     }
 
     inline void DecodeBoolean(
-        const std::string& payload, bool& succeeded, bool& value,
+        Any completion, bool& succeeded, bool& value,
         std::int32_t& error, std::int64_t& nativeError, std::string& message)
     {
-        const auto result = detail::Decode(payload);
+        auto& result = detail::Take(completion);
         succeeded = result.succeeded;
         value = result.boolean;
         error = result.error;
         nativeError = result.nativeError;
-        message = result.message;
+        message = std::move(result.message);
     }
 
     inline void DecodeTexts(
-        const std::string& payload, bool& succeeded, std::vector<std::string>& values,
+        Any completion, bool& succeeded, std::vector<std::string>& values,
         std::int32_t& error, std::int64_t& nativeError, std::string& message)
     {
-        const auto result = detail::Decode(payload);
+        auto& result = detail::Take(completion);
         succeeded = result.succeeded;
-        values = result.texts;
+        values = std::move(result.texts);
         error = result.error;
         nativeError = result.nativeError;
-        message = result.message;
+        message = std::move(result.message);
     }
 
     inline void DecodeMetadata(
-        const std::string& payload, bool& succeeded, bool& isFile,
+        Any completion, bool& succeeded, bool& isFile,
         bool& isDirectory, std::int64_t& size, std::int64_t& lastWriteTime,
         bool& executable, std::int32_t& error, std::int64_t& nativeError,
         std::string& message)
     {
-        const auto result = detail::Decode(payload);
+        auto& result = detail::Take(completion);
         succeeded = result.succeeded;
         isFile = result.isFile;
         isDirectory = result.isDirectory;
@@ -308,6 +353,20 @@ namespace wio::runtime::std_async_fs
         executable = result.executable;
         error = result.error;
         nativeError = result.nativeError;
-        message = result.message;
+        message = std::move(result.message);
+    }
+
+    inline void DecodeChanges(
+        Any completion, bool& succeeded, std::vector<std::string>& paths,
+        std::vector<std::int32_t>& kinds, std::int32_t& error,
+        std::int64_t& nativeError, std::string& message)
+    {
+        auto& result = detail::Take(completion);
+        succeeded = result.succeeded;
+        paths = std::move(result.texts);
+        kinds = std::move(result.kinds);
+        error = result.error;
+        nativeError = result.nativeError;
+        message = std::move(result.message);
     }
 }
@@ -3,10 +3,12 @@
 #include "std_async.h"
 #include "std_net.h"
 
+#include <atomic>
+#include <chrono>
+#include <coroutine>
 #include <cstdint>
 #include <functional>
 #include <memory>
-#include <stdexcept>
 #include <string>
 #include <utility>
 #include <vector>
@@ -26,230 +28,410 @@ namespace wio::runtime::std_async_net
 
     namespace detail
     {
-        inline void AppendU64(std::string& target, std::uint64_t value)
+        inline Any Complete(OperationResult result)
         {
-            for (unsigned shift = 0; shift < 64; shift += 8)
-                target.push_back(static_cast<char>((value >> shift) & 0xffu));
+            return MakeAsyncCompletion(std::move(result));
         }
 
-        inline void AppendString(std::string& target, const std::string& value)
+        inline OperationResult& Take(Any& completion)
         {
-            AppendU64(target, static_cast<std::uint64_t>(value.size()));
-            target.append(value);
+            return TakeAsyncCompletion<OperationResult>(completion, "network");
         }
 
-        inline std::uint64_t ReadU64(const std::string& source, std::size_t& offset)
+        // Task completion resumes awaiters before the coroutine frame is
+        // destroyed, so operations reset their lease before co_return to keep
+        // LiveSocketCount exact once the result is observable.
+        inline std::shared_ptr<void> Acquire(void* handle, std::string& error)
         {
-            if (offset > source.size() || source.size() - offset < 8)
-                throw std::invalid_argument("invalid asynchronous network payload");
-            std::uint64_t value = 0;
-            for (unsigned shift = 0; shift < 64; shift += 8)
-                value |= static_cast<std::uint64_t>(static_cast<unsigned char>(source[offset++])) << shift;
-            return value;
+            if (!std_net::Retain(handle, error))
+                return {};
+            return std::shared_ptr<void>(handle, [](void* value) { std_net::Release(value); });
         }
 
-        inline std::string ReadString(const std::string& source, std::size_t& offset)
+        // Parks the awaiting coroutine on the socket readiness reactor until
+        // the descriptor is ready, the socket closes, the optional wait
+        // timeout elapses, or the owning task is cancelled. No executor
+        // thread is held while the coroutine is parked.
+        struct SocketReadinessAwaiter final
         {
-            const auto size = ReadU64(source, offset);
-            if (size > static_cast<std::uint64_t>(source.size() - offset))
-                throw std::invalid_argument("invalid asynchronous network payload");
-            std::string value = source.substr(offset, static_cast<std::size_t>(size));
-            offset += static_cast<std::size_t>(size);
-            return value;
-        }
+            void* handle = nullptr;
+            bool writable = false;
+            std::uint64_t timeoutMilliseconds = 0;
+            std::uint64_t token = 0;
+            std::string error;
+            std::shared_ptr<AsyncScheduler::Timer> timer;
+            std::shared_ptr<std::atomic<bool>> expired = std::make_shared<std::atomic<bool>>(false);
+            std::weak_ptr<runtime::detail::AsyncTaskStateBase> taskState;
+
+            bool await_ready() const noexcept { return false; }
+
+            template<typename Promise>
+            bool await_suspend(std::coroutine_handle<Promise> continuation)
+            {
+                if constexpr (requires(Promise& promise) { promise.state; })
+                    taskState = continuation.promise().state;
+
+                auto registration =
+                    std::make_shared<runtime::detail::AsyncContinuationRegistration>(continuation);
+                token = std_net::WatchReadiness(
+                    handle, writable, [registration] { registration->ResumeOnce(); }, error);
+                if (token == 0)
+                    return false;
+
+                if (timeoutMilliseconds != 0)
+                {
+                    timer = DefaultAsyncScheduler().PostAfter(
+                        std::chrono::milliseconds(timeoutMilliseconds),
+                        [registration, expired = expired]
+                        {
+                            expired->store(true, std::memory_order_release);
+                            registration->ResumeOnce();
+                        });
+                    if (!timer)
+                    {
+                        std_net::CancelReadiness(token);
+                        token = 0;
+                        throw AsyncRuntimeStopped();
+                    }
+                }
+
+                if constexpr (requires(Promise& promise) { promise.state; })
+                {
+                    if (auto state = taskState.lock())
+                    {
+                        state->AddCancellationCallback([registration]
+                        {
+                            registration->ResumeOnce();
+                        });
+                    }
+                }
+                return registration->Arm();
+            }
+
+            void await_resume()
+            {
+                std_net::CancelReadiness(token);
+                if (timer)
+                    timer->Cancel();
+                if (auto state = taskState.lock(); state && state->Cancelled())
+                    throw AsyncCancelled();
+            }
+
+            bool TimedOut() const noexcept
+            {
+                return expired->load(std::memory_order_acquire);
+            }
+        };
 
-        inline std::string Encode(const OperationResult& result)
-        {
-            std::string payload("WAN1", 4);
-            payload.push_back(result.succeeded ? '\1' : '\0');
-            AppendString(payload, result.error);
-            AppendU64(payload, static_cast<std::uint64_t>(result.count));
-            AppendString(payload, result.bytes);
-            AppendString(payload, result.remoteAddress);
-            AppendU64(payload, result.remotePort);
-            AppendU64(payload, static_cast<std::uint64_t>(result.addresses.size()));
-            for (const auto& address : result.addresses)
-                AppendString(payload, address);
-            return payload;
+        // Remaining wait budget for a socket timeout. Zero means "no limit";
+        // an expired deadline reports one millisecond so the wait still
+        // observes readiness that raced with the deadline.
+        inline std::uint64_t RemainingMilliseconds(
+            const AsyncScheduler::Clock::time_point deadline,
+            const std::uint64_t configuredTimeout)
+        {
+            if (configuredTimeout == 0)
+                return 0;
+            const auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(
+                deadline - AsyncScheduler::Clock::now()).count();
+            return remaining <= 0 ? 1 : static_cast<std::uint64_t>(remaining);
         }
 
-        inline OperationResult Decode(const std::string& payload)
-        {
-            if (payload.size() < 5 || payload.compare(0, 4, "WAN1") != 0)
-                throw std::invalid_argument("invalid asynchronous network payload");
-            std::size_t offset = 4;
-            OperationResult result;
-            result.succeeded = payload[offset++] != '\0';
-            result.error = ReadString(payload, offset);
-            result.count = static_cast<std::size_t>(ReadU64(payload, offset));
-            result.bytes = ReadString(payload, offset);
-            result.remoteAddress = ReadString(payload, offset);
-            result.remotePort = static_cast<std::uint16_t>(ReadU64(payload, offset));
-            const auto addressCount = ReadU64(payload, offset);
-            if (addressCount > static_cast<std::uint64_t>(payload.size()))
-                throw std::invalid_argument("invalid asynchronous network payload");
-            result.addresses.reserve(static_cast<std::size_t>(addressCount));
-            for (std::uint64_t index = 0; index < addressCount; ++index)
-                result.addresses.push_back(ReadString(payload, offset));
-            if (offset != payload.size())
-                throw std::invalid_argument("invalid asynchronous network payload");
-            return result;
+        inline AsyncScheduler::Clock::time_point DeadlineAfter(const std::uint64_t milliseconds)
+        {
+            return AsyncScheduler::Clock::now() + std::chrono::milliseconds(milliseconds);
         }
 
-        inline std::shared_ptr<void> Acquire(void* handle, std::string& error)
+        // Threaded fallback for platforms without the readiness reactor and
+        // for operations that are inherently blocking (DNS resolution).
+        // Callers keep the operation and task in named locals: GCC 12
+        // double-destroys temporaries that appear inside a co_await operand.
+        inline AsyncTask<OperationResult> RunThreaded(std::function<OperationResult()> operation)
         {
-            if (!std_net::Retain(handle, error))
-                return {};
-            return std::shared_ptr<void>(handle, [](void* value) { std_net::Release(value); });
+            return RunIoAsync<OperationResult>(std::move(operation));
         }
     }
 
-    inline AsyncTask<std::string> Resolve(const std::string& host, const std::uint16_t port)
+    inline AsyncTask<Any> Resolve(const std::string& host, const std::uint16_t port)
     {
-        OperationResult result = co_await RunIoAsync<OperationResult>(
-            std::function<OperationResult()>([host, port]
-            {
-                OperationResult value;
-                value.succeeded = std_net::Resolve(host, port, value.addresses, value.error);
-                return value;
-            }));
-        co_return detail::Encode(result);
+        std::function<OperationResult()> operation = [host, port]
+        {
+            OperationResult value;
+            value.succeeded = std_net::Resolve(host, port, value.addresses, value.error);
+            return value;
+        };
+        auto task = detail::RunThreaded(std::move(operation));
+        OperationResult result = co_await task;
+        co_return detail::Complete(std::move(result));
     }
 
-    inline AsyncTask<std::string> Send(void* handle, const std::string& bytes)
+    inline AsyncTask<Any> Send(void* handle, const std::string& bytes)
     {
         std::string error;
         auto lease = detail::Acquire(handle, error);
         if (!lease)
-            co_return detail::Encode(OperationResult{.error = std::move(error)});
-        OperationResult result = co_await RunIoAsync<OperationResult>(
-            std::function<OperationResult()>([lease = std::move(lease), bytes]
+            co_return detail::Complete(OperationResult{.error = std::move(error)});
+        if (!std_net::ReactorAvailable())
+        {
+            std::function<OperationResult()> operation = [lease = std::move(lease), bytes]() mutable
             {
                 OperationResult value;
                 value.succeeded = std_net::Send(lease.get(), bytes, value.count, value.error);
+                lease.reset();
                 return value;
-            }));
-        co_return detail::Encode(result);
+            };
+            auto task = detail::RunThreaded(std::move(operation));
+            OperationResult result = co_await task;
+            co_return detail::Complete(std::move(result));
+        }
+
+        // The caller's argument may not outlive the first suspension.
+        const std::string payload = bytes;
+        const auto timeout = std_net::ConfiguredTimeout(lease.get());
+        const auto deadline = detail::DeadlineAfter(timeout);
+        OperationResult result;
+        for (;;)
+        {
+            std::size_t sent = 0;
+            bool wouldBlock = false;
+            result.succeeded = std_net::TrySend(
+                lease.get(), std::string_view(payload).substr(result.count), sent, wouldBlock, result.error);
+            result.count += sent;
+            if (result.succeeded || !wouldBlock)
+                break;
+
+            detail::SocketReadinessAwaiter readiness{
+                lease.get(), true, detail::RemainingMilliseconds(deadline, timeout)};
+            co_await readiness;
+            if (!readiness.error.empty())
+            {
+                result.error = std::move(readiness.error);
+                break;
+            }
+            if (readiness.TimedOut())
+            {
+                result.error = "send wait timed out";
+                break;
+            }
+        }
+        lease.reset();
+        co_return detail::Complete(std::move(result));
     }
 
-    inline AsyncTask<std::string> Receive(void* handle, const std::size_t maximumBytes)
+    inline AsyncTask<Any> Receive(void* handle, const std::size_t maximumBytes)
     {
         std::string error;
         auto lease = detail::Acquire(handle, error);
         if (!lease)
-            co_return detail::Encode(OperationResult{.error = std::move(error)});
-        OperationResult result = co_await RunIoAsync<OperationResult>(
-            std::function<OperationResult()>([lease = std::move(lease), maximumBytes]
+            co_return detail::Complete(OperationResult{.error = std::move(error)});
+        if (!std_net::ReactorAvailable())
+        {
+            std::function<OperationResult()> operation = [lease = std::move(lease), maximumBytes]() mutable
             {
                 OperationResult value;
                 value.succeeded = std_net::Receive(
                     lease.get(), maximumBytes, value.bytes, value.error);
+                lease.reset();
                 return value;
-            }));
-        co_return detail::Encode(result);
+            };
+            auto task = detail::RunThreaded(std::move(operation));
+            OperationResult result = co_await task;
+            co_return detail::Complete(std::move(result));
+        }
+
+        const auto timeout = std_net::ConfiguredTimeout(lease.get());
+        const auto deadline = detail::DeadlineAfter(timeout);
+        OperationResult result;
+        for (;;)
+        {
+            bool wouldBlock = false;
+            result.succeeded = std_net::TryReceive(
+                lease.get(), maximumBytes, result.bytes, wouldBlock, result.error);
+            if (result.succeeded || !wouldBlock)
+                break;
+
+            detail::SocketReadinessAwaiter readiness{
+                lease.get(), false, detail::RemainingMilliseconds(deadline, timeout)};
+            co_await readiness;
+            if (!readiness.error.empty())
+            {
+                result.error = std::move(readiness.error);
+                break;
+            }
+            if (readiness.TimedOut())
+            {
+                result.error = "receive wait timed out";
+                break;
+            }
+        }
+        lease.reset();
+        co_return detail::Complete(std::move(result));
     }
 
-    inline AsyncTask<std::string> Accept(void* handle)
+    inline AsyncTask<Any> Accept(void* handle)
     {
         std::string error;
         auto lease = detail::Acquire(handle, error);
         if (!lease)
-            co_return detail::Encode(OperationResult{.error = std::move(error)});
-        OperationResult result = co_await RunIoAsync<OperationResult>(
-            std::function<OperationResult()>([lease = std::move(lease)]
+            co_return detail::Complete(OperationResult{.error = std::move(error)});
+        if (!std_net::ReactorAvailable())
+        {
+            std::function<OperationResult()> operation = [lease = std::move(lease)]() mutable
             {
                 OperationResult value;
                 value.succeeded = std_net::TcpWaitAccept(lease.get(), value.error);
+                lease.reset();
                 return value;
-            }));
-        co_return detail::Encode(result);
+            };
+            auto task = detail::RunThreaded(std::move(operation));
+            OperationResult result = co_await task;
+            co_return detail::Complete(std::move(result));
+        }
+
+        OperationResult result;
+        for (;;)
+        {
+            bool wouldBlock = false;
+            result.succeeded = std_net::TryWaitAccept(lease.get(), wouldBlock, result.error);
+            if (result.succeeded || !wouldBlock)
+                break;
+
+            detail::SocketReadinessAwaiter readiness{lease.get(), false, 0};
+            co_await readiness;
+            if (!readiness.error.empty())
+            {
+                result.error = std::move(readiness.error);
+                break;
+            }
+        }
+        lease.reset();
+        co_return detail::Complete(std::move(result));
     }
 
-    inline AsyncTask<std::string> UdpSendTo(
+    inline AsyncTask<Any> UdpSendTo(
         void* handle, const std::string& host, const std::uint16_t port,
         const std::string& bytes)
     {
         std::string error;
         auto lease = detail::Acquire(handle, error);
         if (!lease)
-            co_return detail::Encode(OperationResult{.error = std::move(error)});
-        OperationResult result = co_await RunIoAsync<OperationResult>(
-            std::function<OperationResult()>(
-                [lease = std::move(lease), host, port, bytes]
-                {
-                    OperationResult value;
-                    value.succeeded = std_net::UdpSendTo(
-                        lease.get(), host, port, bytes, value.count, value.error);
-                    return value;
-                }));
-        co_return detail::Encode(result);
+            co_return detail::Complete(OperationResult{.error = std::move(error)});
+        // Destination resolution may block on DNS, so datagram sends stay on
+        // the bounded I/O executor.
+        std::function<OperationResult()> operation = [lease = std::move(lease), host, port, bytes]() mutable
+        {
+            OperationResult value;
+            value.succeeded = std_net::UdpSendTo(
+                lease.get(), host, port, bytes, value.count, value.error);
+            lease.reset();
+            return value;
+        };
+        auto task = detail::RunThreaded(std::move(operation));
+        OperationResult result = co_await task;
+        co_return detail::Complete(std::move(result));
     }
 
-    inline AsyncTask<std::string> UdpReceiveFrom(void* handle, const std::size_t maximumBytes)
+    inline AsyncTask<Any> UdpReceiveFrom(void* handle, const std::size_t maximumBytes)
     {
         std::string error;
         auto lease = detail::Acquire(handle, error);
         if (!lease)
-            co_return detail::Encode(OperationResult{.error = std::move(error)});
-        OperationResult result = co_await RunIoAsync<OperationResult>(
-            std::function<OperationResult()>([lease = std::move(lease), maximumBytes]
+            co_return detail::Complete(OperationResult{.error = std::move(error)});
+        if (!std_net::ReactorAvailable())
+        {
+            std::function<OperationResult()> operation = [lease = std::move(lease), maximumBytes]() mutable
             {
                 OperationResult value;
                 value.succeeded = std_net::UdpReceiveFrom(
                     lease.get(), maximumBytes, value.bytes, value.remoteAddress,
                     value.remotePort, value.error);
+                lease.reset();
                 return value;
-            }));
-        co_return detail::Encode(result);
+            };
+            auto task = detail::RunThreaded(std::move(operation));
+            OperationResult result = co_await task;
+            co_return detail::Complete(std::move(result));
+        }
+
+        const auto timeout = std_net::ConfiguredTimeout(lease.get());
+        const auto deadline = detail::DeadlineAfter(timeout);
+        OperationResult result;
+        for (;;)
+        {
+            bool wouldBlock = false;
+            result.succeeded = std_net::TryUdpReceiveFrom(
+                lease.get(), maximumBytes, result.bytes, result.remoteAddress,
+                result.remotePort, wouldBlock, result.error);
+            if (result.succeeded || !wouldBlock)
+                break;
+
+            detail::SocketReadinessAwaiter readiness{
+                lease.get(), false, detail::RemainingMilliseconds(deadline, timeout)};
+            co_await readiness;
+            if (!readiness.error.empty())
+            {
+                result.error = std::move(readiness.error);
+                break;
+            }
+            if (readiness.TimedOut())
+            {
+                result.error = "UDP receive wait timed out";
+                break;
+            }
+        }
+        lease.reset();
+        co_return detail::Complete(std::move(result));
     }
 
+    // The Decode* functions consume a completion: each is called once by the
+    // std wrapper that awaited the operation, so buffers are moved out.
     inline void DecodeAddresses(
-        const std::string& payload, bool& succeeded,
+        Any completion, bool& succeeded,
         std::vector<std::string>& addresses, std::string& error)
     {
-        const auto result = detail::Decode(payload);
+        auto& result = detail::Take(completion);
         succeeded = result.succeeded;
-        addresses = result.addresses;
-        error = result.error;
+        addresses = std::move(result.addresses);
+        error = std::move(result.error);
     }
 
     inline void DecodeSend(
-        const std::string& payload, bool& succeeded,
+        Any completion, bool& succeeded,
         std::size_t& count, std::string& error)
     {
-        const auto result = detail::Decode(payload);
+        auto& result = detail::Take(completion);
         succeeded = result.succeeded;
         count = result.count;
-        error = result.error;
+        error = std::move(result.error);
     }
 
     inline void DecodeReceive(
-        const std::string& payload, bool& succeeded,
+        Any completion, bool& succeeded,
         std::string& bytes, std::string& error)
     {
-        const auto result = detail::Decode(payload);
+        auto& result = detail::Take(completion);
         succeeded = result.succeeded;
-        bytes = result.bytes;
-        error = result.error;
+        bytes = std::move(result.bytes);
+        error = std::move(result.error);
     }
 
     inline void DecodeAccept(
-        const std::string& payload, bool& succeeded, std::string& error)
+        Any completion, bool& succeeded, std::string& error)
     {
-        const auto result = detail::Decode(payload);
+        auto& result = detail::Take(completion);
         succeeded = result.succeeded;
-        error = result.error;
+        error = std::move(result.error);
     }
 
     inline void DecodeDatagram(
-        const std::string& payload, bool& succeeded, std::string& bytes,
+        Any completion, bool& succeeded, std::string& bytes,
         std::string& remoteAddress, std::uint16_t& remotePort, std::string& error)
     {
-        const auto result = detail::Decode(payload);
+        auto& result = detail::Take(completion);
         succeeded = result.succeeded;
-        bytes = result.bytes;
-        remoteAddress = result.remoteAddress;
+        bytes = std::move(result.bytes);
+        remoteAddress = std::move(result.remoteAddress);
         remotePort = result.remotePort;
-        error = result.error;
+        error = std::move(result.error);
     }
 }
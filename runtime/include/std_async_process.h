@@ -3,12 +3,11 @@
 #include "std_async.h"
 #include "std_process.h"
 
-#include <bit>
 #include <chrono>
+#include <coroutine>
 #include <cstdint>
 #include <functional>
 #include <memory>
-#include <stdexcept>
 #include <string>
 #include <utility>
 #include <vector>
@@ -30,81 +29,16 @@ namespace wio::runtime::std_async_process
 
     namespace detail
     {
-        inline void AppendU64(std::string& target, std::uint64_t value)
+        inline Any Complete(OperationResult result)
         {
-            for (unsigned shift = 0; shift < 64; shift += 8)
-                target.push_back(static_cast<char>((value >> shift) & 0xffu));
+            return MakeAsyncCompletion(std::move(result));
         }
 
-        inline void AppendString(std::string& target, const std::string& value)
+        inline OperationResult& Take(Any& completion)
         {
-            AppendU64(target, static_cast<std::uint64_t>(value.size()));
-            target.append(value);
+            return TakeAsyncCompletion<OperationResult>(completion, "process");
         }
 
-        inline std::uint64_t ReadU64(const std::string& source, std::size_t& offset)
-        {
-            if (offset > source.size() || source.size() - offset < 8)
-                throw std::invalid_argument("invalid asynchronous process payload");
-            std::uint64_t value = 0;
-            for (unsigned shift = 0; shift < 64; shift += 8)
-                value |= static_cast<std::uint64_t>(static_cast<unsigned char>(source[offset++])) << shift;
-            return value;
-        }
-
-        inline std::string ReadString(const std::string& source, std::size_t& offset)
-        {
-            const auto size = ReadU64(source, offset);
-            if (size > static_cast<std::uint64_t>(source.size() - offset))
-                throw std::invalid_argument("invalid asynchronous process payload");
-            std::string value = source.substr(offset, static_cast<std::size_t>(size));
-            offset += static_cast<std::size_t>(size);
-            return value;
-        }
-
-        inline std::string Encode(const OperationResult& result)
-        {
-            std::string payload("WAP2", 4);
-            payload.push_back(result.succeeded ? '\1' : '\0');
-            AppendU64(payload, static_cast<std::uint64_t>(static_cast<std::int64_t>(result.exitCode)));
-            payload.push_back(static_cast<char>(result.error));
-            AppendU64(payload, static_cast<std::uint64_t>(static_cast<std::int64_t>(result.nativeError)));
-            AppendString(payload, result.message);
-            AppendString(payload, result.output);
-            AppendU64(payload, static_cast<std::uint64_t>(result.count));
-            payload.push_back(result.eof ? '\1' : '\0');
-            payload.push_back(result.running ? '\1' : '\0');
-            return payload;
-        }
-
-        inline OperationResult Decode(const std::string& payload)
-        {
-            if (payload.size() < 6 || payload.compare(0, 4, "WAP2") != 0)
-                throw std::invalid_argument("invalid asynchronous process payload");
-            std::size_t offset = 4;
-            OperationResult result;
-            result.succeeded = payload[offset++] != '\0';
-            result.exitCode = static_cast<std::int32_t>(
-                std::bit_cast<std::int64_t>(ReadU64(payload, offset)));
-            result.error = static_cast<std_process::ProcessError>(
-                static_cast<unsigned char>(payload[offset++]));
-            result.nativeError = static_cast<std::int32_t>(
-                std::bit_cast<std::int64_t>(ReadU64(payload, offset)));
-            result.message = ReadString(payload, offset);
-            result.output = ReadString(payload, offset);
-            result.count = static_cast<std::size_t>(ReadU64(payload, offset));
-            if (offset + 2 > payload.size())
-                throw std::invalid_argument("invalid asynchronous process payload");
-            result.eof = payload[offset++] != '\0';
-            result.running = payload[offset++] != '\0';
-            if (offset != payload.size())
-                throw std::invalid_argument("invalid asynchronous process payload");
-            return result;
-        }
-    }
-
-    namespace detail
-    {
         inline std::shared_ptr<void> Acquire(void* handle, OperationResult& result)
         {
             if (!std_process::ProcessRetain(handle, result.message))
@@ -115,12 +49,61 @@ namespace wio::runtime::std_async_process
             return std::shared_ptr<void>(handle, [](void* value) { std_process::ProcessRelease(value); });
         }
 
-        inline AsyncTask<std::string> Ready(OperationResult result)
+        inline AsyncTask<Any> Ready(OperationResult result)
         {
-            co_return Encode(result);
+            co_return Complete(std::move(result));
         }
 
-        inline AsyncTask<std::string> ReadStdoutOwned(
+        // Parks the awaiting coroutine until the watched pipe has data or
+        // hangs up, the child exits, the process closes, or the owning task is
+        // cancelled. Watched() is false when no notification could be
+        // registered; the caller then waits a short delay and polls again.
+        struct ProcessReadinessAwaiter final
+        {
+            void* handle = nullptr;
+            std_process::ProcessEvent event = std_process::ProcessEvent::exited;
+            std::uint64_t token = 0;
+            std::weak_ptr<runtime::detail::AsyncTaskStateBase> taskState;
+
+            bool await_ready() const noexcept { return false; }
+
+            template<typename Promise>
+            bool await_suspend(std::coroutine_handle<Promise> continuation)
+            {
+                if constexpr (requires(Promise& promise) { promise.state; })
+                    taskState = continuation.promise().state;
+
+                auto registration =
+                    std::make_shared<runtime::detail::AsyncContinuationRegistration>(continuation);
+                token = std_process::ProcessWatch(
+                    handle, event, [registration] { registration->ResumeOnce(); });
+                if (token == 0)
+                    return false;
+
+                if constexpr (requires(Promise& promise) { promise.state; })
+                {
+                    if (auto state = taskState.lock())
+                    {
+                        state->AddCancellationCallback([registration]
+                        {
+                            registration->ResumeOnce();
+                        });
+                    }
+                }
+                return registration->Arm();
+            }
+
+            void await_resume()
+            {
+                std_process::ProcessCancelWatch(token);
+                if (auto state = taskState.lock(); state && state->Cancelled())
+                    throw AsyncCancelled();
+            }
+
+            bool Watched() const noexcept { return token != 0; }
+        };
+
+        inline AsyncTask<Any> ReadStdoutOwned(
             std::shared_ptr<void> lease, const std::size_t maximumBytes)
         {
             while (true)
@@ -134,13 +117,19 @@ namespace wio::runtime::std_async_process
                 if (!result.succeeded || result.eof || !result.output.empty())
                 {
                     lease.reset();
-                    co_return Encode(result);
+                    co_return Complete(std::move(result));
+                }
+                ProcessReadinessAwaiter readiness{lease.get(), std_process::ProcessEvent::stdout_readable};
+                co_await readiness;
+                if (!readiness.Watched())
+                {
+                    AsyncDelayAwaiter delay{std::chrono::milliseconds(10)};
+                    co_await delay;
                 }
-                co_await AsyncDelayAwaiter{std::chrono::milliseconds(10)};
             }
         }
 
-        inline AsyncTask<std::string> ReadStderrOwned(
+        inline AsyncTask<Any> ReadStderrOwned(
             std::shared_ptr<void> lease, const std::size_t maximumBytes)
         {
             while (true)
@@ -154,17 +143,23 @@ namespace wio::runtime::std_async_process
                 if (!result.succeeded || result.eof || !result.output.empty())
                 {
                     lease.reset();
-                    co_return Encode(result);
+                    co_return Complete(std::move(result));
+                }
+                ProcessReadinessAwaiter readiness{lease.get(), std_process::ProcessEvent::stderr_readable};
+                co_await readiness;
+                if (!readiness.Watched())
+                {
+                    AsyncDelayAwaiter delay{std::chrono::milliseconds(10)};
+                    co_await delay;
                 }
-                co_await AsyncDelayAwaiter{std::chrono::milliseconds(10)};
             }
         }
 
-        inline AsyncTask<std::string> WriteStdinOwned(
+        inline AsyncTask<Any> WriteStdinOwned(
             std::shared_ptr<void> lease, std::string bytes)
         {
-            OperationResult result = co_await RunIoAsync<OperationResult>(
-                std::function<OperationResult()>([lease = std::move(lease), bytes = std::move(bytes)]() mutable
+            std::function<OperationResult()> operation =
+                [lease = std::move(lease), bytes = std::move(bytes)]() mutable
                 {
                     OperationResult value;
                     int nativeError = 0;
@@ -173,11 +168,13 @@ namespace wio::runtime::std_async_process
                     value.nativeError = nativeError;
                     lease.reset();
                     return value;
-                }));
-            co_return Encode(result);
+                };
+            auto task = RunIoAsync<OperationResult>(std::move(operation));
+            OperationResult result = co_await task;
+            co_return Complete(std::move(result));
         }
 
-        inline AsyncTask<std::string> WaitOwned(std::shared_ptr<void> lease)
+        inline AsyncTask<Any> WaitOwned(std::shared_ptr<void> lease)
         {
             while (true)
             {
@@ -189,7 +186,7 @@ namespace wio::runtime::std_async_process
                 if (!result.succeeded)
                 {
                     lease.reset();
-                    co_return Encode(result);
+                    co_return Complete(std::move(result));
                 }
                 if (!result.running)
                 {
@@ -199,56 +196,64 @@ namespace wio::runtime::std_async_process
                     result.exitCode = exitCode;
                     result.nativeError = nativeError;
                     lease.reset();
-                    co_return Encode(result);
+                    co_return Complete(std::move(result));
+                }
+                ProcessReadinessAwaiter readiness{lease.get(), std_process::ProcessEvent::exited};
+                co_await readiness;
+                if (!readiness.Watched())
+                {
+                    AsyncDelayAwaiter delay{std::chrono::milliseconds(10)};
+                    co_await delay;
                 }
-                co_await AsyncDelayAwaiter{std::chrono::milliseconds(10)};
             }
         }
     }
 
-    inline AsyncTask<std::string> Run(
+    inline AsyncTask<Any> Run(
         const std::string& command,
         const std::vector<std::string>& args,
         const std::string& workingDirectory)
     {
-        OperationResult result = co_await RunIoAsync<OperationResult>(
-            std::function<OperationResult()>([command, args, workingDirectory]
-            {
-                OperationResult value;
-                int exitCode = 0;
-                int nativeError = 0;
-                value.succeeded = std_process::TryRunResult(
-                    command, args, workingDirectory, exitCode,
-                    value.error, nativeError, value.message);
-                value.exitCode = static_cast<std::int32_t>(exitCode);
-                value.nativeError = static_cast<std::int32_t>(nativeError);
-                return value;
-            }));
-        co_return detail::Encode(result);
+        std::function<OperationResult()> operation = [command, args, workingDirectory]
+        {
+            OperationResult value;
+            int exitCode = 0;
+            int nativeError = 0;
+            value.succeeded = std_process::TryRunResult(
+                command, args, workingDirectory, exitCode,
+                value.error, nativeError, value.message);
+            value.exitCode = static_cast<std::int32_t>(exitCode);
+            value.nativeError = static_cast<std::int32_t>(nativeError);
+            return value;
+        };
+        auto task = RunIoAsync<OperationResult>(std::move(operation));
+        OperationResult result = co_await task;
+        co_return detail::Complete(std::move(result));
     }
 
-    inline AsyncTask<std::string> Capture(
+    inline AsyncTask<Any> Capture(
         const std::string& command,
         const std::vector<std::string>& args,
         const std::string& workingDirectory)
     {
-        OperationResult result = co_await RunIoAsync<OperationResult>(
-            std::function<OperationResult()>([command, args, workingDirectory]
-            {
-                OperationResult value;
-                int exitCode = 0;
-                int nativeError = 0;
-                value.succeeded = std_process::TryRunCapture(
-                    command, args, workingDirectory, exitCode, value.output,
-                    value.error, nativeError, value.message);
-                value.exitCode = static_cast<std::int32_t>(exitCode);
-                value.nativeError = static_cast<std::int32_t>(nativeError);
-                return value;
-            }));
-        co_return detail::Encode(result);
+        std::function<OperationResult()> operation = [command, args, workingDirectory]
+        {
+            OperationResult value;
+            int exitCode = 0;
+            int nativeError = 0;
+            value.succeeded = std_process::TryRunCapture(
+                command, args, workingDirectory, exitCode, value.output,
+                value.error, nativeError, value.message);
+            value.exitCode = static_cast<std::int32_t>(exitCode);
+            value.nativeError = static_cast<std::int32_t>(nativeError);
+            return value;
+        };
+        auto task = RunIoAsync<OperationResult>(std::move(operation));
+        OperationResult result = co_await task;
+        co_return detail::Complete(std::move(result));
     }
 
-    inline AsyncTask<std::string> ReadStdout(void* handle, const std::size_t maximumBytes)
+    inline AsyncTask<Any> ReadStdout(void* handle, const std::size_t maximumBytes)
     {
         OperationResult acquisition;
         auto lease = detail::Acquire(handle, acquisition);
@@ -256,7 +261,7 @@ namespace wio::runtime::std_async_process
         return detail::ReadStdoutOwned(std::move(lease), maximumBytes);
     }
 
-    inline AsyncTask<std::string> ReadStderr(void* handle, const std::size_t maximumBytes)
+    inline AsyncTask<Any> ReadStderr(void* handle, const std::size_t maximumBytes)
     {
         OperationResult acquisition;
         auto lease = detail::Acquire(handle, acquisition);
@@ -264,7 +269,7 @@ namespace wio::runtime::std_async_process
         return detail::ReadStderrOwned(std::move(lease), maximumBytes);
     }
 
-    inline AsyncTask<std::string> WriteStdin(void* handle, const std::string& bytes)
+    inline AsyncTask<Any> WriteStdin(void* handle, const std::string& bytes)
     {
         OperationResult acquisition;
         auto lease = detail::Acquire(handle, acquisition);
@@ -272,7 +277,7 @@ namespace wio::runtime::std_async_process
         return detail::WriteStdinOwned(std::move(lease), bytes);
     }
 
-    inline AsyncTask<std::string> Wait(void* handle)
+    inline AsyncTask<Any> Wait(void* handle)
     {
         OperationResult acquisition;
         auto lease = detail::Acquire(handle, acquisition);
@@ -280,8 +285,10 @@ namespace wio::runtime::std_async_process
         return detail::WaitOwned(std::move(lease));
     }
 
+    // Decode* consumes the completion of one awaited operation and moves its
+    // buffers out.
     inline void Decode(
-        const std::string& payload,
+        Any completion,
         bool& succeeded,
         std::int32_t& exitCode,
         std::string& output,
@@ -289,37 +296,37 @@ namespace wio::runtime::std_async_process
         std::int32_t& nativeError,
         std::string& message)
     {
-        const auto result = detail::Decode(payload);
+        auto& result = detail::Take(completion);
         succeeded = result.succeeded;
         exitCode = result.exitCode;
-        output = result.output;
+        output = std::move(result.output);
         error = result.error;
         nativeError = result.nativeError;
-        message = result.message;
+        message = std::move(result.message);
     }
 
     inline void DecodeStream(
-        const std::string& payload, bool& succeeded, std::string& bytes, bool& eof,
+        Any completion, bool& succeeded, std::string& bytes, bool& eof,
         std_process::ProcessError& error, std::int32_t& nativeError, std::string& message)
     {
-        const auto result = detail::Decode(payload);
+        auto& result = detail::Take(completion);
         succeeded = result.succeeded;
-        bytes = result.output;
+        bytes = std::move(result.output);
         eof = result.eof;
         error = result.error;
         nativeError = result.nativeError;
-        message = result.message;
+        message = std::move(result.message);
     }
 
     inline void DecodeWrite(
-        const std::string& payload, bool& succeeded, std::size_t& count,
+        Any completion, bool& succeeded, std::size_t& count,
         std_process::ProcessError& error, std::int32_t& nativeError, std::string& message)
     {
-        const auto result = detail::Decode(payload);
+        auto& result = detail::Take(completion);
         succeeded = result.succeeded;
         count = result.count;
         error = result.error;
         nativeError = result.nativeError;
-        message = result.message;
+        message = std::move(result.message);
     }
 }
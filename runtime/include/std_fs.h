@@ -3,6 +3,7 @@
 #include <cstdint>
 #include <filesystem>
 #include <fstream>
+#include <functional>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -23,6 +24,13 @@ namespace wio::runtime::std_fs
         Unknown = 9
     };
 
+    enum class WatchChangeKind : std::int32_t
+    {
+        Created = 0,
+        Modified = 1,
+        Removed = 2
+    };
+
     bool Exists(const std::string& path);
     bool IsFile(const std::string& path);
     bool IsDirectory(const std::string& path);
@@ -76,4 +84,29 @@ namespace wio::runtime::std_fs
     bool TryAbsoluteResult(const std::string& path, std::string& value, std::int32_t& error, std::int64_t& nativeError, std::string& message);
     bool TryCanonicalResult(const std::string& path, std::string& value, std::int32_t& error, std::int64_t& nativeError, std::string& message);
     bool TryRelativeResult(const std::string& path, const std::string& base, std::string& value, std::int32_t& error, std::int64_t& nativeError, std::string& message);
+
+    // Change notifications for a file, or for a directory and (when
+    // `recursive`) every directory below it. On Linux the changes come from
+    // inotify and a file is watched through its parent directory, so it may
+    // not exist yet; elsewhere, or when inotify cannot be set up (watch
+    // limits, a missing parent directory), WatchRefresh rescans the tree and
+    // diffs size and write time. Changes accumulate per path in the watch and
+    // coalesce until WatchTake moves them out: a burst of writes is one
+    // Modified entry, and a file created and removed in between vanishes.
+    bool WatchOpen(const std::string& path, bool recursive, void*& handle, std::int32_t& error, std::int64_t& nativeError, std::string& message);
+    [[nodiscard]] bool WatchUsesNotifications(void* handle) noexcept;
+    bool WatchRefresh(void* handle, bool& changed, std::int32_t& error, std::int64_t& nativeError, std::string& message);
+    bool WatchTake(void* handle, std::vector<std::string>& paths, std::vector<std::int32_t>& kinds, std::int32_t& error, std::int64_t& nativeError, std::string& message);
+
+    // Invokes `ready` once, from the readiness poller thread, when the
+    // inotify descriptor has events or the watch closes. Returns 0 when the
+    // watch polls; callers then rescan on their own interval.
+    [[nodiscard]] std::uint64_t WatchNotify(void* handle, std::function<void()> ready) noexcept;
+    void WatchCancelNotify(std::uint64_t token) noexcept;
+    [[nodiscard]] std::uint64_t WatchNotifyPendingCount() noexcept;
+
+    [[nodiscard]] bool WatchRetain(void* handle) noexcept;
+    [[nodiscard]] std::uint64_t LiveWatchCount() noexcept;
+    void WatchRelease(void* handle) noexcept;
+    void WatchClose(void* handle) noexcept;
 }
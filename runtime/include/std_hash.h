@@ -1,5 +1,7 @@
 #pragma once
 
+#include <array>
+#include <cstddef>
 #include <cstdint>
 #include <string>
 #include <string_view>
@@ -12,8 +14,55 @@ namespace wio::runtime::std_hash
     [[nodiscard]] std::uint32_t Fnv1a32Bytes(const std::vector<std::uint8_t>& value) noexcept;
     [[nodiscard]] std::uint64_t Fnv1a64Bytes(const std::vector<std::uint8_t>& value) noexcept;
 
+    // Non-cryptographic 64-bit hash in the wyhash family: 48-byte stripes
+    // folded through 64x64->128 multiply-mix rounds. Values are stable across
+    // platforms and runs, but not across releases of the runtime.
+    [[nodiscard]] std::uint64_t Fast64(std::string_view value) noexcept;
+    [[nodiscard]] std::uint64_t Fast64Bytes(const std::vector<std::uint8_t>& value) noexcept;
+    [[nodiscard]] std::uint64_t Fast64Raw(const void* data, std::size_t size, std::uint64_t seed = 0) noexcept;
+
     [[nodiscard]] std::string Sha256(std::string_view value);
     [[nodiscard]] std::string Sha256Bytes(const std::vector<std::uint8_t>& value);
     [[nodiscard]] std::vector<std::uint8_t> Sha256Digest(std::string_view value);
     [[nodiscard]] std::vector<std::uint8_t> Sha256DigestBytes(const std::vector<std::uint8_t>& value);
+
+    // True when block compression runs on the x86 SHA extensions. The
+    // implementation is picked once from CPUID; SetSha256Acceleration(false)
+    // forces the portable path (used to cross-check the two).
+    [[nodiscard]] bool Sha256Accelerated() noexcept;
+    void SetSha256Acceleration(bool enabled) noexcept;
+
+    // Incremental SHA-256. Input is compressed straight from the caller's
+    // buffer; only a partial trailing block is copied. Finish() returns the
+    // digest and resets the hasher for reuse.
+    class Sha256Hasher
+    {
+    public:
+        Sha256Hasher() noexcept;
+
+        void Reset() noexcept;
+        void Update(const std::uint8_t* data, std::size_t size) noexcept;
+        void Update(std::string_view value) noexcept;
+        [[nodiscard]] std::array<std::uint8_t, 32> Finish() noexcept;
+
+    private:
+        std::array<std::uint32_t, 8> state_;
+        std::array<std::uint8_t, 64> buffer_;
+        std::size_t buffered_;
+        std::uint64_t length_;
+    };
+
+    // Handle API behind std::hash::Sha256Hasher.
+    [[nodiscard]] void* Sha256Create();
+    void Sha256Destroy(void* handle) noexcept;
+    void Sha256Reset(void* handle) noexcept;
+    void Sha256UpdateText(void* handle, std::string_view value) noexcept;
+    void Sha256UpdateBytes(void* handle, const std::vector<std::uint8_t>& value) noexcept;
+    [[nodiscard]] std::vector<std::uint8_t> Sha256FinishDigest(void* handle);
+    [[nodiscard]] std::string Sha256FinishHex(void* handle);
+
+    // Streams the file through the hasher in fixed 64 KiB chunks; error codes
+    // follow std::fs::ErrorCode.
+    bool TrySha256FileResult(const std::string& path, std::string& value, std::int32_t& error,
+                             std::int64_t& nativeError, std::string& message);
 }
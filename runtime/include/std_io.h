@@ -353,6 +353,105 @@ namespace wio::runtime::std_io
         NativeErrorCode& nativeError,
         std::string& message) noexcept;
 
+    // Read-only view over a whole file. Regular files are memory-mapped;
+    // pipes, devices, procfs entries and anything the platform refuses to
+    // map are read into an owned buffer instead, so callers see the same
+    // bytes either way. Truncating a file while it is mapped is undefined
+    // (SIGBUS on POSIX), as with any mapping.
+    class MappedFile
+    {
+    public:
+        MappedFile() noexcept = default;
+        explicit MappedFile(std::string_view path);
+        ~MappedFile();
+
+        MappedFile(MappedFile&& other) noexcept;
+        MappedFile& operator=(MappedFile&& other) noexcept;
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        [[nodiscard]] std::string_view View() const noexcept { return {data_, size_}; }
+        [[nodiscard]] const char* Data() const noexcept { return data_; }
+        [[nodiscard]] std::size_t Size() const noexcept { return size_; }
+        [[nodiscard]] bool IsMapped() const noexcept { return mapped_; }
+
+    private:
+        void Unmap() noexcept;
+
+        const char* data_ = nullptr;
+        std::size_t size_ = 0;
+        bool mapped_ = false;
+#if defined(_WIN32)
+        void* mapping_ = nullptr;
+#endif
+        std::string buffer_;
+    };
+
+    // Advances `offset` past the next record in `source` and reports the
+    // record as [start, start + count), without the delimiter. A trailing
+    // record without a delimiter is still returned; false once exhausted.
+    [[nodiscard]] bool NextRecord(
+        std::string_view source,
+        std::size_t& offset,
+        char delimiter,
+        std::size_t& start,
+        std::size_t& count) noexcept;
+
+    [[nodiscard]] bool NextLine(
+        std::string_view source,
+        std::size_t& offset,
+        bool trimCarriageReturn,
+        std::size_t& start,
+        std::size_t& count) noexcept;
+
+    [[nodiscard]] std::size_t CountLines(std::string_view source) noexcept;
+
+    // Mapped file handles backing std::io::MappedFile. Mapping always
+    // yields a handle; a failed open is reported by TryValidateMapping and
+    // leaves an empty view behind. Ranges are clamped to the mapping.
+    [[nodiscard]] void* MapFile(std::string_view path);
+    void ReleaseMapping(void* handle) noexcept;
+
+    [[nodiscard]] bool TryValidateMapping(
+        void* handle,
+        FileError& error,
+        NativeErrorCode& nativeError,
+        std::string& message) noexcept;
+
+    [[nodiscard]] bool MappingIsMapped(void* handle) noexcept;
+    [[nodiscard]] std::uint64_t MappingSize(void* handle) noexcept;
+    [[nodiscard]] std::size_t MappingCountLines(void* handle) noexcept;
+
+    [[nodiscard]] bool MappingNextLine(
+        void* handle,
+        std::size_t& offset,
+        bool trimCarriageReturn,
+        std::size_t& start,
+        std::size_t& count) noexcept;
+
+    [[nodiscard]] bool MappingNextRecord(
+        void* handle,
+        std::size_t& offset,
+        char delimiter,
+        std::size_t& start,
+        std::size_t& count) noexcept;
+
+    [[nodiscard]] bool MappingField(
+        void* handle,
+        std::size_t start,
+        std::size_t count,
+        char delimiter,
+        std::size_t index,
+        std::size_t& fieldStart,
+        std::size_t& fieldCount) noexcept;
+
+    [[nodiscard]] std::string MappingText(void* handle, std::size_t start, std::size_t count);
+    [[nodiscard]] bool MappingParseI64(void* handle, std::size_t start, std::size_t count, std::int64_t& value) noexcept;
+    [[nodiscard]] bool MappingParseF64(void* handle, std::size_t start, std::size_t count, double& value) noexcept;
+    [[nodiscard]] bool MappingEquals(void* handle, std::size_t start, std::size_t count, std::string_view text) noexcept;
+    [[nodiscard]] bool MappingStartsWith(void* handle, std::size_t start, std::size_t count, std::string_view prefix) noexcept;
+    [[nodiscard]] bool MappingContains(void* handle, std::size_t start, std::size_t count, std::string_view needle) noexcept;
+
     [[nodiscard]] inline std::uintptr_t InvalidNativeFileHandleValue() noexcept
     {
     #if defined(_WIN32)
@@ -0,0 +1,774 @@
+#pragma once
+
+#include "ref.h"
+#include "std_serialization.h"
+#include "std_unicode.h"
+
+#include <algorithm>
+#include <bit>
+#include <charconv>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#define WIO_JSON_SSE2 1
+#include <emmintrin.h>
+#endif
+
+namespace wio::runtime::std_json
+{
+    // Tags match std::json::Kind.
+    enum class NodeKind : std::uint8_t
+    {
+        Null = 0,
+        Boolean = 1,
+        Integer = 2,
+        Number = 3,
+        String = 4,
+        Array = 5,
+        Object = 6
+    };
+
+    enum class DuplicateKeys : std::uint8_t
+    {
+        Reject = 0,
+        KeepFirst = 1,
+        KeepLast = 2
+    };
+
+    // One 16-byte tagged entry per value in document order. Containers carry
+    // their child count (an object member is a String key node followed by
+    // its value); strings and integer literals reference Document::text.
+    struct Node
+    {
+        NodeKind kind = NodeKind::Null;
+        bool boolean = false;
+        std::uint32_t length = 0;
+        std::uint64_t payload = 0;
+    };
+
+    // Parsed form of a JSON text. Decoded strings and integer literals live
+    // in one arena reserved up front at the source size, so views into it
+    // stay valid for the whole parse.
+    struct Document
+    {
+        std::vector<Node> nodes;
+        std::string text;
+
+        [[nodiscard]] std::string_view Text(const Node& node) const noexcept
+        {
+            return std::string_view(text).substr(static_cast<std::size_t>(node.payload), node.length);
+        }
+
+        [[nodiscard]] static double Number(const Node& node) noexcept
+        {
+            return std::bit_cast<double>(node.payload);
+        }
+    };
+
+    struct ParseLimits
+    {
+        std::size_t maxDepth = 128;
+        std::size_t maxBytes = 16u * 1024u * 1024u;
+        DuplicateKeys duplicateKeys = DuplicateKeys::Reject;
+    };
+
+    // Returns 0 on success, 1 for a syntax error and 2 when the input is
+    // refused before parsing (byte limit, invalid UTF-8); these are the
+    // std::json error codes. Duplicate keys are only checked here under
+    // DuplicateKeys::Reject; the other policies are applied by the consumer.
+    [[nodiscard]] std::int32_t ParseDocument(
+        std::string_view source, const ParseLimits& limits, Document& document, std::string& message);
+
+    void AppendQuoted(std::string& output, std::string_view value);
+    // Shortest round-trip form; non-finite values have no JSON spelling and
+    // are written as null.
+    void AppendNumber(std::string& output, double value);
+    void AppendIndent(std::string& output, std::size_t columns);
+
+    namespace detail
+    {
+        inline constexpr std::size_t LinearKeyCheckLimit = 16;
+
+        [[nodiscard]] inline bool isWhitespace(const char value) noexcept
+        {
+            return value == ' ' || value == '\t' || value == '\n' || value == '\r';
+        }
+
+        // Bytes that end a plain run inside a string: the closing quote, an
+        // escape, or a control character.
+        [[nodiscard]] inline bool isStringSpecial(const char value) noexcept
+        {
+            return value == '"' || value == '\\' || static_cast<unsigned char>(value) < 0x20u;
+        }
+
+        [[nodiscard]] inline bool isNumberByte(const char value) noexcept
+        {
+            return (value >= '0' && value <= '9') || value == '-' || value == '+' ||
+                   value == '.' || value == 'e' || value == 'E';
+        }
+
+        // The scanners below look at 16 bytes per step with SSE2 (baseline on
+        // x86-64) and fall back to a byte loop for the tail and elsewhere.
+        [[nodiscard]] inline const char* skipWhitespace(const char* cursor, const char* end) noexcept
+        {
+#if defined(WIO_JSON_SSE2)
+            if (cursor < end && isWhitespace(*cursor))
+            {
+                const __m128i space = _mm_set1_epi8(' ');
+                const __m128i tab = _mm_set1_epi8('\t');
+                const __m128i newline = _mm_set1_epi8('\n');
+                const __m128i carriage = _mm_set1_epi8('\r');
+                while (end - cursor >= 16)
+                {
+                    const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(cursor));
+                    const __m128i blank = _mm_or_si128(
+                        _mm_or_si128(_mm_cmpeq_epi8(chunk, space), _mm_cmpeq_epi8(chunk, tab)),
+                        _mm_or_si128(_mm_cmpeq_epi8(chunk, newline), _mm_cmpeq_epi8(chunk, carriage)));
+                    const auto mask = static_cast<unsigned>(_mm_movemask_epi8(blank)) ^ 0xffffu;
+                    if (mask != 0u)
+                        return cursor + std::countr_zero(mask);
+                    cursor += 16;
+                }
+            }
+#endif
+            while (cursor < end && isWhitespace(*cursor))
+                ++cursor;
+            return cursor;
+        }
+
+        [[nodiscard]] inline const char* findStringSpecial(const char* cursor, const char* end) noexcept
+        {
+#if defined(WIO_JSON_SSE2)
+            const __m128i quote = _mm_set1_epi8('"');
+            const __m128i backslash = _mm_set1_epi8('\\');
+            const __m128i controlLimit = _mm_set1_epi8(0x1f);
+            const __m128i zero = _mm_setzero_si128();
+            while (end - cursor >= 16)
+            {
+                const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(cursor));
+                const __m128i control = _mm_cmpeq_epi8(_mm_subs_epu8(chunk, controlLimit), zero);
+                const __m128i special = _mm_or_si128(
+                    _mm_or_si128(_mm_cmpeq_epi8(chunk, quote), _mm_cmpeq_epi8(chunk, backslash)), control);
+                const auto mask = static_cast<unsigned>(_mm_movemask_epi8(special));
+                if (mask != 0u)
+                    return cursor + std::countr_zero(mask);
+                cursor += 16;
+            }
+#endif
+            while (cursor < end && !isStringSpecial(*cursor))
+                ++cursor;
+            return cursor;
+        }
+
+        [[nodiscard]] inline bool isValidUtf8(const std::string_view source) noexcept
+        {
+            std::size_t offset = 0;
+            while (offset < source.size())
+            {
+#if defined(WIO_JSON_SSE2)
+                while (source.size() - offset >= 16)
+                {
+                    const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source.data() + offset));
+                    if (_mm_movemask_epi8(chunk) != 0)
+                        break;
+                    offset += 16;
+                }
+                if (offset >= source.size())
+                    break;
+#endif
+                if (static_cast<unsigned char>(source[offset]) < 0x80u)
+                {
+                    ++offset;
+                    continue;
+                }
+                std::uint32_t codePoint = 0;
+                if (!std_unicode::detail::decodeOne(source, offset, codePoint))
+                    return false;
+            }
+            return true;
+        }
+
+        inline void appendUtf8(std::string& output, const std::uint32_t codePoint)
+        {
+            if (codePoint <= 0x7fu)
+                output.push_back(static_cast<char>(codePoint));
+            else if (codePoint <= 0x7ffu)
+            {
+                output.push_back(static_cast<char>(0xc0u | (codePoint >> 6u)));
+                output.push_back(static_cast<char>(0x80u | (codePoint & 0x3fu)));
+            }
+            else if (codePoint <= 0xffffu)
+            {
+                output.push_back(static_cast<char>(0xe0u | (codePoint >> 12u)));
+                output.push_back(static_cast<char>(0x80u | ((codePoint >> 6u) & 0x3fu)));
+                output.push_back(static_cast<char>(0x80u | (codePoint & 0x3fu)));
+            }
+            else
+            {
+                output.push_back(static_cast<char>(0xf0u | (codePoint >> 18u)));
+                output.push_back(static_cast<char>(0x80u | ((codePoint >> 12u) & 0x3fu)));
+                output.push_back(static_cast<char>(0x80u | ((codePoint >> 6u) & 0x3fu)));
+                output.push_back(static_cast<char>(0x80u | (codePoint & 0x3fu)));
+            }
+        }
+
+        // Refuses the input before parsing: returns 2 with the message for the
+        // byte limit or invalid UTF-8, 0 otherwise.
+        [[nodiscard]] inline std::int32_t checkSource(
+            const std::string_view source, const ParseLimits& limits, std::string& message)
+        {
+            message.clear();
+            if (source.size() > limits.maxBytes)
+            {
+                message = "JSON input exceeds the configured byte limit.";
+                return 2;
+            }
+            if (!isValidUtf8(source))
+            {
+                message = "JSON input is not valid UTF-8.";
+                return 2;
+            }
+            return 0;
+        }
+
+        // Recursive-descent parser shared by ParseDocument and ParseValue. It
+        // hands each value to TSink in document order: scalars directly,
+        // strings decoded into the buffer the sink returns from BeginString or
+        // BeginKey, and containers as Begin/End pairs around their elements.
+        // EndKey returns false for a key the sink rejects as a duplicate.
+        template <typename TSink>
+        class Parser
+        {
+        public:
+            Parser(const std::string_view source, const ParseLimits& limits, TSink& sink)
+                : begin_(source.data()), cursor_(source.data()), end_(source.data() + source.size()),
+                  limits_(limits), sink_(sink)
+            {
+            }
+
+            bool Run()
+            {
+                if (!parseValue(0))
+                    return false;
+                cursor_ = skipWhitespace(cursor_, end_);
+                if (cursor_ != end_)
+                    return fail("Trailing characters.");
+                return true;
+            }
+
+            [[nodiscard]] const std::string& Failure() const noexcept { return failure_; }
+
+        private:
+            bool fail(const char* message)
+            {
+                if (failure_.empty())
+                {
+                    failure_ = "JSON parse error at byte " +
+                        std::to_string(static_cast<std::size_t>(cursor_ - begin_)) + ": " + message;
+                }
+                return false;
+            }
+
+            bool consumeLiteral(const std::string_view literal)
+            {
+                if (static_cast<std::size_t>(end_ - cursor_) < literal.size() ||
+                    std::memcmp(cursor_, literal.data(), literal.size()) != 0)
+                {
+                    return false;
+                }
+                cursor_ += literal.size();
+                return true;
+            }
+
+            bool parseValue(const std::size_t depth)
+            {
+                cursor_ = skipWhitespace(cursor_, end_);
+                if (cursor_ == end_)
+                    return fail("Expected a value.");
+
+                const char current = *cursor_;
+                if (current == '"')
+                {
+                    if (!parseString(sink_.BeginString()))
+                        return false;
+                    sink_.EndString();
+                    return true;
+                }
+                if (current == '[')
+                    return parseArray(depth + 1u);
+                if (current == '{')
+                    return parseObject(depth + 1u);
+                if (consumeLiteral("true"))
+                {
+                    sink_.Boolean(true);
+                    return true;
+                }
+                if (consumeLiteral("false"))
+                {
+                    sink_.Boolean(false);
+                    return true;
+                }
+                if (consumeLiteral("null"))
+                {
+                    sink_.Null();
+                    return true;
+                }
+                if ((current >= '0' && current <= '9') || current == '-')
+                    return parseNumber();
+                return fail("Unexpected token.");
+            }
+
+            // Decodes the string at the cursor, appending it to `output`.
+            // Plain runs are copied in one append.
+            bool parseString(std::string& output)
+            {
+                const std::size_t offset = output.size();
+                ++cursor_;
+                const char* run = cursor_;
+                while (true)
+                {
+                    cursor_ = findStringSpecial(cursor_, end_);
+                    if (cursor_ == end_)
+                        return fail("Unterminated string.");
+
+                    const char current = *cursor_;
+                    if (current == '"')
+                    {
+                        output.append(run, static_cast<std::size_t>(cursor_ - run));
+                        ++cursor_;
+                        break;
+                    }
+                    if (current == '\n' || current == '\r')
+                        return fail("Unescaped newline in string.");
+                    if (current != '\\')
+                    {
+                        ++cursor_;
+                        continue;
+                    }
+
+                    output.append(run, static_cast<std::size_t>(cursor_ - run));
+                    if (!parseEscape(output))
+                        return false;
+                    run = cursor_;
+                }
+
+                if (output.size() - offset > UINT32_MAX)
+                    return fail("String is too long.");
+                return true;
+            }
+
+            bool readHex4(std::uint32_t& value)
+            {
+                if (end_ - cursor_ < 4)
+                    return fail("Incomplete unicode escape.");
+                value = 0;
+                for (int i = 0; i < 4; ++i)
+                {
+                    const int digit = std_serialization::HexValue(cursor_[i]);
+                    if (digit < 0)
+                        return fail("Invalid unicode escape.");
+                    value = (value << 4u) | static_cast<std::uint32_t>(digit);
+                }
+                cursor_ += 4;
+                return true;
+            }
+
+            bool parseEscape(std::string& output)
+            {
+                ++cursor_;
+                if (cursor_ == end_)
+                    return fail("Unterminated string.");
+                const char escape = *cursor_++;
+                switch (escape)
+                {
+                case '"': output.push_back('"'); return true;
+                case '\\': output.push_back('\\'); return true;
+                case '/': output.push_back('/'); return true;
+                case 'b': output.push_back('\b'); return true;
+                case 'f': output.push_back('\f'); return true;
+                case 'n': output.push_back('\n'); return true;
+                case 'r': output.push_back('\r'); return true;
+                case 't': output.push_back('\t'); return true;
+                case 'u':
+                {
+                    std::uint32_t codePoint = 0;
+                    if (!readHex4(codePoint))
+                        return false;
+                    // A high surrogate followed by an escaped low surrogate
+                    // forms one supplementary code point; a lone surrogate is
+                    // kept as its three-byte form.
+                    if (codePoint >= 0xd800u && codePoint <= 0xdbffu && end_ - cursor_ >= 6 &&
+                        cursor_[0] == '\\' && cursor_[1] == 'u')
+                    {
+                        const char* saved = cursor_;
+                        cursor_ += 2;
+                        std::uint32_t low = 0;
+                        if (!readHex4(low))
+                            return false;
+                        if (low >= 0xdc00u && low <= 0xdfffu)
+                            codePoint = 0x10000u + ((codePoint - 0xd800u) << 10u) + (low - 0xdc00u);
+                        else
+                            cursor_ = saved;
+                    }
+                    appendUtf8(output, codePoint);
+                    return true;
+                }
+                default:
+                    --cursor_;
+                    return fail("Invalid escape sequence.");
+                }
+            }
+
+            bool parseNumber()
+            {
+                const char* start = cursor_;
+                while (cursor_ < end_ && isNumberByte(*cursor_))
+                    ++cursor_;
+                const std::string_view token(start, static_cast<std::size_t>(cursor_ - start));
+                if (!std_serialization::JsonNumberIsValid(token))
+                    return fail("Invalid number grammar.");
+
+                if (token.find_first_of(".eE") == std::string_view::npos)
+                {
+                    sink_.Integer(token);
+                    return true;
+                }
+
+                double value = 0.0;
+                const auto [last, error] = std::from_chars(token.data(), token.data() + token.size(), value);
+                if (error != std::errc() || last != token.data() + token.size() || !std::isfinite(value))
+                    return fail("Invalid number.");
+                sink_.Number(value);
+                return true;
+            }
+
+            bool parseArray(const std::size_t depth)
+            {
+                if (depth > limits_.maxDepth)
+                    return fail("Maximum nesting depth exceeded.");
+                sink_.BeginArray();
+                ++cursor_;
+                std::uint32_t count = 0;
+                cursor_ = skipWhitespace(cursor_, end_);
+                if (cursor_ < end_ && *cursor_ == ']')
+                {
+                    ++cursor_;
+                    sink_.EndArray(count);
+                    return true;
+                }
+                while (cursor_ < end_)
+                {
+                    if (!parseValue(depth))
+                        return false;
+                    ++count;
+                    cursor_ = skipWhitespace(cursor_, end_);
+                    if (cursor_ < end_ && *cursor_ == ']')
+                    {
+                        ++cursor_;
+                        sink_.EndArray(count);
+                        return true;
+                    }
+                    if (cursor_ == end_ || *cursor_ != ',')
+                        return fail("Expected ',' or ']' in array.");
+                    ++cursor_;
+                    cursor_ = skipWhitespace(cursor_, end_);
+                }
+                return fail("Unterminated array.");
+            }
+
+            bool parseObject(const std::size_t depth)
+            {
+                if (depth > limits_.maxDepth)
+                    return fail("Maximum nesting depth exceeded.");
+                sink_.BeginObject();
+                ++cursor_;
+                std::uint32_t count = 0;
+
+                cursor_ = skipWhitespace(cursor_, end_);
+                if (cursor_ < end_ && *cursor_ == '}')
+                {
+                    ++cursor_;
+                    sink_.EndObject(count);
+                    return true;
+                }
+                while (cursor_ < end_)
+                {
+                    if (*cursor_ != '"')
+                        return fail("Expected a string.");
+                    const char* keyStart = cursor_;
+                    std::string& key = sink_.BeginKey();
+                    const std::size_t keyOffset = key.size();
+                    if (!parseString(key))
+                        return false;
+                    if (!sink_.EndKey())
+                    {
+                        cursor_ = keyStart;
+                        return fail(("Duplicate object key '" + key.substr(keyOffset) + "'.").c_str());
+                    }
+
+                    cursor_ = skipWhitespace(cursor_, end_);
+                    if (cursor_ == end_ || *cursor_ != ':')
+                        return fail("Expected ':' after object key.");
+                    ++cursor_;
+                    if (!parseValue(depth))
+                        return false;
+                    ++count;
+
+                    cursor_ = skipWhitespace(cursor_, end_);
+                    if (cursor_ < end_ && *cursor_ == '}')
+                    {
+                        ++cursor_;
+                        sink_.EndObject(count);
+                        return true;
+                    }
+                    if (cursor_ == end_ || *cursor_ != ',')
+                        return fail("Expected ',' or '}' in object.");
+                    ++cursor_;
+                    cursor_ = skipWhitespace(cursor_, end_);
+                }
+                return fail("Unterminated object.");
+            }
+
+            const char* begin_;
+            const char* cursor_;
+            const char* end_;
+            const ParseLimits& limits_;
+            TSink& sink_;
+            std::string failure_;
+        };
+
+        // Builds the std::json::Value tree as the parser goes. Strings decode
+        // straight into the new value, and each object member is one map
+        // insertion made at its key: a duplicate is rejected there, or its
+        // value goes to the existing entry (KeepLast) or is dropped
+        // (KeepFirst).
+        template <typename TValue>
+        class TreeSink
+        {
+        public:
+            explicit TreeSink(const DuplicateKeys duplicateKeys) noexcept
+                : duplicateKeys_(duplicateKeys)
+            {
+            }
+
+            void Null() { add(NodeKind::Null); }
+            void Boolean(const bool value) { add(NodeKind::Boolean)->booleanValue = value; }
+            void Integer(const std::string_view token) { add(NodeKind::Integer)->integerText.assign(token); }
+            void Number(const double value) { add(NodeKind::Number)->numberValue = value; }
+
+            std::string& BeginString() { return add(NodeKind::String)->stringValue; }
+            void EndString() noexcept {}
+
+            std::string& BeginKey()
+            {
+                key_.clear();
+                return key_;
+            }
+
+            bool EndKey()
+            {
+                Frame& frame = frames_.back();
+                auto [member, inserted] = frame.value->objectValue.try_emplace(std::move(key_));
+                if (inserted || duplicateKeys_ == DuplicateKeys::KeepLast)
+                    frame.slot = &member->second;
+                else if (duplicateKeys_ == DuplicateKeys::KeepFirst)
+                    frame.slot = &dropped_;
+                else
+                    return false;
+                return true;
+            }
+
+            void BeginArray() { push(NodeKind::Array); }
+            void EndArray(std::uint32_t) { frames_.pop_back(); }
+            void BeginObject() { push(NodeKind::Object); }
+            void EndObject(std::uint32_t) { frames_.pop_back(); }
+
+            [[nodiscard]] Ref<TValue> TakeRoot() noexcept { return std::move(root_); }
+
+        private:
+            using Kind = decltype(std::declval<TValue&>().kind);
+
+            // An open container. Objects point `slot` at the entry for the key
+            // just read; arrays leave it null and append.
+            struct Frame
+            {
+                Ref<TValue> value;
+                Ref<TValue>* slot = nullptr;
+            };
+
+            TValue* add(const NodeKind kind)
+            {
+                auto value = Ref<TValue>::Create();
+                TValue* created = value.Get();
+                created->kind = static_cast<Kind>(kind);
+                if (frames_.empty())
+                    root_ = std::move(value);
+                else if (Frame& parent = frames_.back(); parent.slot)
+                    *parent.slot = std::move(value);
+                else
+                    parent.value->arrayValue.push_back(std::move(value));
+                return created;
+            }
+
+            void push(const NodeKind kind)
+            {
+                TValue* container = add(kind);
+                frames_.push_back(Frame{Ref<TValue>(container), nullptr});
+            }
+
+            DuplicateKeys duplicateKeys_;
+            Ref<TValue> root_;
+            // Holds a KeepFirst duplicate's value until the next one replaces it.
+            Ref<TValue> dropped_;
+            std::vector<Frame> frames_;
+            std::string key_;
+        };
+
+        template <typename TValue>
+        void write(std::string& output, const TValue* value, const bool pretty,
+                   const std::size_t depth, const std::size_t width)
+        {
+            if (!value)
+            {
+                output += "null";
+                return;
+            }
+
+            switch (static_cast<NodeKind>(value->kind))
+            {
+            case NodeKind::Null:
+                output += "null";
+                return;
+            case NodeKind::Boolean:
+                output += value->booleanValue ? "true" : "false";
+                return;
+            case NodeKind::Integer:
+                output += value->integerText;
+                return;
+            case NodeKind::Number:
+                AppendNumber(output, value->numberValue);
+                return;
+            case NodeKind::String:
+                AppendQuoted(output, value->stringValue);
+                return;
+            case NodeKind::Array:
+            {
+                const auto& items = value->arrayValue;
+                if (items.empty())
+                {
+                    output += "[]";
+                    return;
+                }
+                output.push_back('[');
+                for (std::size_t i = 0; i < items.size(); ++i)
+                {
+                    if (i > 0)
+                        output.push_back(',');
+                    if (pretty)
+                    {
+                        output.push_back('\n');
+                        AppendIndent(output, (depth + 1u) * width);
+                    }
+                    write(output, items[i].Get(), pretty, depth + 1u, width);
+                }
+                if (pretty)
+                {
+                    output.push_back('\n');
+                    AppendIndent(output, depth * width);
+                }
+                output.push_back(']');
+                return;
+            }
+            case NodeKind::Object:
+            {
+                const auto& members = value->objectValue;
+                if (members.empty())
+                {
+                    output += "{}";
+                    return;
+                }
+                // Keys are written in sorted order so output is deterministic.
+                using Member = typename std::remove_cvref_t<decltype(members)>::value_type;
+                std::vector<const Member*> ordered;
+                ordered.reserve(members.size());
+                for (const auto& member : members)
+                    ordered.push_back(&member);
+                std::sort(ordered.begin(), ordered.end(), [](const Member* left, const Member* right)
+                {
+                    return left->first < right->first;
+                });
+
+                output.push_back('{');
+                for (std::size_t i = 0; i < ordered.size(); ++i)
+                {
+                    if (i > 0)
+                        output.push_back(',');
+                    if (pretty)
+                    {
+                        output.push_back('\n');
+                        AppendIndent(output, (depth + 1u) * width);
+                    }
+                    AppendQuoted(output, ordered[i]->first);
+                    output += pretty ? ": " : ":";
+                    write(output, ordered[i]->second.Get(), pretty, depth + 1u, width);
+                }
+                if (pretty)
+                {
+                    output.push_back('\n');
+                    AppendIndent(output, depth * width);
+                }
+                output.push_back('}');
+                return;
+            }
+            }
+            output += "null";
+        }
+    }
+
+    // Backs std::json::Parse: builds the std::json::Value tree directly while
+    // parsing, with no intermediate document. THandle is the object handle
+    // the generated code passes for `ref Value`; it is only replaced on
+    // success.
+    template <typename TPolicy, typename THandle>
+    std::int32_t ParseValue(const std::string& source, const std::size_t maxDepth, const std::size_t maxBytes,
+                            const TPolicy duplicateKeys, THandle& root, std::string& message)
+    {
+        using TValue = std::remove_pointer_t<decltype(root.Get())>;
+
+        ParseLimits limits;
+        limits.maxDepth = maxDepth;
+        limits.maxBytes = maxBytes;
+        limits.duplicateKeys = static_cast<DuplicateKeys>(duplicateKeys);
+
+        if (const std::int32_t refused = detail::checkSource(source, limits, message); refused != 0)
+            return refused;
+
+        detail::TreeSink<TValue> sink(limits.duplicateKeys);
+        detail::Parser<detail::TreeSink<TValue>> parser(source, limits, sink);
+        if (!parser.Run())
+        {
+            message = parser.Failure();
+            return 1;
+        }
+        root = sink.TakeRoot();
+        return 0;
+    }
+
+    // Backs std::json::Write/WritePretty: serializes into one growing buffer.
+    template <typename THandle>
+    std::string WriteValue(const THandle& value, const bool pretty, const std::size_t depth, const std::size_t width)
+    {
+        std::string output;
+        output.reserve(256);
+        detail::write(output, value.Get(), pretty, depth, width);
+        return output;
+    }
+}
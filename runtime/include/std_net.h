@@ -2,6 +2,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -50,6 +51,44 @@ namespace wio::runtime::std_net
         std::string& remoteAddress,
         std::uint16_t& remotePort,
         std::string& error) noexcept;
+    // Non-blocking socket operations used by the readiness reactor. A
+    // would-block outcome returns false with `wouldBlock` set and no error.
+    [[nodiscard]] bool TrySend(
+        void* handle,
+        std::string_view bytes,
+        std::size_t& sent,
+        bool& wouldBlock,
+        std::string& error) noexcept;
+    [[nodiscard]] bool TryReceive(
+        void* handle,
+        std::size_t maximumBytes,
+        std::string& bytes,
+        bool& wouldBlock,
+        std::string& error) noexcept;
+    [[nodiscard]] bool TryWaitAccept(void* listener, bool& wouldBlock, std::string& error) noexcept;
+    [[nodiscard]] bool TryUdpReceiveFrom(
+        void* handle,
+        std::size_t maximumBytes,
+        std::string& bytes,
+        std::string& remoteAddress,
+        std::uint16_t& remotePort,
+        bool& wouldBlock,
+        std::string& error) noexcept;
+    [[nodiscard]] std::uint64_t ConfiguredTimeout(void* handle) noexcept;
+
+    // Readiness reactor. On Linux a dedicated epoll poller thread invokes
+    // `ready` once when the socket becomes readable/writable, reports an
+    // error, or is closed. Other platforms report ReactorAvailable() == false
+    // and asynchronous operations stay on the bounded I/O executor.
+    [[nodiscard]] bool ReactorAvailable() noexcept;
+    [[nodiscard]] std::uint64_t WatchReadiness(
+        void* handle,
+        bool writable,
+        std::function<void()> ready,
+        std::string& error) noexcept;
+    void CancelReadiness(std::uint64_t token) noexcept;
+    [[nodiscard]] std::uint64_t ReactorPendingCount() noexcept;
+
     [[nodiscard]] bool Retain(void* handle, std::string& error) noexcept;
     [[nodiscard]] std::uint64_t LiveSocketCount() noexcept;
     void Release(void* handle) noexcept;
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstdint>
+#include <functional>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -82,8 +83,29 @@ namespace wio::runtime::std_process
         ProcessError& error, int& nativeError, std::string& message) noexcept;
     [[nodiscard]] bool ProcessTerminate(
         void* handle, ProcessError& error, int& nativeError, std::string& message) noexcept;
+
+    enum class ProcessEvent : std::uint8_t
+    {
+        stdout_readable = 0,
+        stderr_readable = 1,
+        exited = 2
+    };
+
+    // Readiness notifications for the asynchronous process operations. On
+    // Linux an epoll poller thread invokes `ready` once when the watched pipe
+    // has data or hangs up, when the child exits (through a pidfd), or when
+    // the process is closed. ProcessWatch returns 0 when no notification can
+    // be registered (other platforms, kernels without pidfd_open, a closed
+    // process); callers then fall back to polling.
+    [[nodiscard]] std::uint64_t ProcessWatch(
+        void* handle, ProcessEvent event, std::function<void()> ready) noexcept;
+    void ProcessCancelWatch(std::uint64_t token) noexcept;
+    [[nodiscard]] std::uint64_t ProcessWatchPendingCount() noexcept;
+
     [[nodiscard]] bool ProcessRetain(void* handle, std::string& message) noexcept;
     [[nodiscard]] std::uint64_t LiveProcessCount() noexcept;
+    // Retained leases on an open handle, not counting the handle itself.
+    [[nodiscard]] std::uint64_t ProcessLeaseCount(void* handle) noexcept;
     void ProcessRelease(void* handle) noexcept;
     void ProcessClose(void* handle) noexcept;
 }
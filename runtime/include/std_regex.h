@@ -17,6 +17,11 @@ namespace wio::runtime::std_regex
     [[nodiscard]] const char* ToString(RegexError error) noexcept;
     [[nodiscard]] int ErrorValue(RegexError error) noexcept;
 
+    // The string-pattern entry points compile through a small LRU cache, so a
+    // pattern used in a loop is compiled once. Patterns within the automaton
+    // syntax (literals, classes, groups, alternation, greedy and lazy
+    // quantifiers, anchors, word boundaries) run in linear time; others, such
+    // as backreferences and lookahead, go to std::regex.
     [[nodiscard]] bool TryIsMatch(
         std::string_view input,
         std::string_view pattern,
@@ -62,6 +67,57 @@ namespace wio::runtime::std_regex
         RegexError& error,
         std::string& message) noexcept;
 
+    // Compiled pattern handles backing std::regex::Regex. Compiling always
+    // yields a handle; an invalid pattern's handle reports the compile error
+    // from every call.
+    [[nodiscard]] void* Compile(std::string_view pattern, bool ignoreCase);
+    void Release(void* handle) noexcept;
+    [[nodiscard]] bool TryValidate(void* handle, RegexError& error, std::string& message) noexcept;
+    [[nodiscard]] bool UsesLinearEngine(void* handle) noexcept;
+
+    [[nodiscard]] bool TryIsMatchCompiled(
+        void* handle,
+        std::string_view input,
+        bool& matched,
+        RegexError& error,
+        std::string& message) noexcept;
+
+    [[nodiscard]] bool TryFindCompiled(
+        void* handle,
+        std::string_view input,
+        bool& found,
+        std::size_t& index,
+        std::size_t& length,
+        std::string& value,
+        std::vector<std::string>& groups,
+        RegexError& error,
+        std::string& message) noexcept;
+
+    [[nodiscard]] bool TryFindAllCompiled(
+        void* handle,
+        std::string_view input,
+        std::vector<std::string>& matches,
+        RegexError& error,
+        std::string& message) noexcept;
+
+    [[nodiscard]] bool TryReplaceCompiled(
+        void* handle,
+        std::string_view input,
+        std::string_view replacement,
+        std::string& output,
+        RegexError& error,
+        std::string& message) noexcept;
+
+    [[nodiscard]] bool TrySplitCompiled(
+        void* handle,
+        std::string_view input,
+        std::vector<std::string>& output,
+        RegexError& error,
+        std::string& message) noexcept;
+
+    [[nodiscard]] std::size_t CachedPatternCount() noexcept;
+    void ClearPatternCache() noexcept;
+
     [[nodiscard]] std::string Escape(std::string_view value);
     [[nodiscard]] bool PatternLooksSafe(std::string_view pattern) noexcept;
 }
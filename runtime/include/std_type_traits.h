@@ -32,9 +32,15 @@ namespace wio::runtime::traits
     template <typename K, typename V, typename... Rest>
     inline constexpr bool IsStdDictionary<std::unordered_map<K, V, Rest...>> = true;
 
+    template <typename K, typename V, typename... Rest>
+    inline constexpr bool IsStdDictionary<wio::FlatHashMap<K, V, Rest...>> = true;
+
     template <typename K, typename V, typename... Rest>
     inline constexpr bool IsStdDictionary<std::map<K, V, Rest...>> = true;
 
+    template <typename K, typename V, typename... Rest>
+    inline constexpr bool IsStdDictionary<wio::BTreeMap<K, V, Rest...>> = true;
+
     template <typename T>
     [[nodiscard]] constexpr bool IsIntegerValue() noexcept
     {
@@ -3,6 +3,9 @@
 #include "ref.h"
 #include "text.h"
 
+#include <wio_btree_map.h>
+#include <wio_flat_hash_map.h>
+
 #include <array>
 #include <cstddef>
 #include <cstdint>
@@ -94,6 +97,11 @@ namespace wio::runtime
         static constexpr std::array<std::string_view, 0> BaseTypes{};
     };
 
+    template <typename K, typename V, typename... Rest>
+    struct TypeReflection<wio::FlatHashMap<K, V, Rest...>> : TypeReflection<std::unordered_map<K, V>>
+    {
+    };
+
     template <typename K, typename V, typename... Rest>
     struct TypeReflection<std::map<K, V, Rest...>>
     {
@@ -108,6 +116,11 @@ namespace wio::runtime
         static constexpr std::array<std::string_view, 0> BaseTypes{};
     };
 
+    template <typename K, typename V, typename... Rest>
+    struct TypeReflection<wio::BTreeMap<K, V, Rest...>> : TypeReflection<std::map<K, V>>
+    {
+    };
+
     template <typename T>
     [[nodiscard]] inline std::string ReflectedTypeName()
     {
@@ -0,0 +1,37 @@
+#pragma once
+
+// Headers every generated translation unit includes before its own code.
+// Generated C++ includes this file first so the backend can substitute a
+// precompiled copy; keep it free of anything that depends on the program.
+
+#include <cstdint>
+#include <cstddef>
+#include <algorithm>
+#include <limits>
+#include <string>
+#include <utility>
+#include <vector>
+#include <array>
+#include <iostream>
+#include <functional>
+#include <map>
+#include <stdexcept>
+#include <unordered_map>
+
+#include "format.h"
+#include "exception.h"
+#include "constant_value.h"
+#include "any.h"
+#include "enum_reflection.h"
+#include "type_reflection.h"
+#include "fit.h"
+#include "function_ref.h"
+#include "intrinsics.h"
+#include "meta.h"
+#include "owned_argument.h"
+#include <module_api.h>
+#include <wio_btree_map.h>
+#include <wio_flat_hash_map.h>
+#include "ref.h"
+#include "std_async.h"
+#include "text.h"
@@ -0,0 +1,243 @@
+#pragma once
+
+#if defined(__linux__)
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+
+namespace wio::runtime::detail
+{
+    // One epoll set and one poller thread per owner (sockets, child
+    // processes). Waiters are one-shot: readiness, an error/hang-up report, or
+    // an explicit WakeAll removes them and invokes their callback outside the
+    // reactor lock. Interest masks are level-triggered and only contain
+    // directions that still have waiters, so a drained descriptor stays quiet.
+    class ReadinessReactor final
+    {
+    public:
+        ReadinessReactor()
+        {
+            epoll_ = epoll_create1(EPOLL_CLOEXEC);
+            wake_ = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+            if (epoll_ < 0 || wake_ < 0)
+                return;
+            epoll_event event{};
+            event.events = EPOLLIN;
+            event.data.fd = wake_;
+            if (epoll_ctl(epoll_, EPOLL_CTL_ADD, wake_, &event) != 0)
+                return;
+            try
+            {
+                poller_ = std::thread([this] { Run(); });
+                available_ = true;
+            }
+            catch (...)
+            {
+            }
+        }
+
+        ReadinessReactor(const ReadinessReactor&) = delete;
+        ReadinessReactor& operator=(const ReadinessReactor&) = delete;
+
+        bool Available() const noexcept { return available_; }
+
+        // Returns 0 and reports errno in `nativeError` when the descriptor
+        // cannot be added to the epoll set.
+        std::uint64_t Watch(
+            const int descriptor,
+            const bool writable,
+            std::function<void()> ready,
+            int& nativeError)
+        {
+            std::lock_guard lock(mutex_);
+            auto& interest = interests_[descriptor];
+            const std::uint64_t token = ++nextToken_;
+            auto& waiters = writable ? interest.writers : interest.readers;
+            waiters.push_back(Waiter{token, std::move(ready)});
+            if (!Apply(descriptor, interest))
+            {
+                nativeError = errno;
+                waiters.pop_back();
+                if (interest.readers.empty() && interest.writers.empty())
+                    interests_.erase(descriptor);
+                return 0;
+            }
+            tokens_.emplace(token, descriptor);
+            return token;
+        }
+
+        void Cancel(const std::uint64_t token) noexcept
+        {
+            std::lock_guard lock(mutex_);
+            const auto found = tokens_.find(token);
+            if (found == tokens_.end())
+                return;
+            const int descriptor = found->second;
+            tokens_.erase(found);
+            const auto interest = interests_.find(descriptor);
+            if (interest == interests_.end())
+                return;
+            const auto matches = [token](const Waiter& waiter) { return waiter.token == token; };
+            std::erase_if(interest->second.readers, matches);
+            std::erase_if(interest->second.writers, matches);
+            Settle(interest);
+        }
+
+        // Wakes every waiter for a descriptor and drops it from the epoll set.
+        // Owners call this before closing a watched descriptor: some closes
+        // raise no epoll event (an unconnected UDP socket), and a descriptor
+        // number reused after close must not inherit stale waiters.
+        void WakeAll(const int descriptor) noexcept
+        {
+            std::vector<Waiter> woken;
+            {
+                std::lock_guard lock(mutex_);
+                const auto interest = interests_.find(descriptor);
+                if (interest == interests_.end())
+                    return;
+                Take(interest->second.readers, woken);
+                Take(interest->second.writers, woken);
+                Settle(interest);
+            }
+            Invoke(woken);
+        }
+
+        std::uint64_t PendingCount() const noexcept
+        {
+            std::lock_guard lock(mutex_);
+            return static_cast<std::uint64_t>(tokens_.size());
+        }
+
+    private:
+        struct Waiter final
+        {
+            std::uint64_t token = 0;
+            std::function<void()> ready;
+        };
+
+        struct Interest final
+        {
+            std::vector<Waiter> readers;
+            std::vector<Waiter> writers;
+            std::uint32_t mask = 0;
+        };
+
+        using InterestMap = std::unordered_map<int, Interest>;
+
+        bool Apply(const int descriptor, Interest& interest) noexcept
+        {
+            std::uint32_t mask = 0;
+            if (!interest.readers.empty())
+                mask |= EPOLLIN | EPOLLRDHUP;
+            if (!interest.writers.empty())
+                mask |= EPOLLOUT;
+            if (mask == interest.mask)
+                return true;
+
+            epoll_event event{};
+            event.events = mask;
+            event.data.fd = descriptor;
+            int result = 0;
+            if (mask == 0)
+                result = epoll_ctl(epoll_, EPOLL_CTL_DEL, descriptor, &event);
+            else if (interest.mask == 0)
+                result = epoll_ctl(epoll_, EPOLL_CTL_ADD, descriptor, &event);
+            else
+                result = epoll_ctl(epoll_, EPOLL_CTL_MOD, descriptor, &event);
+            if (result != 0 && mask != 0)
+                return false;
+            interest.mask = mask;
+            return true;
+        }
+
+        void Settle(const InterestMap::iterator interest) noexcept
+        {
+            static_cast<void>(Apply(interest->first, interest->second));
+            if (interest->second.readers.empty() && interest->second.writers.empty())
+                interests_.erase(interest);
+        }
+
+        void Take(std::vector<Waiter>& waiters, std::vector<Waiter>& woken)
+        {
+            for (auto& waiter : waiters)
+            {
+                tokens_.erase(waiter.token);
+                woken.push_back(std::move(waiter));
+            }
+            waiters.clear();
+        }
+
+        static void Invoke(std::vector<Waiter>& woken) noexcept
+        {
+            for (auto& waiter : woken)
+            {
+                try { waiter.ready(); }
+                catch (...) { }
+            }
+        }
+
+        void Run()
+        {
+            epoll_event events[64];
+            std::vector<Waiter> woken;
+            for (;;)
+            {
+                const int count = epoll_wait(epoll_, events, 64, -1);
+                if (count < 0)
+                {
+                    if (errno == EINTR)
+                        continue;
+                    return;
+                }
+
+                {
+                    std::lock_guard lock(mutex_);
+                    for (int index = 0; index < count; ++index)
+                    {
+                        const int descriptor = events[index].data.fd;
+                        if (descriptor == wake_)
+                        {
+                            eventfd_t drained = 0;
+                            static_cast<void>(eventfd_read(wake_, &drained));
+                            continue;
+                        }
+                        const auto interest = interests_.find(descriptor);
+                        if (interest == interests_.end())
+                            continue;
+                        const std::uint32_t flags = events[index].events;
+                        const bool failed = (flags & (EPOLLERR | EPOLLHUP)) != 0;
+                        if (failed || (flags & (EPOLLIN | EPOLLRDHUP)) != 0)
+                            Take(interest->second.readers, woken);
+                        if (failed || (flags & EPOLLOUT) != 0)
+                            Take(interest->second.writers, woken);
+                        Settle(interest);
+                    }
+                }
+
+                Invoke(woken);
+                woken.clear();
+            }
+        }
+
+        mutable std::mutex mutex_;
+        InterestMap interests_;
+        std::unordered_map<std::uint64_t, int> tokens_;
+        std::uint64_t nextToken_ = 0;
+        std::thread poller_;
+        int epoll_ = -1;
+        int wake_ = -1;
+        bool available_ = false;
+    };
+}
+
+#endif
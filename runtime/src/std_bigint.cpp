@@ -0,0 +1,734 @@
+#include "std_bigint.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <span>
+#include <utility>
+
+namespace wio::runtime::std_bigint
+{
+    namespace
+    {
+        using Limb = std::uint64_t;
+        using Limbs = std::vector<Limb>;
+        using View = std::span<const Limb>;
+
+        // Below this many limbs in the shorter operand schoolbook
+        // multiplication beats Karatsuba's extra additions.
+        constexpr std::size_t KaratsubaThreshold = 32;
+        constexpr Limb DecimalChunk = 10000000000000000000ull;
+        constexpr std::size_t DecimalChunkDigits = 19;
+
+        struct Wide
+        {
+            Limb low;
+            Limb high;
+        };
+
+        Wide multiplyWide(const Limb left, const Limb right) noexcept
+        {
+#if defined(__SIZEOF_INT128__)
+            const unsigned __int128 product = static_cast<unsigned __int128>(left) * right;
+            return { static_cast<Limb>(product), static_cast<Limb>(product >> 64) };
+#else
+            const Limb leftLow = left & 0xffffffffu, leftHigh = left >> 32;
+            const Limb rightLow = right & 0xffffffffu, rightHigh = right >> 32;
+            const Limb lowLow = leftLow * rightLow, lowHigh = leftLow * rightHigh;
+            const Limb highLow = leftHigh * rightLow, highHigh = leftHigh * rightHigh;
+            const Limb middle = (lowLow >> 32) + (lowHigh & 0xffffffffu) + (highLow & 0xffffffffu);
+            return { (middle << 32) | (lowLow & 0xffffffffu), highHigh + (lowHigh >> 32) + (highLow >> 32) + (middle >> 32) };
+#endif
+        }
+
+        // Divides high:low by divisor. Requires high < divisor.
+        Limb divideWide(const Limb high, const Limb low, const Limb divisor, Limb& remainder) noexcept
+        {
+#if defined(__SIZEOF_INT128__)
+            const unsigned __int128 dividend = (static_cast<unsigned __int128>(high) << 64) | low;
+            remainder = static_cast<Limb>(dividend % divisor);
+            return static_cast<Limb>(dividend / divisor);
+#else
+            // Two 32-bit quotient digits over a normalized divisor (Hacker's Delight, divlu).
+            constexpr Limb base = 1ull << 32;
+            const int shift = std::countl_zero(divisor);
+            const Limb normalized = divisor << shift;
+            const Limb divisorHigh = normalized >> 32, divisorLow = normalized & 0xffffffffu;
+            const Limb dividendHigh = shift == 0 ? high : (high << shift) | (low >> (64 - shift));
+            const Limb dividendLow = low << shift;
+            const Limb digit1 = dividendLow >> 32, digit0 = dividendLow & 0xffffffffu;
+
+            Limb quotientHigh = dividendHigh / divisorHigh;
+            Limb rest = dividendHigh - quotientHigh * divisorHigh;
+            while (quotientHigh >= base || quotientHigh * divisorLow > base * rest + digit1)
+            {
+                --quotientHigh;
+                rest += divisorHigh;
+                if (rest >= base) break;
+            }
+            const Limb partial = dividendHigh * base + digit1 - quotientHigh * normalized;
+            Limb quotientLow = partial / divisorHigh;
+            rest = partial - quotientLow * divisorHigh;
+            while (quotientLow >= base || quotientLow * divisorLow > base * rest + digit0)
+            {
+                --quotientLow;
+                rest += divisorHigh;
+                if (rest >= base) break;
+            }
+            remainder = (partial * base + digit0 - quotientLow * normalized) >> shift;
+            return quotientHigh * base + quotientLow;
+#endif
+        }
+
+        void trim(Limbs& value) noexcept
+        {
+            while (!value.empty() && value.back() == 0) value.pop_back();
+        }
+
+        View trimmed(View value) noexcept
+        {
+            while (!value.empty() && value.back() == 0) value = value.first(value.size() - 1);
+            return value;
+        }
+
+        // ---- Magnitudes: little-endian limbs without leading zero limbs ----
+
+        int compareMagnitude(const View left, const View right) noexcept
+        {
+            if (left.size() != right.size()) return left.size() < right.size() ? -1 : 1;
+            for (std::size_t index = left.size(); index-- > 0;)
+                if (left[index] != right[index]) return left[index] < right[index] ? -1 : 1;
+            return 0;
+        }
+
+        Limbs addMagnitude(View left, View right)
+        {
+            if (left.size() < right.size()) std::swap(left, right);
+            Limbs result(left.size() + 1, 0);
+            Limb carry = 0;
+            for (std::size_t index = 0; index < left.size(); ++index)
+            {
+                const Limb addend = index < right.size() ? right[index] : 0;
+                Limb sum = left[index] + addend;
+                Limb nextCarry = sum < addend;
+                sum += carry;
+                nextCarry += sum < carry;
+                result[index] = sum;
+                carry = nextCarry;
+            }
+            result[left.size()] = carry;
+            trim(result);
+            return result;
+        }
+
+        // Requires left >= right.
+        Limbs subtractMagnitude(const View left, const View right)
+        {
+            Limbs result(left.begin(), left.end());
+            Limb borrow = 0;
+            for (std::size_t index = 0; index < result.size() && (index < right.size() || borrow != 0); ++index)
+            {
+                const Limb subtrahend = index < right.size() ? right[index] : 0;
+                const Limb difference = result[index] - subtrahend;
+                Limb nextBorrow = result[index] < subtrahend;
+                nextBorrow += difference < borrow;
+                result[index] = difference - borrow;
+                borrow = nextBorrow;
+            }
+            trim(result);
+            return result;
+        }
+
+        // target += value * 2^(64 * offset); target must be wide enough for the sum.
+        void addInto(Limbs& target, const View value, const std::size_t offset) noexcept
+        {
+            Limb carry = 0;
+            std::size_t index = 0;
+            for (; index < value.size(); ++index)
+            {
+                Limb& slot = target[offset + index];
+                Limb sum = slot + value[index];
+                Limb nextCarry = sum < slot;
+                sum += carry;
+                nextCarry += sum < carry;
+                slot = sum;
+                carry = nextCarry;
+            }
+            for (std::size_t slot = offset + index; carry != 0 && slot < target.size(); ++slot)
+                carry = ++target[slot] == 0;
+        }
+
+        // target -= value; requires target >= value.
+        void subtractInto(Limbs& target, const View value) noexcept
+        {
+            Limb borrow = 0;
+            std::size_t index = 0;
+            for (; index < value.size(); ++index)
+            {
+                const Limb difference = target[index] - value[index];
+                Limb nextBorrow = target[index] < value[index];
+                nextBorrow += difference < borrow;
+                target[index] = difference - borrow;
+                borrow = nextBorrow;
+            }
+            for (; borrow != 0 && index < target.size(); ++index)
+                borrow = target[index]-- == 0;
+            trim(target);
+        }
+
+        // output must hold left.size() + right.size() zeroed limbs.
+        void multiplySchoolbook(const View left, const View right, Limb* output) noexcept
+        {
+            for (std::size_t row = 0; row < left.size(); ++row)
+            {
+                const Limb factor = left[row];
+                if (factor == 0) continue;
+                Limb carry = 0;
+                for (std::size_t column = 0; column < right.size(); ++column)
+                {
+                    const auto product = multiplyWide(factor, right[column]);
+                    Limb low = product.low + output[row + column];
+                    Limb high = product.high + (low < product.low);
+                    low += carry;
+                    high += low < carry;
+                    output[row + column] = low;
+                    carry = high;
+                }
+                output[row + right.size()] = carry;
+            }
+        }
+
+        Limbs multiplyMagnitude(View left, View right)
+        {
+            if (left.empty() || right.empty()) return {};
+            if (left.size() < right.size()) std::swap(left, right);
+
+            Limbs result(left.size() + right.size(), 0);
+            if (right.size() < KaratsubaThreshold)
+            {
+                multiplySchoolbook(left, right, result.data());
+                trim(result);
+                return result;
+            }
+
+            if (right.size() * 2 <= left.size())
+            {
+                // Unbalanced operands: multiply right-sized slices of the longer one.
+                for (std::size_t offset = 0; offset < left.size(); offset += right.size())
+                {
+                    const auto slice = trimmed(left.subspan(offset, std::min(right.size(), left.size() - offset)));
+                    const auto partial = multiplyMagnitude(slice, right);
+                    addInto(result, partial, offset);
+                }
+                trim(result);
+                return result;
+            }
+
+            // Karatsuba: (a1 B + a0)(b1 B + b0) = z2 B^2 + z1 B + z0 with
+            // z1 = (a0 + a1)(b0 + b1) - z0 - z2.
+            const std::size_t half = left.size() / 2;
+            const auto leftLow = trimmed(left.first(half)), leftHigh = left.subspan(half);
+            const auto rightLow = trimmed(right.first(half)), rightHigh = trimmed(right.subspan(half));
+            const auto low = multiplyMagnitude(leftLow, rightLow);
+            const auto high = multiplyMagnitude(leftHigh, rightHigh);
+            auto middle = multiplyMagnitude(addMagnitude(leftLow, leftHigh), addMagnitude(rightLow, rightHigh));
+            subtractInto(middle, low);
+            subtractInto(middle, high);
+            addInto(result, low, 0);
+            addInto(result, middle, half);
+            addInto(result, high, 2 * half);
+            trim(result);
+            return result;
+        }
+
+        // Divides value in place by a single limb and returns the remainder.
+        Limb divideSmall(Limbs& value, const Limb divisor) noexcept
+        {
+            Limb remainder = 0;
+            for (std::size_t index = value.size(); index-- > 0;)
+                value[index] = divideWide(remainder, value[index], divisor, remainder);
+            trim(value);
+            return remainder;
+        }
+
+        void multiplyAddSmall(Limbs& value, const Limb factor, const Limb addend)
+        {
+            Limb carry = addend;
+            for (Limb& limb : value)
+            {
+                const auto product = multiplyWide(limb, factor);
+                limb = product.low + carry;
+                carry = product.high + (limb < carry);
+            }
+            if (carry != 0) value.push_back(carry);
+        }
+
+        Limbs shiftLeftMagnitude(const View value, const std::uint64_t bits)
+        {
+            if (value.empty()) return {};
+            const auto limbShift = static_cast<std::size_t>(bits / 64);
+            const auto bitShift = static_cast<unsigned>(bits % 64);
+            Limbs result(value.size() + limbShift + 1, 0);
+            for (std::size_t index = 0; index < value.size(); ++index)
+            {
+                result[index + limbShift] |= value[index] << bitShift;
+                if (bitShift != 0) result[index + limbShift + 1] = value[index] >> (64 - bitShift);
+            }
+            trim(result);
+            return result;
+        }
+
+        Limbs shiftRightMagnitude(const View value, const std::uint64_t bits)
+        {
+            if (bits / 64 >= value.size()) return {};
+            const auto limbShift = static_cast<std::size_t>(bits / 64);
+            const auto bitShift = static_cast<unsigned>(bits % 64);
+            Limbs result(value.size() - limbShift, 0);
+            for (std::size_t index = 0; index < result.size(); ++index)
+            {
+                result[index] = value[index + limbShift] >> bitShift;
+                if (bitShift != 0 && index + limbShift + 1 < value.size())
+                    result[index] |= value[index + limbShift + 1] << (64 - bitShift);
+            }
+            trim(result);
+            return result;
+        }
+
+        // Knuth, TAOCP vol. 2, 4.3.1, Algorithm D. Either output may be null.
+        void divideMagnitude(const View dividend, const View divisor, Limbs* quotient, Limbs* remainder)
+        {
+            if (compareMagnitude(dividend, divisor) < 0)
+            {
+                if (quotient) quotient->clear();
+                if (remainder) remainder->assign(dividend.begin(), dividend.end());
+                return;
+            }
+            if (divisor.size() == 1)
+            {
+                Limbs result(dividend.begin(), dividend.end());
+                const Limb rest = divideSmall(result, divisor[0]);
+                if (remainder)
+                {
+                    remainder->clear();
+                    if (rest != 0) remainder->push_back(rest);
+                }
+                if (quotient) *quotient = std::move(result);
+                return;
+            }
+
+            // Normalize so the divisor's top limb has its high bit set; this
+            // keeps each quotient estimate at most two above the true digit.
+            const auto shift = static_cast<unsigned>(std::countl_zero(divisor.back()));
+            auto v = shiftLeftMagnitude(divisor, shift);
+            auto u = shiftLeftMagnitude(dividend, shift);
+            u.resize(dividend.size() + 1, 0);
+            const std::size_t n = v.size();
+            const std::size_t m = dividend.size() - n;
+            Limbs digits(m + 1, 0);
+
+            for (std::size_t j = m + 1; j-- > 0;)
+            {
+                const Limb top = u[j + n], next = u[j + n - 1];
+                Limb estimate = 0, rest = 0;
+                bool restOverflow = false;
+                if (top >= v[n - 1])
+                {
+                    estimate = ~Limb{0};
+                    rest = next + v[n - 1];
+                    restOverflow = rest < next;
+                }
+                else
+                {
+                    estimate = divideWide(top, next, v[n - 1], rest);
+                }
+                while (!restOverflow)
+                {
+                    const auto product = multiplyWide(estimate, v[n - 2]);
+                    if (product.high < rest || (product.high == rest && product.low <= u[j + n - 2]))
+                        break;
+                    --estimate;
+                    rest += v[n - 1];
+                    restOverflow = rest < v[n - 1];
+                }
+
+                Limb borrow = 0, carry = 0;
+                for (std::size_t index = 0; index < n; ++index)
+                {
+                    const auto product = multiplyWide(estimate, v[index]);
+                    const Limb low = product.low + carry;
+                    carry = product.high + (low < carry);
+                    const Limb difference = u[index + j] - low;
+                    Limb nextBorrow = u[index + j] < low;
+                    nextBorrow += difference < borrow;
+                    u[index + j] = difference - borrow;
+                    borrow = nextBorrow;
+                }
+                const Limb difference = u[j + n] - carry;
+                Limb finalBorrow = u[j + n] < carry;
+                finalBorrow += difference < borrow;
+                u[j + n] = difference - borrow;
+
+                if (finalBorrow != 0)
+                {
+                    // The estimate was one too large: add the divisor back.
+                    --estimate;
+                    Limb addCarry = 0;
+                    for (std::size_t index = 0; index < n; ++index)
+                    {
+                        Limb sum = u[index + j] + v[index];
+                        Limb nextCarry = sum < v[index];
+                        sum += addCarry;
+                        nextCarry += sum < addCarry;
+                        u[index + j] = sum;
+                        addCarry = nextCarry;
+                    }
+                    u[j + n] += addCarry;
+                }
+                digits[j] = estimate;
+            }
+
+            if (quotient)
+            {
+                trim(digits);
+                *quotient = std::move(digits);
+            }
+            if (remainder)
+            {
+                u.resize(n);
+                trim(u);
+                *remainder = shiftRightMagnitude(u, shift);
+            }
+        }
+
+        Limbs remainderMagnitude(const View dividend, const View divisor)
+        {
+            Limbs rest;
+            divideMagnitude(dividend, divisor, nullptr, &rest);
+            return rest;
+        }
+
+        // ---- Signed values in the packed Words layout ----
+
+        View magnitudeOf(const Words& value) noexcept
+        {
+            return value.empty() ? View{} : trimmed(View(value).subspan(1));
+        }
+
+        bool negativeOf(const Words& value) noexcept
+        {
+            return !value.empty() && value[0] != 0 && !magnitudeOf(value).empty();
+        }
+
+        Words pack(const bool negative, const View magnitude)
+        {
+            const auto digits = trimmed(magnitude);
+            Words result;
+            result.reserve(digits.size() + 1);
+            result.push_back(negative && !digits.empty() ? 1u : 0u);
+            result.insert(result.end(), digits.begin(), digits.end());
+            return result;
+        }
+
+        Words addSigned(const bool leftNegative, const View left, const bool rightNegative, const View right)
+        {
+            if (leftNegative == rightNegative) return pack(leftNegative, addMagnitude(left, right));
+            const int comparison = compareMagnitude(left, right);
+            if (comparison == 0) return pack(false, {});
+            return comparison > 0
+                ? pack(leftNegative, subtractMagnitude(left, right))
+                : pack(rightNegative, subtractMagnitude(right, left));
+        }
+
+        int digitValue(const char ch) noexcept
+        {
+            if (ch >= '0' && ch <= '9') return ch - '0';
+            if (ch >= 'a' && ch <= 'f') return ch - 'a' + 10;
+            if (ch >= 'A' && ch <= 'F') return ch - 'A' + 10;
+            return -1;
+        }
+
+        bool consumeSign(std::string_view& text) noexcept
+        {
+            const bool negative = !text.empty() && text.front() == '-';
+            if (!text.empty() && (text.front() == '-' || text.front() == '+')) text.remove_prefix(1);
+            return negative;
+        }
+
+        Limbs twosComplement(const Words& value, const std::size_t width)
+        {
+            const auto magnitude = magnitudeOf(value);
+            Limbs result(width, 0);
+            std::copy(magnitude.begin(), magnitude.end(), result.begin());
+            if (negativeOf(value))
+            {
+                for (Limb& limb : result) limb = ~limb;
+                for (Limb& limb : result)
+                    if (++limb != 0) break;
+            }
+            return result;
+        }
+
+        Words fromTwosComplement(Limbs value)
+        {
+            const bool negative = !value.empty() && (value.back() >> 63) != 0;
+            if (negative)
+            {
+                for (Limb& limb : value) limb = ~limb;
+                for (Limb& limb : value)
+                    if (++limb != 0) break;
+            }
+            return pack(negative, value);
+        }
+
+        template <typename Operation>
+        Words bitwise(const Words& left, const Words& right, Operation operation)
+        {
+            const std::size_t width = std::max(magnitudeOf(left).size(), magnitudeOf(right).size()) + 1;
+            auto result = twosComplement(left, width);
+            const auto other = twosComplement(right, width);
+            for (std::size_t index = 0; index < width; ++index)
+                result[index] = operation(result[index], other[index]);
+            return fromTwosComplement(std::move(result));
+        }
+    }
+
+    Words Parse(std::string_view text)
+    {
+        const bool negative = consumeSign(text);
+        if (text.empty()) return {};
+        for (const char ch : text)
+            if (ch < '0' || ch > '9') return {};
+
+        Limbs magnitude;
+        magnitude.reserve(text.size() / DecimalChunkDigits + 1);
+        std::size_t chunkSize = text.size() % DecimalChunkDigits;
+        if (chunkSize == 0) chunkSize = DecimalChunkDigits;
+        while (!text.empty())
+        {
+            Limb chunk = 0, scale = 1;
+            for (std::size_t index = 0; index < chunkSize; ++index)
+            {
+                chunk = chunk * 10 + static_cast<Limb>(text[index] - '0');
+                scale *= 10;
+            }
+            multiplyAddSmall(magnitude, scale, chunk);
+            text.remove_prefix(chunkSize);
+            chunkSize = DecimalChunkDigits;
+        }
+        return pack(negative, magnitude);
+    }
+
+    Words ParseHex(std::string_view text)
+    {
+        const bool negative = consumeSign(text);
+        if (text.starts_with("0x") || text.starts_with("0X")) text.remove_prefix(2);
+        if (text.empty()) return {};
+
+        Limbs magnitude((text.size() + 15) / 16, 0);
+        std::size_t bit = 0;
+        for (std::size_t index = text.size(); index-- > 0; bit += 4)
+        {
+            const int digit = digitValue(text[index]);
+            if (digit < 0) return {};
+            magnitude[bit / 64] |= static_cast<Limb>(digit) << (bit % 64);
+        }
+        return pack(negative, magnitude);
+    }
+
+    Words FromI64(const std::int64_t value)
+    {
+        const Limb magnitude = value < 0 ? ~static_cast<Limb>(value) + 1 : static_cast<Limb>(value);
+        return pack(value < 0, View(&magnitude, 1));
+    }
+
+    Words FromU64(const std::uint64_t value)
+    {
+        return pack(false, View(&value, 1));
+    }
+
+    std::string ToString(const Words& value)
+    {
+        const auto magnitude = magnitudeOf(value);
+        if (magnitude.empty()) return "0";
+
+        Limbs rest(magnitude.begin(), magnitude.end());
+        std::vector<Limb> chunks;
+        chunks.reserve(rest.size() * 64 / 63 + 1);
+        while (!rest.empty())
+            chunks.push_back(divideSmall(rest, DecimalChunk));
+
+        std::string text;
+        text.reserve(chunks.size() * DecimalChunkDigits + 1);
+        if (negativeOf(value)) text.push_back('-');
+        text += std::to_string(chunks.back());
+        for (std::size_t index = chunks.size() - 1; index-- > 0;)
+        {
+            const auto chunk = std::to_string(chunks[index]);
+            text.append(DecimalChunkDigits - chunk.size(), '0');
+            text += chunk;
+        }
+        return text;
+    }
+
+    std::string ToHexString(const Words& value)
+    {
+        static constexpr char Digits[] = "0123456789abcdef";
+        const auto magnitude = magnitudeOf(value);
+        if (magnitude.empty()) return "0";
+
+        std::string text;
+        text.reserve(magnitude.size() * 16 + 1);
+        if (negativeOf(value)) text.push_back('-');
+        bool leading = true;
+        for (std::size_t index = magnitude.size(); index-- > 0;)
+        {
+            for (int shift = 60; shift >= 0; shift -= 4)
+            {
+                const auto digit = static_cast<std::size_t>((magnitude[index] >> shift) & 0xfu);
+                if (leading && digit == 0) continue;
+                leading = false;
+                text.push_back(Digits[digit]);
+            }
+        }
+        return text;
+    }
+
+    Words Add(const Words& left, const Words& right)
+    {
+        return addSigned(negativeOf(left), magnitudeOf(left), negativeOf(right), magnitudeOf(right));
+    }
+
+    Words Subtract(const Words& left, const Words& right)
+    {
+        return addSigned(negativeOf(left), magnitudeOf(left), !negativeOf(right), magnitudeOf(right));
+    }
+
+    Words Multiply(const Words& left, const Words& right)
+    {
+        return pack(negativeOf(left) != negativeOf(right), multiplyMagnitude(magnitudeOf(left), magnitudeOf(right)));
+    }
+
+    Words Divide(const Words& left, const Words& right)
+    {
+        const auto divisor = magnitudeOf(right);
+        if (divisor.empty()) return {};
+        Limbs quotient;
+        divideMagnitude(magnitudeOf(left), divisor, &quotient, nullptr);
+        return pack(negativeOf(left) != negativeOf(right), quotient);
+    }
+
+    Words Remainder(const Words& left, const Words& right)
+    {
+        const auto divisor = magnitudeOf(right);
+        if (divisor.empty()) return {};
+        return pack(negativeOf(left), remainderMagnitude(magnitudeOf(left), divisor));
+    }
+
+    Words Negate(const Words& value)
+    {
+        return pack(!negativeOf(value), magnitudeOf(value));
+    }
+
+    Words Absolute(const Words& value)
+    {
+        return pack(false, magnitudeOf(value));
+    }
+
+    Words Pow(const Words& base, const std::uint32_t exponent)
+    {
+        const auto magnitude = magnitudeOf(base);
+        Limbs result{ 1 };
+        for (int bit = 31 - std::countl_zero(exponent | 1u); bit >= 0; --bit)
+        {
+            result = multiplyMagnitude(result, result);
+            if ((exponent >> bit) & 1u) result = multiplyMagnitude(result, magnitude);
+        }
+        return pack(negativeOf(base) && (exponent & 1u) != 0, result);
+    }
+
+    Words ModPow(const Words& base, const Words& exponent, const Words& modulus)
+    {
+        const auto divisor = magnitudeOf(modulus);
+        if (divisor.empty() || negativeOf(exponent)) return {};
+        if (divisor.size() == 1 && divisor[0] == 1) return pack(false, {});
+
+        // Reduce the base into [0, |modulus|) with floored semantics.
+        auto reduced = remainderMagnitude(magnitudeOf(base), divisor);
+        if (negativeOf(base) && !reduced.empty()) reduced = subtractMagnitude(divisor, reduced);
+
+        // Fixed 4-bit window: one multiplication per exponent nibble instead
+        // of one per set bit.
+        std::array<Limbs, 16> powers;
+        powers[0] = { 1 };
+        powers[1] = reduced;
+        for (std::size_t index = 2; index < powers.size(); ++index)
+            powers[index] = remainderMagnitude(multiplyMagnitude(powers[index - 1], reduced), divisor);
+
+        const auto bits = magnitudeOf(exponent);
+        Limbs result{ 1 };
+        const std::uint64_t nibbles = (BitLength(exponent) + 3) / 4;
+        for (std::uint64_t nibble = nibbles; nibble-- > 0;)
+        {
+            if (nibble + 1 != nibbles)
+                for (int square = 0; square < 4; ++square)
+                    result = remainderMagnitude(multiplyMagnitude(result, result), divisor);
+            const auto window = static_cast<std::size_t>((bits[nibble / 16] >> (nibble % 16 * 4)) & 0xfu);
+            if (window != 0)
+                result = remainderMagnitude(multiplyMagnitude(result, powers[window]), divisor);
+        }
+        return pack(false, result);
+    }
+
+    Words ShiftLeft(const Words& value, const std::uint64_t bits)
+    {
+        return pack(negativeOf(value), shiftLeftMagnitude(magnitudeOf(value), bits));
+    }
+
+    Words ShiftRight(const Words& value, const std::uint64_t bits)
+    {
+        const auto magnitude = magnitudeOf(value);
+        if (!negativeOf(value)) return pack(false, shiftRightMagnitude(magnitude, bits));
+
+        // floor(-m / 2^k) = -(((m - 1) >> k) + 1)
+        const Limb one = 1;
+        const auto shifted = shiftRightMagnitude(subtractMagnitude(magnitude, View(&one, 1)), bits);
+        return pack(true, addMagnitude(shifted, View(&one, 1)));
+    }
+
+    Words BitAnd(const Words& left, const Words& right)
+    {
+        return bitwise(left, right, [](const Limb a, const Limb b) { return a & b; });
+    }
+
+    Words BitOr(const Words& left, const Words& right)
+    {
+        return bitwise(left, right, [](const Limb a, const Limb b) { return a | b; });
+    }
+
+    Words BitXor(const Words& left, const Words& right)
+    {
+        return bitwise(left, right, [](const Limb a, const Limb b) { return a ^ b; });
+    }
+
+    std::int32_t Compare(const Words& left, const Words& right) noexcept
+    {
+        const bool leftNegative = negativeOf(left), rightNegative = negativeOf(right);
+        if (leftNegative != rightNegative) return leftNegative ? -1 : 1;
+        const int comparison = compareMagnitude(magnitudeOf(left), magnitudeOf(right));
+        return leftNegative ? -comparison : comparison;
+    }
+
+    std::int32_t Sign(const Words& value) noexcept
+    {
+        if (magnitudeOf(value).empty()) return 0;
+        return negativeOf(value) ? -1 : 1;
+    }
+
+    std::uint64_t BitLength(const Words& value) noexcept
+    {
+        const auto magnitude = magnitudeOf(value);
+        if (magnitude.empty()) return 0;
+        return 64 * (magnitude.size() - 1) + static_cast<std::uint64_t>(64 - std::countl_zero(magnitude.back()));
+    }
+}
@@ -3,8 +3,14 @@
 #include "exception.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cerrno>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <system_error>
+#include <unordered_map>
+#include <utility>
 
 #if defined(_WIN32)
 #include <windows.h>
@@ -12,6 +18,13 @@
 #undef MoveFile
 #endif
 
+#if defined(__linux__)
+#include "detail/readiness_reactor.h"
+
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
 namespace wio::runtime::std_fs
 {
     namespace
@@ -832,4 +845,480 @@ namespace wio::runtime::std_fs
         value = toGenericString(resolved.lexically_normal());
         return true;
     }
+
+    namespace
+    {
+        struct WatchEntry final
+        {
+            bool isDirectory = false;
+            std::int64_t size = -1;
+            std::int64_t lastWriteTime = 0;
+        };
+
+        using WatchSnapshot = std::unordered_map<std::string, WatchEntry>;
+
+        std::atomic<std::uint64_t> liveWatchCount{0};
+
+        struct WatchState final
+        {
+            WatchState() { liveWatchCount.fetch_add(1, std::memory_order_relaxed); }
+            ~WatchState();
+            WatchState(const WatchState&) = delete;
+            WatchState& operator=(const WatchState&) = delete;
+
+            std::atomic<std::uint32_t> references{1};
+            std::mutex mutex;
+            bool closed = false;
+            std::filesystem::path root;
+            std::string rootText;
+            bool recursive = false;
+            // A file (or a path that does not exist yet) is watched through
+            // its parent directory, filtered by name.
+            bool fileTarget = false;
+            std::string fileName;
+            std::map<std::string, WatchChangeKind> pending;
+            // Polling backend: the tree as of the last refresh.
+            WatchSnapshot snapshot;
+            // inotify backend: -1 while polling.
+            int notify = -1;
+            std::unordered_map<int, std::string> directories;
+        };
+
+        WatchState* asWatch(void* handle)
+        {
+            return static_cast<WatchState*>(handle);
+        }
+
+#if defined(__linux__)
+        using detail::ReadinessReactor;
+
+        // Leaked: the poller thread may still be delivering a wake-up while
+        // static destructors run.
+        ReadinessReactor& reactor()
+        {
+            static auto* instance = new ReadinessReactor();
+            return *instance;
+        }
+
+        constexpr std::uint32_t watchMask =
+            IN_CREATE | IN_DELETE | IN_MODIFY | IN_CLOSE_WRITE | IN_ATTRIB |
+            IN_MOVED_FROM | IN_MOVED_TO | IN_DELETE_SELF | IN_MOVE_SELF | IN_ONLYDIR;
+#endif
+
+        WatchState::~WatchState()
+        {
+#if defined(__linux__)
+            if (notify >= 0)
+                ::close(notify);
+#endif
+            liveWatchCount.fetch_sub(1, std::memory_order_relaxed);
+        }
+
+        // created + modified stays created, created + removed cancels out,
+        // removed + created is a modification of the path, and anything
+        // followed by removed is removed.
+        void recordChange(WatchState& state, const std::string& path, const WatchChangeKind kind)
+        {
+            const auto [found, inserted] = state.pending.try_emplace(path, kind);
+            if (inserted)
+                return;
+            auto& current = found->second;
+            if (current == WatchChangeKind::Created)
+            {
+                if (kind == WatchChangeKind::Removed)
+                    state.pending.erase(found);
+                return;
+            }
+            current = kind == WatchChangeKind::Removed ? WatchChangeKind::Removed : WatchChangeKind::Modified;
+        }
+
+        WatchEntry describe(const std::filesystem::directory_entry& entry)
+        {
+            WatchEntry value;
+            std::error_code ec;
+            value.isDirectory = entry.is_directory(ec);
+            if (!value.isDirectory)
+            {
+                const auto size = entry.file_size(ec);
+                value.size = ec ? -1 : static_cast<std::int64_t>(size);
+            }
+            const auto timestamp = entry.last_write_time(ec);
+            if (!ec)
+                value.lastWriteTime = static_cast<std::int64_t>(timestamp.time_since_epoch().count());
+            return value;
+        }
+
+        void scanInto(const WatchState& state, WatchSnapshot& snapshot)
+        {
+            std::error_code ec;
+            if (state.fileTarget)
+            {
+                const std::filesystem::directory_entry entry(state.root, ec);
+                if (!ec && entry.exists(ec))
+                    snapshot.emplace(state.rootText, describe(entry));
+                return;
+            }
+            // The root stands in for itself so that its removal is reported
+            // the way inotify reports it.
+            const std::filesystem::directory_entry root(state.root, ec);
+            if (ec || !root.is_directory(ec))
+                return;
+            snapshot.emplace(state.rootText, describe(root));
+            constexpr auto options = std::filesystem::directory_options::skip_permission_denied;
+            if (state.recursive)
+            {
+                for (std::filesystem::recursive_directory_iterator it(state.root, options, ec), end;
+                     it != end && !ec; it.increment(ec))
+                    snapshot.emplace(toGenericString(it->path()), describe(*it));
+                return;
+            }
+            for (std::filesystem::directory_iterator it(state.root, options, ec), end;
+                 it != end && !ec; it.increment(ec))
+                snapshot.emplace(toGenericString(it->path()), describe(*it));
+        }
+
+        // Directories are compared by presence only; their own write time
+        // moves with every entry change, which the entries already report.
+        void diffSnapshot(WatchState& state, WatchSnapshot next, bool& changed)
+        {
+            for (const auto& [path, entry] : next)
+            {
+                const auto previous = state.snapshot.find(path);
+                if (previous == state.snapshot.end())
+                {
+                    recordChange(state, path, WatchChangeKind::Created);
+                    changed = true;
+                }
+                else if (!entry.isDirectory &&
+                         (entry.size != previous->second.size ||
+                          entry.lastWriteTime != previous->second.lastWriteTime))
+                {
+                    recordChange(state, path, WatchChangeKind::Modified);
+                    changed = true;
+                }
+            }
+            for (const auto& [path, entry] : state.snapshot)
+            {
+                if (!next.contains(path))
+                {
+                    recordChange(state, path, WatchChangeKind::Removed);
+                    changed = true;
+                }
+            }
+            state.snapshot = std::move(next);
+        }
+
+#if defined(__linux__)
+        // With `announce`, every entry found is recorded as created: the
+        // directory appeared after the watch started, so whatever was written
+        // into it before its own watch existed raised no event.
+        bool addDirectory(WatchState& state, const std::filesystem::path& directory, const bool announce)
+        {
+            const int descriptor = inotify_add_watch(state.notify, directory.c_str(), watchMask);
+            if (descriptor < 0)
+                return false;
+            state.directories[descriptor] = toGenericString(directory);
+            if (!state.recursive)
+                return true;
+
+            std::error_code ec;
+            for (std::filesystem::directory_iterator it(
+                     directory, std::filesystem::directory_options::skip_permission_denied, ec), end;
+                 it != end && !ec; it.increment(ec))
+            {
+                if (announce)
+                    recordChange(state, toGenericString(it->path()), WatchChangeKind::Created);
+                std::error_code typeError;
+                if (it->is_directory(typeError) && !it->is_symlink(typeError) &&
+                    !addDirectory(state, it->path(), announce))
+                    return false;
+            }
+            return true;
+        }
+
+        bool openNotifications(WatchState& state)
+        {
+            if (!reactor().Available())
+                return false;
+            state.notify = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+            if (state.notify < 0)
+                return false;
+            auto directory = state.fileTarget ? state.root.parent_path() : state.root;
+            if (directory.empty())
+                directory = ".";
+            if (addDirectory(state, directory, false))
+                return true;
+            ::close(state.notify);
+            state.notify = -1;
+            state.directories.clear();
+            return false;
+        }
+
+        bool handleEvent(WatchState& state, const inotify_event& event)
+        {
+            if ((event.mask & IN_Q_OVERFLOW) != 0)
+            {
+                recordChange(state, state.rootText, WatchChangeKind::Modified);
+                return true;
+            }
+            const auto directory = state.directories.find(event.wd);
+            if (directory == state.directories.end())
+                return true;
+            if ((event.mask & IN_IGNORED) != 0)
+            {
+                state.directories.erase(directory);
+                return true;
+            }
+            if (event.len == 0)
+            {
+                // Subdirectory removals are reported by their parent; only
+                // the watched root disappearing needs its own entry.
+                if (!state.fileTarget && directory->second == state.rootText &&
+                    (event.mask & (IN_DELETE_SELF | IN_MOVE_SELF)) != 0)
+                    recordChange(state, state.rootText, WatchChangeKind::Removed);
+                return true;
+            }
+
+            const std::string name(event.name);
+            if (state.fileTarget && name != state.fileName)
+                return true;
+            const auto path = state.fileTarget
+                ? state.rootText
+                : toGenericString(std::filesystem::path(directory->second) / name);
+            const bool isDirectory = (event.mask & IN_ISDIR) != 0;
+            if ((event.mask & (IN_CREATE | IN_MOVED_TO)) != 0)
+            {
+                recordChange(state, path, WatchChangeKind::Created);
+                if (state.recursive && isDirectory && !state.fileTarget)
+                    return addDirectory(state, toPath(path), true);
+            }
+            else if ((event.mask & (IN_DELETE | IN_MOVED_FROM)) != 0)
+                recordChange(state, path, WatchChangeKind::Removed);
+            else if (!isDirectory)
+                recordChange(state, path, WatchChangeKind::Modified);
+            return true;
+        }
+
+        // Returns false when the descriptor fails or a new subdirectory
+        // cannot be watched; the caller then switches to polling.
+        bool drainNotifications(WatchState& state, bool& changed)
+        {
+            alignas(inotify_event) char buffer[16 * 1024];
+            for (;;)
+            {
+                const auto count = ::read(state.notify, buffer, sizeof(buffer));
+                if (count < 0)
+                {
+                    if (errno == EINTR)
+                        continue;
+                    return errno == EAGAIN || errno == EWOULDBLOCK;
+                }
+                if (count == 0)
+                    return true;
+                for (std::size_t offset = 0; offset < static_cast<std::size_t>(count);)
+                {
+                    const auto* event = reinterpret_cast<const inotify_event*>(buffer + offset);
+                    offset += sizeof(inotify_event) + event->len;
+                    changed = true;
+                    if (!handleEvent(state, *event))
+                        return false;
+                }
+            }
+        }
+#endif
+
+        bool failClosedWatch(std::int32_t& error, std::int64_t& nativeError, std::string& message)
+        {
+            error = static_cast<std::int32_t>(ErrorCode::Io);
+            nativeError = 0;
+            message = "file watch is closed";
+            return false;
+        }
+    }
+
+    bool WatchOpen(const std::string& path, const bool recursive, void*& handle,
+                   std::int32_t& error, std::int64_t& nativeError, std::string& message)
+    {
+        clearResultError(error, nativeError, message);
+        handle = nullptr;
+        if (path.empty())
+            return failResult("open file watch", path, std::make_error_code(std::errc::invalid_argument), error, nativeError, message);
+
+        auto state = std::make_unique<WatchState>();
+        state->root = toPath(path);
+        state->rootText = toGenericString(state->root);
+        state->recursive = recursive;
+        std::error_code ec;
+        state->fileTarget = !std::filesystem::is_directory(state->root, ec);
+        if (state->fileTarget)
+            state->fileName = state->root.filename().string();
+#if defined(__linux__)
+        if (!openNotifications(*state))
+            scanInto(*state, state->snapshot);
+#else
+        scanInto(*state, state->snapshot);
+#endif
+        handle = state.release();
+        return true;
+    }
+
+    bool WatchUsesNotifications(void* handle) noexcept
+    {
+        if (!handle) return false;
+        auto* state = asWatch(handle);
+        std::lock_guard lock(state->mutex);
+        return state->notify >= 0;
+    }
+
+    bool WatchRefresh(void* handle, bool& changed, std::int32_t& error, std::int64_t& nativeError, std::string& message)
+    {
+        clearResultError(error, nativeError, message);
+        changed = false;
+        auto* state = asWatch(handle);
+        [[maybe_unused]] int retired = -1;
+        {
+            std::lock_guard lock(state->mutex);
+            if (state->closed)
+                return failClosedWatch(error, nativeError, message);
+#if defined(__linux__)
+            if (state->notify >= 0)
+            {
+                if (drainNotifications(*state, changed))
+                    return true;
+                // Events may have been lost: report the root as modified and
+                // poll from a fresh baseline.
+                retired = std::exchange(state->notify, -1);
+                state->directories.clear();
+                recordChange(*state, state->rootText, WatchChangeKind::Modified);
+                changed = true;
+                scanInto(*state, state->snapshot);
+            }
+            else
+#endif
+            {
+                WatchSnapshot next;
+                scanInto(*state, next);
+                diffSnapshot(*state, std::move(next), changed);
+            }
+        }
+#if defined(__linux__)
+        if (retired >= 0)
+        {
+            reactor().WakeAll(retired);
+            ::close(retired);
+        }
+#endif
+        return true;
+    }
+
+    bool WatchTake(void* handle, std::vector<std::string>& paths, std::vector<std::int32_t>& kinds,
+                   std::int32_t& error, std::int64_t& nativeError, std::string& message)
+    {
+        clearResultError(error, nativeError, message);
+        paths.clear();
+        kinds.clear();
+        auto* state = asWatch(handle);
+        std::lock_guard lock(state->mutex);
+        if (state->closed)
+            return failClosedWatch(error, nativeError, message);
+        paths.reserve(state->pending.size());
+        kinds.reserve(state->pending.size());
+        for (auto& [path, kind] : state->pending)
+        {
+            paths.push_back(path);
+            kinds.push_back(static_cast<std::int32_t>(kind));
+        }
+        state->pending.clear();
+        return true;
+    }
+
+    std::uint64_t WatchNotify(void* handle, std::function<void()> ready) noexcept
+    {
+#if defined(__linux__)
+        if (!handle) return 0;
+        auto* state = asWatch(handle);
+        std::lock_guard lock(state->mutex);
+        if (state->closed || state->notify < 0)
+            return 0;
+        try
+        {
+            int nativeError = 0;
+            return reactor().Watch(state->notify, false, std::move(ready), nativeError);
+        }
+        catch (...)
+        {
+            return 0;
+        }
+#else
+        static_cast<void>(handle);
+        static_cast<void>(ready);
+        return 0;
+#endif
+    }
+
+    void WatchCancelNotify(const std::uint64_t token) noexcept
+    {
+#if defined(__linux__)
+        if (token != 0)
+            reactor().Cancel(token);
+#else
+        static_cast<void>(token);
+#endif
+    }
+
+    std::uint64_t WatchNotifyPendingCount() noexcept
+    {
+#if defined(__linux__)
+        return reactor().PendingCount();
+#else
+        return 0;
+#endif
+    }
+
+    bool WatchRetain(void* handle) noexcept
+    {
+        if (!handle) return false;
+        auto* state = asWatch(handle);
+        std::lock_guard lock(state->mutex);
+        if (state->closed)
+            return false;
+        state->references.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    std::uint64_t LiveWatchCount() noexcept
+    {
+        return liveWatchCount.load(std::memory_order_acquire);
+    }
+
+    void WatchRelease(void* handle) noexcept
+    {
+        if (!handle) return;
+        auto* state = asWatch(handle);
+        if (state->references.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            delete state;
+    }
+
+    void WatchClose(void* handle) noexcept
+    {
+        if (!handle) return;
+        auto* state = asWatch(handle);
+        [[maybe_unused]] int notify = -1;
+        {
+            std::lock_guard lock(state->mutex);
+            if (state->closed) return;
+            state->closed = true;
+            notify = std::exchange(state->notify, -1);
+        }
+#if defined(__linux__)
+        // Parked waiters are woken before the descriptor is closed and can
+        // be reused.
+        if (notify >= 0)
+        {
+            reactor().WakeAll(notify);
+            ::close(notify);
+        }
+#endif
+        WatchRelease(state);
+    }
 }
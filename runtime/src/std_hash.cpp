@@ -1,10 +1,21 @@
 #include "std_hash.h"
+#include "std_fs.h"
 
-#include <array>
+#include <algorithm>
+#include <atomic>
 #include <bit>
-#include <cstddef>
-#include <iomanip>
-#include <sstream>
+#include <cerrno>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <system_error>
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define WIO_HASH_SHA_NI 1
+#include <cpuid.h>
+#include <immintrin.h>
+#endif
 
 namespace wio::runtime::std_hash
 {
@@ -29,35 +40,28 @@ namespace wio::runtime::std_hash
             0x90befffau, 0xa4506cebu, 0xbef9a3f7u, 0xc67178f2u
         };
 
-        std::vector<std::uint8_t> sha256Digest(const std::uint8_t* data, const std::size_t size)
-        {
-            std::vector<std::uint8_t> message;
-            if (size > 0u)
-                message.assign(data, data + size);
-            message.push_back(0x80u);
-            while ((message.size() % 64u) != 56u)
-                message.push_back(0u);
+        constexpr std::array<std::uint32_t, 8> InitialState = {
+            0x6a09e667u, 0xbb67ae85u, 0x3c6ef372u, 0xa54ff53au,
+            0x510e527fu, 0x9b05688cu, 0x1f83d9abu, 0x5be0cd19u
+        };
 
-            const std::uint64_t bitLength = static_cast<std::uint64_t>(size) * 8u;
-            for (int shift = 56; shift >= 0; shift -= 8)
-                message.push_back(static_cast<std::uint8_t>(bitLength >> shift));
+        constexpr std::size_t FileChunkSize = 64u * 1024u;
 
-            std::array<std::uint32_t, 8> state = {
-                0x6a09e667u, 0xbb67ae85u, 0x3c6ef372u, 0xa54ff53au,
-                0x510e527fu, 0x9b05688cu, 0x1f83d9abu, 0x5be0cd19u
-            };
+        using BlockFunction = void (*)(std::uint32_t* state, const std::uint8_t* data, std::size_t blocks);
 
-            for (std::size_t offset = 0; offset < message.size(); offset += 64u)
+        void sha256BlocksScalar(std::uint32_t* state, const std::uint8_t* data, std::size_t blocks)
+        {
+            for (; blocks > 0u; --blocks, data += 64u)
             {
                 std::array<std::uint32_t, 64> words{};
                 for (std::size_t i = 0; i < 16u; ++i)
                 {
-                    const std::size_t p = offset + i * 4u;
+                    const std::uint8_t* p = data + i * 4u;
                     words[i] =
-                        (static_cast<std::uint32_t>(message[p]) << 24u) |
-                        (static_cast<std::uint32_t>(message[p + 1u]) << 16u) |
-                        (static_cast<std::uint32_t>(message[p + 2u]) << 8u) |
-                        static_cast<std::uint32_t>(message[p + 3u]);
+                        (static_cast<std::uint32_t>(p[0]) << 24u) |
+                        (static_cast<std::uint32_t>(p[1]) << 16u) |
+                        (static_cast<std::uint32_t>(p[2]) << 8u) |
+                        static_cast<std::uint32_t>(p[3]);
                 }
 
                 for (std::size_t i = 16u; i < 64u; ++i)
@@ -112,26 +116,128 @@ namespace wio::runtime::std_hash
                 state[6] += g;
                 state[7] += h;
             }
+        }
+
+#if defined(WIO_HASH_SHA_NI)
+        // SHA extensions keep the state split as ABEF/CDGH and retire two
+        // rounds per sha256rnds2; the message schedule advances four words per
+        // group with sha256msg1/sha256msg2.
+        __attribute__((target("sha,sse4.1,ssse3")))
+        void sha256BlocksShaNi(std::uint32_t* state, const std::uint8_t* data, std::size_t blocks)
+        {
+            const __m128i byteSwap = _mm_set_epi64x(0x0c0d0e0f08090a0bll, 0x0405060700010203ll);
 
-            std::vector<std::uint8_t> digest;
-            digest.reserve(32u);
-            for (const std::uint32_t word : state)
+            __m128i dcba = _mm_loadu_si128(reinterpret_cast<const __m128i*>(state));
+            __m128i hgfe = _mm_loadu_si128(reinterpret_cast<const __m128i*>(state + 4));
+            dcba = _mm_shuffle_epi32(dcba, 0xB1);
+            hgfe = _mm_shuffle_epi32(hgfe, 0x1B);
+            __m128i abef = _mm_alignr_epi8(dcba, hgfe, 8);
+            __m128i cdgh = _mm_blend_epi16(hgfe, dcba, 0xF0);
+
+            for (; blocks > 0u; --blocks, data += 64u)
             {
-                digest.push_back(static_cast<std::uint8_t>(word >> 24u));
-                digest.push_back(static_cast<std::uint8_t>(word >> 16u));
-                digest.push_back(static_cast<std::uint8_t>(word >> 8u));
-                digest.push_back(static_cast<std::uint8_t>(word));
+                const __m128i abefSaved = abef;
+                const __m128i cdghSaved = cdgh;
+
+                __m128i schedule[4];
+                for (int i = 0; i < 4; ++i)
+                {
+                    schedule[i] = _mm_shuffle_epi8(
+                        _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i * 16)), byteSwap);
+                }
+
+                for (int group = 0; group < 16; ++group)
+                {
+                    __m128i& words = schedule[group & 3];
+                    if (group >= 4)
+                    {
+                        const __m128i& next = schedule[(group + 1) & 3];
+                        const __m128i& older = schedule[(group + 2) & 3];
+                        const __m128i& latest = schedule[(group + 3) & 3];
+                        words = _mm_sha256msg2_epu32(
+                            _mm_add_epi32(_mm_sha256msg1_epu32(words, next), _mm_alignr_epi8(latest, older, 4)),
+                            latest);
+                    }
+
+                    __m128i message = _mm_add_epi32(
+                        words, _mm_loadu_si128(reinterpret_cast<const __m128i*>(RoundConstants.data() + group * 4)));
+                    cdgh = _mm_sha256rnds2_epu32(cdgh, abef, message);
+                    message = _mm_shuffle_epi32(message, 0x0E);
+                    abef = _mm_sha256rnds2_epu32(abef, cdgh, message);
+                }
+
+                abef = _mm_add_epi32(abef, abefSaved);
+                cdgh = _mm_add_epi32(cdgh, cdghSaved);
             }
-            return digest;
+
+            const __m128i feba = _mm_shuffle_epi32(abef, 0x1B);
+            const __m128i dchg = _mm_shuffle_epi32(cdgh, 0xB1);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(state), _mm_blend_epi16(feba, dchg, 0xF0));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(state + 4), _mm_alignr_epi8(dchg, feba, 8));
         }
 
-        std::string toHex(const std::vector<std::uint8_t>& digest)
+        bool cpuSupportsShaNi() noexcept
+        {
+            unsigned int eax = 0, ebx = 0, ecx = 0, edx = 0;
+            if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx))
+                return false;
+            const bool ssse3 = (ecx & (1u << 9u)) != 0u;
+            const bool sse41 = (ecx & (1u << 19u)) != 0u;
+            if (!__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx))
+                return false;
+            const bool sha = (ebx & (1u << 29u)) != 0u;
+            return ssse3 && sse41 && sha;
+        }
+#endif
+
+        bool hardwareSha256Available() noexcept
+        {
+#if defined(WIO_HASH_SHA_NI)
+            static const bool supported = cpuSupportsShaNi();
+            return supported;
+#else
+            return false;
+#endif
+        }
+
+        std::atomic<bool>& accelerationEnabled() noexcept
+        {
+            static std::atomic<bool> enabled{hardwareSha256Available()};
+            return enabled;
+        }
+
+        void sha256Blocks(std::uint32_t* state, const std::uint8_t* data, const std::size_t blocks)
+        {
+#if defined(WIO_HASH_SHA_NI)
+            if (accelerationEnabled().load(std::memory_order_relaxed))
+            {
+                sha256BlocksShaNi(state, data, blocks);
+                return;
+            }
+#endif
+            sha256BlocksScalar(state, data, blocks);
+        }
+
+        constexpr char HexDigits[] = "0123456789abcdef";
+
+        template <typename TBytes>
+        std::string toHex(const TBytes& digest)
+        {
+            std::string text(digest.size() * 2u, '\0');
+            for (std::size_t i = 0; i < digest.size(); ++i)
+            {
+                text[i * 2u] = HexDigits[digest[i] >> 4u];
+                text[i * 2u + 1u] = HexDigits[digest[i] & 0x0fu];
+            }
+            return text;
+        }
+
+        std::vector<std::uint8_t> sha256Digest(const std::uint8_t* data, const std::size_t size)
         {
-            std::ostringstream stream;
-            stream << std::hex << std::setfill('0');
-            for (const auto value : digest)
-                stream << std::setw(2) << static_cast<unsigned int>(value);
-            return stream.str();
+            Sha256Hasher hasher;
+            hasher.Update(data, size);
+            const auto digest = hasher.Finish();
+            return {digest.begin(), digest.end()};
         }
 
         template <typename TValue>
@@ -144,6 +250,229 @@ namespace wio::runtime::std_hash
             }
             return hash;
         }
+
+        constexpr std::array<std::uint64_t, 4> FastSecret = {
+            0x2d358dccaa6c78a5ull, 0x8bb84b93962eacc9ull,
+            0x4b33a62ed433d4a3ull, 0x4d5a2da51de1aa47ull
+        };
+
+        // 64x64 -> 128 multiply; low half into left, high half into right.
+        inline void multiplyWide(std::uint64_t& left, std::uint64_t& right) noexcept
+        {
+#if defined(__SIZEOF_INT128__)
+            const unsigned __int128 product = static_cast<unsigned __int128>(left) * right;
+            left = static_cast<std::uint64_t>(product);
+            right = static_cast<std::uint64_t>(product >> 64u);
+#else
+            const std::uint64_t leftHigh = left >> 32u, leftLow = static_cast<std::uint32_t>(left);
+            const std::uint64_t rightHigh = right >> 32u, rightLow = static_cast<std::uint32_t>(right);
+            const std::uint64_t highHigh = leftHigh * rightHigh, highLow = leftHigh * rightLow;
+            const std::uint64_t lowHigh = leftLow * rightHigh, lowLow = leftLow * rightLow;
+            const std::uint64_t middle = highLow + lowHigh;
+            const std::uint64_t carryMiddle = middle < highLow ? 1ull : 0ull;
+            const std::uint64_t low = lowLow + (middle << 32u);
+            const std::uint64_t carryLow = low < lowLow ? 1ull : 0ull;
+            left = low;
+            right = highHigh + (middle >> 32u) + (carryMiddle << 32u) + carryLow;
+#endif
+        }
+
+        inline std::uint64_t multiplyMix(std::uint64_t left, std::uint64_t right) noexcept
+        {
+            multiplyWide(left, right);
+            return left ^ right;
+        }
+
+        // Little-endian loads, so hash values match across hosts.
+        inline std::uint64_t read64(const std::uint8_t* p) noexcept
+        {
+            if constexpr (std::endian::native == std::endian::little)
+            {
+                std::uint64_t value;
+                std::memcpy(&value, p, sizeof(value));
+                return value;
+            }
+            std::uint64_t value = 0;
+            for (int i = 7; i >= 0; --i)
+                value = (value << 8u) | p[i];
+            return value;
+        }
+
+        inline std::uint64_t read32(const std::uint8_t* p) noexcept
+        {
+            if constexpr (std::endian::native == std::endian::little)
+            {
+                std::uint32_t value;
+                std::memcpy(&value, p, sizeof(value));
+                return value;
+            }
+            std::uint64_t value = 0;
+            for (int i = 3; i >= 0; --i)
+                value = (value << 8u) | p[i];
+            return value;
+        }
+
+        std::uint64_t fast64(const std::uint8_t* p, const std::size_t size, std::uint64_t seed) noexcept
+        {
+            seed ^= multiplyMix(seed ^ FastSecret[0], FastSecret[1]);
+            std::uint64_t a = 0;
+            std::uint64_t b = 0;
+            if (size <= 16u)
+            {
+                if (size >= 4u)
+                {
+                    const std::size_t middle = (size >> 3u) << 2u;
+                    a = (read32(p) << 32u) | read32(p + middle);
+                    b = (read32(p + size - 4u) << 32u) | read32(p + size - 4u - middle);
+                }
+                else if (size > 0u)
+                {
+                    a = (static_cast<std::uint64_t>(p[0]) << 16u) |
+                        (static_cast<std::uint64_t>(p[size >> 1u]) << 8u) |
+                        static_cast<std::uint64_t>(p[size - 1u]);
+                }
+            }
+            else
+            {
+                std::size_t remaining = size;
+                if (remaining > 48u)
+                {
+                    std::uint64_t lane1 = seed;
+                    std::uint64_t lane2 = seed;
+                    do
+                    {
+                        seed = multiplyMix(read64(p) ^ FastSecret[1], read64(p + 8u) ^ seed);
+                        lane1 = multiplyMix(read64(p + 16u) ^ FastSecret[2], read64(p + 24u) ^ lane1);
+                        lane2 = multiplyMix(read64(p + 32u) ^ FastSecret[3], read64(p + 40u) ^ lane2);
+                        p += 48u;
+                        remaining -= 48u;
+                    } while (remaining > 48u);
+                    seed ^= lane1 ^ lane2;
+                }
+                while (remaining > 16u)
+                {
+                    seed = multiplyMix(read64(p) ^ FastSecret[1], read64(p + 8u) ^ seed);
+                    p += 16u;
+                    remaining -= 16u;
+                }
+                a = read64(p + remaining - 16u);
+                b = read64(p + remaining - 8u);
+            }
+
+            a ^= FastSecret[1];
+            b ^= seed;
+            multiplyWide(a, b);
+            return multiplyMix(a ^ FastSecret[0] ^ static_cast<std::uint64_t>(size), b ^ FastSecret[1]);
+        }
+
+        Sha256Hasher* asHasher(void* handle) noexcept
+        {
+            return static_cast<Sha256Hasher*>(handle);
+        }
+
+        std::int32_t classifyFileError(const int code) noexcept
+        {
+            using std_fs::ErrorCode;
+            switch (code)
+            {
+            case ENOENT:
+                return static_cast<std::int32_t>(ErrorCode::NotFound);
+            case EACCES:
+            case EPERM:
+                return static_cast<std::int32_t>(ErrorCode::PermissionDenied);
+            case EISDIR:
+                return static_cast<std::int32_t>(ErrorCode::IsDirectory);
+            case ENAMETOOLONG:
+            case EINVAL:
+                return static_cast<std::int32_t>(ErrorCode::InvalidPath);
+            default:
+                return static_cast<std::int32_t>(ErrorCode::Io);
+            }
+        }
+
+        bool failFile(const std::string& path, std::int32_t& error, std::int64_t& nativeError, std::string& message)
+        {
+            const int code = errno != 0 ? errno : EIO;
+            error = classifyFileError(code);
+            nativeError = code;
+            message = "hash file failed for " + path + ": " + std::generic_category().message(code);
+            return false;
+        }
+    }
+
+    Sha256Hasher::Sha256Hasher() noexcept
+    {
+        Reset();
+    }
+
+    void Sha256Hasher::Reset() noexcept
+    {
+        state_ = InitialState;
+        buffered_ = 0;
+        length_ = 0;
+    }
+
+    void Sha256Hasher::Update(const std::uint8_t* data, std::size_t size) noexcept
+    {
+        length_ += static_cast<std::uint64_t>(size);
+        if (buffered_ > 0u)
+        {
+            const std::size_t take = std::min(size, buffer_.size() - buffered_);
+            std::memcpy(buffer_.data() + buffered_, data, take);
+            buffered_ += take;
+            data += take;
+            size -= take;
+            if (buffered_ < buffer_.size())
+                return;
+            sha256Blocks(state_.data(), buffer_.data(), 1u);
+            buffered_ = 0;
+        }
+
+        const std::size_t blocks = size / 64u;
+        if (blocks > 0u)
+        {
+            sha256Blocks(state_.data(), data, blocks);
+            data += blocks * 64u;
+            size -= blocks * 64u;
+        }
+
+        if (size > 0u)
+        {
+            std::memcpy(buffer_.data(), data, size);
+            buffered_ = size;
+        }
+    }
+
+    void Sha256Hasher::Update(const std::string_view value) noexcept
+    {
+        Update(reinterpret_cast<const std::uint8_t*>(value.data()), value.size());
+    }
+
+    std::array<std::uint8_t, 32> Sha256Hasher::Finish() noexcept
+    {
+        const std::uint64_t bitLength = length_ * 8u;
+        buffer_[buffered_++] = 0x80u;
+        if (buffered_ > 56u)
+        {
+            std::memset(buffer_.data() + buffered_, 0, buffer_.size() - buffered_);
+            sha256Blocks(state_.data(), buffer_.data(), 1u);
+            buffered_ = 0;
+        }
+        std::memset(buffer_.data() + buffered_, 0, 56u - buffered_);
+        for (std::size_t i = 0; i < 8u; ++i)
+            buffer_[56u + i] = static_cast<std::uint8_t>(bitLength >> (56u - i * 8u));
+        sha256Blocks(state_.data(), buffer_.data(), 1u);
+
+        std::array<std::uint8_t, 32> digest{};
+        for (std::size_t i = 0; i < state_.size(); ++i)
+        {
+            digest[i * 4u] = static_cast<std::uint8_t>(state_[i] >> 24u);
+            digest[i * 4u + 1u] = static_cast<std::uint8_t>(state_[i] >> 16u);
+            digest[i * 4u + 2u] = static_cast<std::uint8_t>(state_[i] >> 8u);
+            digest[i * 4u + 3u] = static_cast<std::uint8_t>(state_[i]);
+        }
+        Reset();
+        return digest;
     }
 
     std::uint32_t Fnv1a32(const std::string_view value) noexcept
@@ -174,6 +503,21 @@ namespace wio::runtime::std_hash
         return fnv1a(value.data(), value.size(), std::uint64_t{14695981039346656037ull}, std::uint64_t{1099511628211ull});
     }
 
+    std::uint64_t Fast64(const std::string_view value) noexcept
+    {
+        return fast64(reinterpret_cast<const std::uint8_t*>(value.data()), value.size(), 0u);
+    }
+
+    std::uint64_t Fast64Bytes(const std::vector<std::uint8_t>& value) noexcept
+    {
+        return fast64(value.data(), value.size(), 0u);
+    }
+
+    std::uint64_t Fast64Raw(const void* data, const std::size_t size, const std::uint64_t seed) noexcept
+    {
+        return fast64(static_cast<const std::uint8_t*>(data), size, seed);
+    }
+
     std::vector<std::uint8_t> Sha256Digest(const std::string_view value)
     {
         return sha256Digest(reinterpret_cast<const std::uint8_t*>(value.data()), value.size());
@@ -193,4 +537,85 @@ namespace wio::runtime::std_hash
     {
         return toHex(Sha256DigestBytes(value));
     }
+
+    bool Sha256Accelerated() noexcept
+    {
+        return accelerationEnabled().load(std::memory_order_relaxed);
+    }
+
+    void SetSha256Acceleration(const bool enabled) noexcept
+    {
+        accelerationEnabled().store(enabled && hardwareSha256Available(), std::memory_order_relaxed);
+    }
+
+    void* Sha256Create()
+    {
+        return new Sha256Hasher();
+    }
+
+    void Sha256Destroy(void* handle) noexcept
+    {
+        delete asHasher(handle);
+    }
+
+    void Sha256Reset(void* handle) noexcept
+    {
+        if (handle)
+            asHasher(handle)->Reset();
+    }
+
+    void Sha256UpdateText(void* handle, const std::string_view value) noexcept
+    {
+        if (handle)
+            asHasher(handle)->Update(value);
+    }
+
+    void Sha256UpdateBytes(void* handle, const std::vector<std::uint8_t>& value) noexcept
+    {
+        if (handle)
+            asHasher(handle)->Update(value.data(), value.size());
+    }
+
+    std::vector<std::uint8_t> Sha256FinishDigest(void* handle)
+    {
+        if (!handle)
+            return {};
+        const auto digest = asHasher(handle)->Finish();
+        return {digest.begin(), digest.end()};
+    }
+
+    std::string Sha256FinishHex(void* handle)
+    {
+        if (!handle)
+            return {};
+        return toHex(asHasher(handle)->Finish());
+    }
+
+    bool TrySha256FileResult(const std::string& path, std::string& value, std::int32_t& error,
+                             std::int64_t& nativeError, std::string& message)
+    {
+        error = static_cast<std::int32_t>(std_fs::ErrorCode::None);
+        nativeError = 0;
+        message.clear();
+
+        errno = 0;
+        std::ifstream input(std::filesystem::path(path), std::ios::binary);
+        if (!input)
+            return failFile(path, error, nativeError, message);
+
+        Sha256Hasher hasher;
+        const auto chunk = std::make_unique<char[]>(FileChunkSize);
+        while (input)
+        {
+            input.read(chunk.get(), static_cast<std::streamsize>(FileChunkSize));
+            const auto count = input.gcount();
+            if (count > 0)
+                hasher.Update(reinterpret_cast<const std::uint8_t*>(chunk.get()), static_cast<std::size_t>(count));
+        }
+        if (input.bad() || !input.eof())
+            return failFile(path, error, nativeError, message);
+
+        value = toHex(hasher.Finish());
+        return true;
+    }
 }
@@ -2,8 +2,11 @@
 
 #include <algorithm>
 #include <cerrno>
+#include <charconv>
 #include <cstring>
 #include <limits>
+#include <memory>
+#include <new>
 #include <string>
 #include <utility>
 
@@ -17,6 +20,7 @@
     #include <windows.h>
 #else
     #include <fcntl.h>
+    #include <sys/mman.h>
     #include <sys/stat.h>
     #include <sys/types.h>
     #include <unistd.h>
@@ -1824,4 +1828,436 @@ namespace wio::runtime::std_io
             return false;
         }
     }
+
+    MappedFile::MappedFile(const std::string_view path)
+    {
+        File file = Open(path, open_read_binary);
+
+        try
+        {
+#if defined(_WIN32)
+            LARGE_INTEGER fileSize{};
+
+            if (::GetFileType(ToHandle(file.data)) == FILE_TYPE_DISK &&
+                ::GetFileSizeEx(ToHandle(file.data), &fileSize) != FALSE &&
+                fileSize.QuadPart > 0 &&
+                static_cast<std::uint64_t>(fileSize.QuadPart) <= std::numeric_limits<std::size_t>::max())
+            {
+                HANDLE mapping = ::CreateFileMappingW(ToHandle(file.data), nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+                if (mapping != nullptr)
+                {
+                    const void* view = ::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+
+                    if (view != nullptr)
+                    {
+                        data_ = static_cast<const char*>(view);
+                        size_ = static_cast<std::size_t>(fileSize.QuadPart);
+                        mapped_ = true;
+                        mapping_ = mapping;
+                    }
+                    else
+                    {
+                        ::CloseHandle(mapping);
+                    }
+                }
+            }
+#else
+            struct stat statBuffer{};
+
+            // Size-zero regular files include procfs and sysfs entries whose
+            // contents only appear through read(), so they take the fallback.
+            if (::fstat(file.data, &statBuffer) == 0 &&
+                S_ISREG(statBuffer.st_mode) &&
+                statBuffer.st_size > 0 &&
+                static_cast<std::uint64_t>(statBuffer.st_size) <= std::numeric_limits<std::size_t>::max())
+            {
+                const auto length = static_cast<std::size_t>(statBuffer.st_size);
+                void* view = ::mmap(nullptr, length, PROT_READ, MAP_PRIVATE, file.data, 0);
+
+                if (view != MAP_FAILED)
+                {
+    #if defined(MADV_SEQUENTIAL)
+                    (void)::madvise(view, length, MADV_SEQUENTIAL);
+    #endif
+                    data_ = static_cast<const char*>(view);
+                    size_ = length;
+                    mapped_ = true;
+                }
+            }
+#endif
+
+            if (!mapped_)
+            {
+                buffer_ = ReadAll(file);
+                data_ = buffer_.data();
+                size_ = buffer_.size();
+            }
+
+            Close(file);
+        }
+        catch (...)
+        {
+            Unmap();
+
+            if (IsOpen(file))
+            {
+                try
+                {
+                    Close(file);
+                }
+                catch (...)
+                {
+                }
+            }
+
+            throw;
+        }
+    }
+
+    MappedFile::~MappedFile()
+    {
+        Unmap();
+    }
+
+    MappedFile::MappedFile(MappedFile&& other) noexcept
+    {
+        *this = std::move(other);
+    }
+
+    MappedFile& MappedFile::operator=(MappedFile&& other) noexcept
+    {
+        if (this == &other)
+            return *this;
+
+        Unmap();
+
+        mapped_ = std::exchange(other.mapped_, false);
+        size_ = std::exchange(other.size_, 0);
+#if defined(_WIN32)
+        mapping_ = std::exchange(other.mapping_, nullptr);
+#endif
+
+        // An owned buffer may live in the small-string storage, so the data
+        // pointer is re-derived after the move rather than copied.
+        if (mapped_)
+        {
+            data_ = other.data_;
+        }
+        else
+        {
+            buffer_ = std::move(other.buffer_);
+            data_ = buffer_.data();
+        }
+
+        other.data_ = nullptr;
+        other.buffer_.clear();
+        return *this;
+    }
+
+    void MappedFile::Unmap() noexcept
+    {
+        if (mapped_)
+        {
+#if defined(_WIN32)
+            ::UnmapViewOfFile(data_);
+            ::CloseHandle(static_cast<HANDLE>(mapping_));
+            mapping_ = nullptr;
+#else
+            ::munmap(const_cast<char*>(data_), size_);
+#endif
+        }
+
+        data_ = nullptr;
+        size_ = 0;
+        mapped_ = false;
+        buffer_.clear();
+        buffer_.shrink_to_fit();
+    }
+
+    bool NextRecord(
+        const std::string_view source,
+        std::size_t& offset,
+        const char delimiter,
+        std::size_t& start,
+        std::size_t& count) noexcept
+    {
+        if (offset >= source.size())
+            return false;
+
+        start = offset;
+        const void* found = std::memchr(source.data() + offset, delimiter, source.size() - offset);
+
+        if (found == nullptr)
+        {
+            count = source.size() - offset;
+            offset = source.size();
+            return true;
+        }
+
+        const auto end = static_cast<std::size_t>(static_cast<const char*>(found) - source.data());
+        count = end - offset;
+        offset = end + 1u;
+        return true;
+    }
+
+    bool NextLine(
+        const std::string_view source,
+        std::size_t& offset,
+        const bool trimCarriageReturn,
+        std::size_t& start,
+        std::size_t& count) noexcept
+    {
+        if (!NextRecord(source, offset, '\n', start, count))
+            return false;
+
+        if (trimCarriageReturn && count > 0 && source[start + count - 1u] == '\r')
+            --count;
+
+        return true;
+    }
+
+    std::size_t CountLines(const std::string_view source) noexcept
+    {
+        std::size_t lines = 0;
+        const char* cursor = source.data();
+        const char* const end = source.data() + source.size();
+
+        while (cursor < end)
+        {
+            const void* found = std::memchr(cursor, '\n', static_cast<std::size_t>(end - cursor));
+
+            if (found == nullptr)
+                return lines + 1u;
+
+            ++lines;
+            cursor = static_cast<const char*>(found) + 1;
+        }
+
+        return lines;
+    }
+
+    namespace
+    {
+        struct MappingHandle
+        {
+            MappedFile file;
+            FileError error = FileError::none;
+            NativeErrorCode nativeError = 0;
+            std::string message;
+        };
+
+        [[nodiscard]] std::string_view MappingView(void* handle) noexcept
+        {
+            if (handle == nullptr)
+                return {};
+
+            return static_cast<const MappingHandle*>(handle)->file.View();
+        }
+
+        [[nodiscard]] std::string_view MappingRange(void* handle, const std::size_t start, const std::size_t count) noexcept
+        {
+            const std::string_view view = MappingView(handle);
+
+            if (start >= view.size())
+                return {};
+
+            return view.substr(start, count);
+        }
+
+        [[nodiscard]] std::string_view TrimBlanks(std::string_view text) noexcept
+        {
+            while (!text.empty() && (text.front() == ' ' || text.front() == '\t'))
+                text.remove_prefix(1);
+
+            while (!text.empty() && (text.back() == ' ' || text.back() == '\t' || text.back() == '\r'))
+                text.remove_suffix(1);
+
+            return text;
+        }
+    }
+
+    void* MapFile(const std::string_view path)
+    {
+        auto handle = std::make_unique<MappingHandle>();
+
+        try
+        {
+            handle->file = MappedFile(path);
+        }
+        catch (const FileException& exception)
+        {
+            handle->error = exception.Error();
+            handle->nativeError = exception.NativeError();
+            handle->message = exception.what();
+        }
+        catch (const FileReadException& exception)
+        {
+            handle->error = FileError::open_failed;
+            handle->nativeError = exception.NativeError();
+            handle->message = exception.what();
+        }
+        catch (const std::bad_alloc&)
+        {
+            handle->error = FileError::allocation_failed;
+            handle->message = "std_io mapped file: allocation failed.";
+        }
+        catch (const std::exception& exception)
+        {
+            handle->error = FileError::open_failed;
+            handle->message = exception.what();
+        }
+
+        return handle.release();
+    }
+
+    void ReleaseMapping(void* handle) noexcept
+    {
+        delete static_cast<MappingHandle*>(handle);
+    }
+
+    bool TryValidateMapping(
+        void* handle,
+        FileError& error,
+        NativeErrorCode& nativeError,
+        std::string& message) noexcept
+    {
+        const auto* mapping = static_cast<const MappingHandle*>(handle);
+
+        if (mapping == nullptr)
+        {
+            error = FileError::not_open;
+            nativeError = 0;
+            message = "std_io mapped file: released handle.";
+            return false;
+        }
+
+        error = mapping->error;
+        nativeError = mapping->nativeError;
+
+        try
+        {
+            message = mapping->message;
+        }
+        catch (...)
+        {
+            message.clear();
+        }
+
+        return error == FileError::none;
+    }
+
+    bool MappingIsMapped(void* handle) noexcept
+    {
+        return handle != nullptr && static_cast<const MappingHandle*>(handle)->file.IsMapped();
+    }
+
+    std::uint64_t MappingSize(void* handle) noexcept
+    {
+        return static_cast<std::uint64_t>(MappingView(handle).size());
+    }
+
+    std::size_t MappingCountLines(void* handle) noexcept
+    {
+        return CountLines(MappingView(handle));
+    }
+
+    bool MappingNextLine(
+        void* handle,
+        std::size_t& offset,
+        const bool trimCarriageReturn,
+        std::size_t& start,
+        std::size_t& count) noexcept
+    {
+        return NextLine(MappingView(handle), offset, trimCarriageReturn, start, count);
+    }
+
+    bool MappingNextRecord(
+        void* handle,
+        std::size_t& offset,
+        const char delimiter,
+        std::size_t& start,
+        std::size_t& count) noexcept
+    {
+        return NextRecord(MappingView(handle), offset, delimiter, start, count);
+    }
+
+    bool MappingField(
+        void* handle,
+        const std::size_t start,
+        const std::size_t count,
+        const char delimiter,
+        const std::size_t index,
+        std::size_t& fieldStart,
+        std::size_t& fieldCount) noexcept
+    {
+        const std::string_view view = MappingView(handle);
+        const std::string_view record = MappingRange(handle, start, count);
+        const std::size_t base = record.empty() ? std::min(start, view.size()) : start;
+        std::size_t offset = 0;
+        std::size_t current = 0;
+
+        while (true)
+        {
+            const std::size_t found = record.find(delimiter, offset);
+            const std::size_t end = found == std::string_view::npos ? record.size() : found;
+
+            if (current == index)
+            {
+                fieldStart = base + offset;
+                fieldCount = end - offset;
+                return true;
+            }
+
+            if (found == std::string_view::npos)
+                return false;
+
+            offset = found + 1u;
+            ++current;
+        }
+    }
+
+    std::string MappingText(void* handle, const std::size_t start, const std::size_t count)
+    {
+        return std::string(MappingRange(handle, start, count));
+    }
+
+    bool MappingParseI64(void* handle, const std::size_t start, const std::size_t count, std::int64_t& value) noexcept
+    {
+        std::string_view text = TrimBlanks(MappingRange(handle, start, count));
+
+        if (text.size() > 1 && text.front() == '+')
+            text.remove_prefix(1);
+
+        const char* const end = text.data() + text.size();
+        const auto [last, status] = std::from_chars(text.data(), end, value);
+        return !text.empty() && status == std::errc{} && last == end;
+    }
+
+    bool MappingParseF64(void* handle, const std::size_t start, const std::size_t count, double& value) noexcept
+    {
+        std::string_view text = TrimBlanks(MappingRange(handle, start, count));
+
+        if (text.size() > 1 && text.front() == '+')
+            text.remove_prefix(1);
+
+        const char* const end = text.data() + text.size();
+        const auto [last, status] = std::from_chars(text.data(), end, value);
+        return !text.empty() && status == std::errc{} && last == end;
+    }
+
+    bool MappingEquals(void* handle, const std::size_t start, const std::size_t count, const std::string_view text) noexcept
+    {
+        return MappingRange(handle, start, count) == text;
+    }
+
+    bool MappingStartsWith(void* handle, const std::size_t start, const std::size_t count, const std::string_view prefix) noexcept
+    {
+        return MappingRange(handle, start, count).starts_with(prefix);
+    }
+
+    bool MappingContains(void* handle, const std::size_t start, const std::size_t count, const std::string_view needle) noexcept
+    {
+        return MappingRange(handle, start, count).find(needle) != std::string_view::npos;
+    }
 }
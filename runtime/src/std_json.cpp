@@ -0,0 +1,211 @@
+#include "std_json.h"
+
+#include <optional>
+#include <unordered_set>
+
+namespace wio::runtime::std_json
+{
+    namespace
+    {
+        // Records values as Document nodes. Decoded strings and integer
+        // literals are appended to the document's text arena; under
+        // DuplicateKeys::Reject, keys are checked against the enclosing
+        // object's earlier keys, linearly while it is small.
+        class DocumentSink
+        {
+        public:
+            DocumentSink(Document& document, const DuplicateKeys duplicateKeys)
+                : document_(document), rejectDuplicates_(duplicateKeys == DuplicateKeys::Reject)
+            {
+            }
+
+            void Null() { pushNode(NodeKind::Null); }
+            void Boolean(const bool value) { document_.nodes[pushNode(NodeKind::Boolean)].boolean = value; }
+
+            void Integer(const std::string_view token)
+            {
+                Node& node = document_.nodes[pushNode(NodeKind::Integer)];
+                node.payload = document_.text.size();
+                node.length = static_cast<std::uint32_t>(token.size());
+                document_.text.append(token);
+            }
+
+            void Number(const double value)
+            {
+                document_.nodes[pushNode(NodeKind::Number)].payload = std::bit_cast<std::uint64_t>(value);
+            }
+
+            std::string& BeginString()
+            {
+                string_ = pushNode(NodeKind::String);
+                document_.nodes[string_].payload = document_.text.size();
+                return document_.text;
+            }
+
+            void EndString()
+            {
+                Node& node = document_.nodes[string_];
+                node.length = static_cast<std::uint32_t>(document_.text.size() - node.payload);
+            }
+
+            std::string& BeginKey() { return BeginString(); }
+
+            bool EndKey()
+            {
+                EndString();
+                if (!rejectDuplicates_)
+                    return true;
+
+                ObjectKeys& keys = objects_[objectDepth_ - 1u];
+                const std::string_view key = document_.Text(document_.nodes[string_]);
+                bool duplicate = false;
+                if (keys.count < detail::LinearKeyCheckLimit)
+                {
+                    duplicate = std::find(keys.recent, keys.recent + keys.count, key) != keys.recent + keys.count;
+                    keys.recent[keys.count] = key;
+                }
+                else
+                {
+                    if (!keys.set)
+                        keys.set.emplace(keys.recent, keys.recent + detail::LinearKeyCheckLimit);
+                    duplicate = !keys.set->insert(key).second;
+                }
+                ++keys.count;
+                return !duplicate;
+            }
+
+            void BeginArray() { containers_.push_back(pushNode(NodeKind::Array)); }
+            void EndArray(const std::uint32_t count) { closeContainer(count); }
+
+            void BeginObject()
+            {
+                containers_.push_back(pushNode(NodeKind::Object));
+                if (!rejectDuplicates_)
+                    return;
+                if (objectDepth_ == objects_.size())
+                    objects_.emplace_back();
+                ObjectKeys& keys = objects_[objectDepth_++];
+                keys.count = 0;
+                keys.set.reset();
+            }
+
+            void EndObject(const std::uint32_t count)
+            {
+                closeContainer(count);
+                if (rejectDuplicates_)
+                    --objectDepth_;
+            }
+
+        private:
+            struct ObjectKeys
+            {
+                std::size_t count = 0;
+                std::string_view recent[detail::LinearKeyCheckLimit];
+                std::optional<std::unordered_set<std::string_view>> set;
+            };
+
+            std::size_t pushNode(const NodeKind kind)
+            {
+                document_.nodes.push_back(Node{kind, false, 0, 0});
+                return document_.nodes.size() - 1u;
+            }
+
+            void closeContainer(const std::uint32_t count)
+            {
+                document_.nodes[containers_.back()].length = count;
+                containers_.pop_back();
+            }
+
+            Document& document_;
+            bool rejectDuplicates_;
+            std::size_t string_ = 0;
+            std::vector<std::size_t> containers_;
+            // Reused per nesting level, so only the first object at each
+            // depth allocates.
+            std::vector<ObjectKeys> objects_;
+            std::size_t objectDepth_ = 0;
+        };
+    }
+
+    std::int32_t ParseDocument(const std::string_view source, const ParseLimits& limits, Document& document,
+                               std::string& message)
+    {
+        document.nodes.clear();
+        document.text.clear();
+
+        if (const std::int32_t refused = detail::checkSource(source, limits, message); refused != 0)
+            return refused;
+
+        // Decoded text never outgrows its source spelling, so this keeps the
+        // arena (and every key view into it) in place for the whole parse.
+        document.text.reserve(source.size());
+        document.nodes.reserve(source.size() / 8u + 1u);
+
+        DocumentSink sink(document, limits.duplicateKeys);
+        detail::Parser<DocumentSink> parser(source, limits, sink);
+        if (!parser.Run())
+        {
+            message = parser.Failure();
+            document.nodes.clear();
+            document.text.clear();
+            return 1;
+        }
+        return 0;
+    }
+
+    void AppendQuoted(std::string& output, const std::string_view value)
+    {
+        static constexpr char hex[] = "0123456789abcdef";
+        output.push_back('"');
+        const char* cursor = value.data();
+        const char* end = cursor + value.size();
+        while (cursor < end)
+        {
+            const char* special = detail::findStringSpecial(cursor, end);
+            output.append(cursor, static_cast<std::size_t>(special - cursor));
+            if (special == end)
+                break;
+
+            const auto ch = static_cast<unsigned char>(*special);
+            switch (ch)
+            {
+            case '"': output += "\\\""; break;
+            case '\\': output += "\\\\"; break;
+            case '\b': output += "\\b"; break;
+            case '\f': output += "\\f"; break;
+            case '\n': output += "\\n"; break;
+            case '\r': output += "\\r"; break;
+            case '\t': output += "\\t"; break;
+            default:
+                output += "\\u00";
+                output.push_back(hex[ch >> 4u]);
+                output.push_back(hex[ch & 15u]);
+                break;
+            }
+            cursor = special + 1;
+        }
+        output.push_back('"');
+    }
+
+    void AppendNumber(std::string& output, const double value)
+    {
+        if (!std::isfinite(value))
+        {
+            output += "null";
+            return;
+        }
+        char buffer[32];
+        const auto [last, error] = std::to_chars(buffer, buffer + sizeof(buffer), value);
+        if (error != std::errc())
+        {
+            output += "null";
+            return;
+        }
+        output.append(buffer, static_cast<std::size_t>(last - buffer));
+    }
+
+    void AppendIndent(std::string& output, const std::size_t columns)
+    {
+        output.append(columns, ' ');
+    }
+}
@@ -1,12 +1,18 @@
 #include "std_net.h"
 
+#include "detail/readiness_reactor.h"
+
 #include <algorithm>
 #include <atomic>
 #include <cerrno>
 #include <chrono>
 #include <cstring>
+#include <functional>
 #include <memory>
 #include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
 
 #if defined(_WIN32)
 #define WIN32_LEAN_AND_MEAN
@@ -83,30 +89,18 @@ namespace wio::runtime::std_net
                 std::to_string(errorCode) + ".";
         }
 
+        void forgetWatchedDescriptor(NativeSocket value) noexcept;
+
         struct SocketHandle
         {
             SocketHandle()
             {
-#if !defined(_WIN32)
-                int wakePipe[2]{invalidSocket, invalidSocket};
-                if (pipe(wakePipe) == 0)
-                {
-                    wakeRead = wakePipe[0];
-                    wakeWrite = wakePipe[1];
-                    static_cast<void>(setNonBlocking(wakeRead, true));
-                    static_cast<void>(setNonBlocking(wakeWrite, true));
-                    const int readDescriptorFlags = fcntl(wakeRead, F_GETFD, 0);
-                    const int writeDescriptorFlags = fcntl(wakeWrite, F_GETFD, 0);
-                    if (readDescriptorFlags >= 0)
-                        static_cast<void>(fcntl(wakeRead, F_SETFD, readDescriptorFlags | FD_CLOEXEC));
-                    if (writeDescriptorFlags >= 0)
-                        static_cast<void>(fcntl(wakeWrite, F_SETFD, writeDescriptorFlags | FD_CLOEXEC));
-                }
-#endif
                 liveSocketCount.fetch_add(1, std::memory_order_relaxed);
             }
             ~SocketHandle()
             {
+                if (watched)
+                    forgetWatchedDescriptor(value);
                 closeNative(value);
 #if !defined(_WIN32)
                 closeNative(wakeRead);
@@ -114,13 +108,39 @@ namespace wio::runtime::std_net
 #endif
                 liveSocketCount.fetch_sub(1, std::memory_order_relaxed);
             }
+
+#if !defined(_WIN32)
+            // Only the blocking wait path needs the close wake pipe. Opening
+            // it lazily keeps reactor-driven sockets at one descriptor each.
+            // Callers hold lifecycleMutex.
+            void openWakePipe() noexcept
+            {
+                if (wakeRead != invalidSocket)
+                    return;
+                int wakePipe[2]{invalidSocket, invalidSocket};
+                if (pipe(wakePipe) != 0)
+                    return;
+                wakeRead = wakePipe[0];
+                wakeWrite = wakePipe[1];
+                static_cast<void>(setNonBlocking(wakeRead, true));
+                static_cast<void>(setNonBlocking(wakeWrite, true));
+                const int readDescriptorFlags = fcntl(wakeRead, F_GETFD, 0);
+                const int writeDescriptorFlags = fcntl(wakeWrite, F_GETFD, 0);
+                if (readDescriptorFlags >= 0)
+                    static_cast<void>(fcntl(wakeRead, F_SETFD, readDescriptorFlags | FD_CLOEXEC));
+                if (writeDescriptorFlags >= 0)
+                    static_cast<void>(fcntl(wakeWrite, F_SETFD, writeDescriptorFlags | FD_CLOEXEC));
+            }
+#endif
+
             std::atomic<std::size_t> references{1};
             std::mutex lifecycleMutex;
             std::mutex sendMutex;
             std::mutex receiveMutex;
             NativeSocket value = invalidSocket;
             bool closed = false;
-            std::uint64_t receiveTimeoutMilliseconds = 0;
+            bool watched = false;
+            std::atomic<std::uint64_t> receiveTimeoutMilliseconds{0};
 #if !defined(_WIN32)
             NativeSocket wakeRead = invalidSocket;
             NativeSocket wakeWrite = invalidSocket;
@@ -136,6 +156,7 @@ namespace wio::runtime::std_net
             const std::uint64_t timeoutMilliseconds,
             std::string& error) noexcept
         {
+#if defined(_WIN32)
             fd_set writable;
             fd_set exceptional;
             FD_ZERO(&writable);
@@ -146,10 +167,14 @@ namespace wio::runtime::std_net
                 static_cast<long>(std::min<std::uint64_t>(timeoutMilliseconds / 1'000, 2'147'483'647)),
                 static_cast<long>((timeoutMilliseconds % 1'000) * 1'000)};
             timeval* timeoutPointer = timeoutMilliseconds == 0 ? nullptr : &timeout;
-#if defined(_WIN32)
             const int ready = select(0, nullptr, &writable, &exceptional, timeoutPointer);
 #else
-            const int ready = select(value + 1, nullptr, &writable, &exceptional, timeoutPointer);
+            // poll, unlike select, has no FD_SETSIZE ceiling on descriptor
+            // values, which matters once many connections are open.
+            pollfd descriptor{value, POLLOUT, 0};
+            const int ready = poll(&descriptor, 1, timeoutMilliseconds == 0
+                ? -1
+                : static_cast<int>(std::min<std::uint64_t>(timeoutMilliseconds, 2'147'483'647)));
 #endif
             if (ready == 0)
             {
@@ -211,7 +236,7 @@ namespace wio::runtime::std_net
         {
             using Clock = std::chrono::steady_clock;
             const std::uint64_t configuredTimeout = honorConfiguredTimeout
-                ? state->receiveTimeoutMilliseconds
+                ? state->receiveTimeoutMilliseconds.load(std::memory_order_acquire)
                 : 0;
             const auto deadline = configuredTimeout == 0
                 ? Clock::time_point::max()
@@ -227,6 +252,9 @@ namespace wio::runtime::std_net
                         return false;
                     }
                     value = state->value;
+#if !defined(_WIN32)
+                    state->openWakePipe();
+#endif
                 }
 
                 std::uint64_t waitMicroseconds = 50'000;
@@ -298,6 +326,59 @@ namespace wio::runtime::std_net
                 return false;
             }
         }
+
+        void describePeer(
+            const sockaddr_storage& address,
+            const socklen_t addressSize,
+            std::string& remoteAddress,
+            std::uint16_t& remotePort) noexcept
+        {
+            char hostBuffer[NI_MAXHOST]{};
+            if (getnameinfo(reinterpret_cast<const sockaddr*>(&address), addressSize,
+                            hostBuffer, sizeof(hostBuffer), nullptr, 0, NI_NUMERICHOST) == 0)
+                remoteAddress = hostBuffer;
+            if (address.ss_family == AF_INET)
+                remotePort = ntohs(reinterpret_cast<const sockaddr_in*>(&address)->sin_port);
+            else if (address.ss_family == AF_INET6)
+                remotePort = ntohs(reinterpret_cast<const sockaddr_in6*>(&address)->sin6_port);
+        }
+
+        // Captures the live native descriptor for a non-blocking operation.
+        // The caller's lease keeps the descriptor from being reused.
+        bool liveDescriptor(SocketHandle* state, NativeSocket& value, std::string& error) noexcept
+        {
+            std::lock_guard lifecycleLock(state->lifecycleMutex);
+            if (state->closed)
+            {
+                error = "socket is closed";
+                return false;
+            }
+            value = state->value;
+            return true;
+        }
+
+#if defined(__linux__)
+        using detail::ReadinessReactor;
+
+        ReadinessReactor& reactor()
+        {
+            // Intentionally leaked: sockets owned by static Wio objects may be
+            // released during static destruction, after a function-local
+            // reactor would already be gone. The poller thread ends with the
+            // process.
+            static ReadinessReactor* value = new ReadinessReactor();
+            return *value;
+        }
+
+        void forgetWatchedDescriptor(const NativeSocket value) noexcept
+        {
+            reactor().WakeAll(value);
+        }
+#else
+        void forgetWatchedDescriptor(NativeSocket) noexcept
+        {
+        }
+#endif
     }
 
     bool Resolve(const std::string_view host, const std::uint16_t port,
@@ -476,7 +557,7 @@ namespace wio::runtime::std_net
         if (setsockopt(value, SOL_SOCKET, SO_RCVTIMEO, data, size) != 0 ||
             setsockopt(value, SOL_SOCKET, SO_SNDTIMEO, data, size) != 0)
         { error = errorMessage("setsockopt"); return false; }
-        state->receiveTimeoutMilliseconds = milliseconds;
+        state->receiveTimeoutMilliseconds.store(milliseconds, std::memory_order_release);
         return true;
     }
 
@@ -631,17 +712,235 @@ namespace wio::runtime::std_net
             }
         }
         bytes.assign(buffer.data(), static_cast<std::size_t>(result));
-        char hostBuffer[NI_MAXHOST]{};
-        if (getnameinfo(reinterpret_cast<const sockaddr*>(&address), addressSize,
-                        hostBuffer, sizeof(hostBuffer), nullptr, 0, NI_NUMERICHOST) == 0)
-            remoteAddress = hostBuffer;
-        if (address.ss_family == AF_INET)
-            remotePort = ntohs(reinterpret_cast<const sockaddr_in*>(&address)->sin_port);
-        else if (address.ss_family == AF_INET6)
-            remotePort = ntohs(reinterpret_cast<const sockaddr_in6*>(&address)->sin6_port);
+        describePeer(address, addressSize, remoteAddress, remotePort);
+        return true;
+    }
+
+#if defined(__linux__)
+    bool TrySend(void* handle, const std::string_view bytes, std::size_t& sent,
+                 bool& wouldBlock, std::string& error) noexcept
+    {
+        sent = 0; wouldBlock = false; error.clear();
+        if (!Retain(handle, error)) return false;
+        SocketLease lease(handle);
+        auto* state = asHandle(handle);
+        std::lock_guard sendLock(state->sendMutex);
+        NativeSocket value = invalidSocket;
+        if (!liveDescriptor(state, value, error)) return false;
+        while (sent < bytes.size())
+        {
+            const auto result = send(value, bytes.data() + sent, bytes.size() - sent,
+                MSG_DONTWAIT | MSG_NOSIGNAL);
+            if (result < 0)
+            {
+                const int nativeError = lastSocketError();
+                if (nativeError == EINTR)
+                    continue;
+                if (isWouldBlock(nativeError))
+                {
+                    wouldBlock = true;
+                    return false;
+                }
+                error = errorMessage("send", nativeError);
+                return false;
+            }
+            sent += static_cast<std::size_t>(result);
+        }
+        return true;
+    }
+
+    bool TryReceive(void* handle, const std::size_t maximumBytes, std::string& bytes,
+                    bool& wouldBlock, std::string& error) noexcept
+    {
+        bytes.clear(); wouldBlock = false; error.clear();
+        if (!Retain(handle, error)) return false;
+        SocketLease lease(handle);
+        auto* state = asHandle(handle);
+        std::lock_guard receiveLock(state->receiveMutex);
+        NativeSocket value = invalidSocket;
+        if (!liveDescriptor(state, value, error)) return false;
+        // Receive straight into the result string; there is no staging
+        // buffer to copy out of.
+        bytes.resize(std::max<std::size_t>(1, maximumBytes));
+        ssize_t result = 0;
+        do
+            result = recv(value, bytes.data(), bytes.size(), MSG_DONTWAIT);
+        while (result < 0 && lastSocketError() == EINTR);
+        const int nativeError = result < 0 ? lastSocketError() : 0;
+        if (!liveDescriptor(state, value, error))
+        {
+            bytes.clear();
+            return false;
+        }
+        if (result < 0)
+        {
+            bytes.clear();
+            if (isWouldBlock(nativeError)) { wouldBlock = true; return false; }
+            error = errorMessage("receive", nativeError);
+            return false;
+        }
+        bytes.resize(static_cast<std::size_t>(result));
+        return true;
+    }
+
+    bool TryWaitAccept(void* listener, bool& wouldBlock, std::string& error) noexcept
+    {
+        wouldBlock = false; error.clear();
+        if (!Retain(listener, error)) return false;
+        SocketLease lease(listener);
+        auto* state = asHandle(listener);
+        NativeSocket value = invalidSocket;
+        if (!liveDescriptor(state, value, error)) return false;
+        pollfd descriptor{value, POLLIN, 0};
+        int ready = 0;
+        do
+            ready = poll(&descriptor, 1, 0);
+        while (ready < 0 && errno == EINTR);
+        if (ready < 0) { error = errorMessage("accept wait"); return false; }
+        if (!liveDescriptor(state, value, error)) return false;
+        if (ready == 0) { wouldBlock = true; return false; }
+        return true;
+    }
+
+    bool TryUdpReceiveFrom(void* handle, const std::size_t maximumBytes, std::string& bytes,
+                           std::string& remoteAddress, std::uint16_t& remotePort,
+                           bool& wouldBlock, std::string& error) noexcept
+    {
+        bytes.clear(); remoteAddress.clear(); remotePort = 0; wouldBlock = false; error.clear();
+        if (!Retain(handle, error)) return false;
+        SocketLease lease(handle);
+        auto* state = asHandle(handle);
+        std::lock_guard receiveLock(state->receiveMutex);
+        NativeSocket value = invalidSocket;
+        if (!liveDescriptor(state, value, error)) return false;
+        sockaddr_storage address{};
+        socklen_t addressSize = sizeof(address);
+        bytes.resize(std::max<std::size_t>(1, maximumBytes));
+        ssize_t result = 0;
+        do
+            result = recvfrom(value, bytes.data(), bytes.size(), MSG_DONTWAIT,
+                reinterpret_cast<sockaddr*>(&address), &addressSize);
+        while (result < 0 && lastSocketError() == EINTR);
+        const int nativeError = result < 0 ? lastSocketError() : 0;
+        if (!liveDescriptor(state, value, error))
+        {
+            bytes.clear();
+            return false;
+        }
+        if (result < 0)
+        {
+            bytes.clear();
+            if (isWouldBlock(nativeError)) { wouldBlock = true; return false; }
+            error = errorMessage("UDP recvfrom", nativeError);
+            return false;
+        }
+        bytes.resize(static_cast<std::size_t>(result));
+        describePeer(address, addressSize, remoteAddress, remotePort);
         return true;
     }
 
+    bool ReactorAvailable() noexcept
+    {
+        return reactor().Available();
+    }
+
+    std::uint64_t WatchReadiness(void* handle, const bool writable,
+                                 std::function<void()> ready, std::string& error) noexcept
+    {
+        error.clear();
+        if (!ReactorAvailable()) { error = "socket readiness reactor is unavailable"; return 0; }
+        if (!Retain(handle, error)) return 0;
+        SocketLease lease(handle);
+        auto* state = asHandle(handle);
+        // Registration happens under the lifecycle lock so Close either sees
+        // this waiter and wakes it, or the waiter observes the closed state.
+        std::lock_guard lifecycleLock(state->lifecycleMutex);
+        if (state->closed) { error = "socket is closed"; return 0; }
+        try
+        {
+            int nativeError = 0;
+            const auto token = reactor().Watch(state->value, writable, std::move(ready), nativeError);
+            if (token == 0)
+            {
+                error = errorMessage("register socket readiness", nativeError);
+                return 0;
+            }
+            state->watched = true;
+            return token;
+        }
+        catch (const std::exception&)
+        {
+            error = "socket readiness registration failed";
+            return 0;
+        }
+    }
+
+    void CancelReadiness(const std::uint64_t token) noexcept
+    {
+        if (token != 0)
+            reactor().Cancel(token);
+    }
+
+    std::uint64_t ReactorPendingCount() noexcept
+    {
+        return ReactorAvailable() ? reactor().PendingCount() : 0;
+    }
+#else
+    namespace
+    {
+        bool reactorUnavailable(std::string& error) noexcept
+        {
+            error = "non-blocking socket operations require the readiness reactor";
+            return false;
+        }
+    }
+
+    bool TrySend(void*, std::string_view, std::size_t& sent, bool& wouldBlock, std::string& error) noexcept
+    {
+        sent = 0; wouldBlock = false;
+        return reactorUnavailable(error);
+    }
+
+    bool TryReceive(void*, std::size_t, std::string& bytes, bool& wouldBlock, std::string& error) noexcept
+    {
+        bytes.clear(); wouldBlock = false;
+        return reactorUnavailable(error);
+    }
+
+    bool TryWaitAccept(void*, bool& wouldBlock, std::string& error) noexcept
+    {
+        wouldBlock = false;
+        return reactorUnavailable(error);
+    }
+
+    bool TryUdpReceiveFrom(void*, std::size_t, std::string& bytes, std::string& remoteAddress,
+                           std::uint16_t& remotePort, bool& wouldBlock, std::string& error) noexcept
+    {
+        bytes.clear(); remoteAddress.clear(); remotePort = 0; wouldBlock = false;
+        return reactorUnavailable(error);
+    }
+
+    bool ReactorAvailable() noexcept { return false; }
+
+    std::uint64_t WatchReadiness(void*, bool, std::function<void()>, std::string& error) noexcept
+    {
+        static_cast<void>(reactorUnavailable(error));
+        return 0;
+    }
+
+    void CancelReadiness(std::uint64_t) noexcept
+    {
+    }
+
+    std::uint64_t ReactorPendingCount() noexcept { return 0; }
+#endif
+
+    std::uint64_t ConfiguredTimeout(void* handle) noexcept
+    {
+        if (!handle) return 0;
+        return asHandle(handle)->receiveTimeoutMilliseconds.load(std::memory_order_acquire);
+    }
+
     bool Retain(void* handle, std::string& error) noexcept
     {
         error.clear();
@@ -671,25 +970,35 @@ namespace wio::runtime::std_net
         if (!handle) return;
         auto* state = asHandle(handle);
         NativeSocket value = invalidSocket;
+        bool watched = false;
+#if !defined(_WIN32)
+        NativeSocket wakeWrite = invalidSocket;
+#endif
         {
             std::lock_guard lock(state->lifecycleMutex);
             if (state->closed) return;
             state->closed = true;
             value = state->value;
+            watched = state->watched;
+#if !defined(_WIN32)
+            wakeWrite = state->wakeWrite;
+#endif
         }
         if (value != invalidSocket)
         {
 #if defined(_WIN32)
             shutdown(value, SD_BOTH);
 #else
-            if (state->wakeWrite != invalidSocket)
+            if (wakeWrite != invalidSocket)
             {
                 const char signal = 1;
-                const ssize_t ignored = ::write(state->wakeWrite, &signal, sizeof(signal));
+                const ssize_t ignored = ::write(wakeWrite, &signal, sizeof(signal));
                 static_cast<void>(ignored);
             }
             shutdown(value, SHUT_RDWR);
 #endif
+            if (watched)
+                forgetWatchedDescriptor(value);
         }
         // The native descriptor closes with the final retained lease. This
         // prevents descriptor reuse while an operation is unwinding without
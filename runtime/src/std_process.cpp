@@ -1,5 +1,7 @@
 #include "std_process.h"
 
+#include "detail/readiness_reactor.h"
+
 #include <bit>
 #include <algorithm>
 #include <atomic>
@@ -39,6 +41,7 @@
     #include <pthread.h>
     #include <signal.h>
     #include <sys/select.h>
+    #include <sys/syscall.h>
     #include <sys/wait.h>
     #include <unistd.h>
 #endif
@@ -73,6 +76,10 @@ namespace wio::runtime::std_process
             int stdinWrite = -1;
             int stdoutRead = -1;
             int stderrRead = -1;
+            // pidfd that becomes readable when the child exits; -1 when the
+            // kernel has no pidfd_open and exit waits fall back to polling.
+            int exitWatch = -1;
+            bool watched = false;
 #endif
         };
 
@@ -132,6 +139,30 @@ namespace wio::runtime::std_process
             bool active_ = false;
             bool previouslyBlocked_ = false;
         };
+
+        int openExitWatch(const pid_t process) noexcept
+        {
+#if defined(SYS_pidfd_open)
+            const long descriptor = ::syscall(SYS_pidfd_open, process, 0);
+            return descriptor < 0 ? -1 : static_cast<int>(descriptor);
+#else
+            static_cast<void>(process);
+            return -1;
+#endif
+        }
+#endif
+
+#if defined(__linux__)
+        using detail::ReadinessReactor;
+
+        ReadinessReactor& reactor()
+        {
+            // Intentionally leaked for the same reason as the socket reactor:
+            // process objects owned by static Wio values may be closed during
+            // static destruction. The poller thread ends with the process.
+            static ReadinessReactor* value = new ReadinessReactor();
+            return *value;
+        }
 #endif
 
         void setProcessError(
@@ -902,6 +933,7 @@ namespace wio::runtime::std_process
         state->stdinWrite = stdinPipe[1];
         state->stdoutRead = stdoutPipe[0];
         state->stderrRead = stderrPipe[0];
+        state->exitWatch = openExitWatch(child);
 #endif
         handle = state.release();
         return true;
@@ -1107,6 +1139,55 @@ namespace wio::runtime::std_process
         return terminateProcessState(asProcess(handle), error, nativeError, message);
     }
 
+    std::uint64_t ProcessWatch(void* handle, const ProcessEvent event, std::function<void()> ready) noexcept
+    {
+#if defined(__linux__)
+        if (!handle) return 0;
+        auto* state = asProcess(handle);
+        // Registration happens under the lifecycle lock so ProcessClose either
+        // sees this waiter and wakes it, or the waiter observes `closed`.
+        std::lock_guard lifecycleLock(state->lifecycleMutex);
+        if (state->closed) return 0;
+        const int descriptor = event == ProcessEvent::exited ? state->exitWatch
+            : event == ProcessEvent::stderr_readable ? state->stderrRead : state->stdoutRead;
+        if (descriptor < 0 || !reactor().Available()) return 0;
+        try
+        {
+            int nativeError = 0;
+            const auto token = reactor().Watch(descriptor, false, std::move(ready), nativeError);
+            if (token != 0)
+                state->watched = true;
+            return token;
+        }
+        catch (const std::exception&)
+        {
+            return 0;
+        }
+#else
+        static_cast<void>(handle); static_cast<void>(event); static_cast<void>(ready);
+        return 0;
+#endif
+    }
+
+    void ProcessCancelWatch(const std::uint64_t token) noexcept
+    {
+#if defined(__linux__)
+        if (token != 0)
+            reactor().Cancel(token);
+#else
+        static_cast<void>(token);
+#endif
+    }
+
+    std::uint64_t ProcessWatchPendingCount() noexcept
+    {
+#if defined(__linux__)
+        return reactor().PendingCount();
+#else
+        return 0;
+#endif
+    }
+
     bool ProcessRetain(void* handle, std::string& message) noexcept
     {
         ProcessError error = ProcessError::none;
@@ -1119,6 +1200,12 @@ namespace wio::runtime::std_process
         return liveProcessCount.load(std::memory_order_acquire);
     }
 
+    std::uint64_t ProcessLeaseCount(void* handle) noexcept
+    {
+        if (!handle) return 0;
+        return asProcess(handle)->references.load(std::memory_order_acquire) - 1;
+    }
+
     void ProcessRelease(void* handle) noexcept
     {
         if (!handle) return;
@@ -1143,6 +1230,16 @@ namespace wio::runtime::std_process
         int exitCode = -1;
         error = ProcessError::none; nativeError = 0; message.clear();
         static_cast<void>(waitProcessState(state, exitCode, error, nativeError, message));
+#if defined(__linux__)
+        // Watches registered before `closed` was set are woken here, before
+        // their descriptors are closed and can be reused.
+        if (state->watched)
+        {
+            reactor().WakeAll(state->stdoutRead);
+            reactor().WakeAll(state->stderrRead);
+            reactor().WakeAll(state->exitWatch);
+        }
+#endif
         {
             std::lock_guard lock(state->stdinMutex); closePipe(state->stdinWrite);
         }
@@ -1154,6 +1251,8 @@ namespace wio::runtime::std_process
         }
 #if defined(_WIN32)
         if (state->process) { CloseHandle(state->process); state->process = nullptr; }
+#else
+        closePipe(state->exitWatch);
 #endif
         ProcessRelease(state);
     }
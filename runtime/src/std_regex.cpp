@@ -1,50 +1,1688 @@
 #include "std_regex.h"
 
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstring>
+#include <limits>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
 #include <regex>
+#include <unordered_map>
+#include <utility>
 
 namespace wio::runtime::std_regex
 {
-    bool PatternLooksSafe(const std::string_view pattern) noexcept
+    namespace
     {
-        if (pattern.size() > 4096u) return false;
-        bool escaped = false;
-        bool previousQuantifier = false;
-        int groupDepth = 0;
-        std::vector<bool> groupHasQuantifier;
-        for (const char ch : pattern)
+        constexpr std::size_t unset = std::numeric_limits<std::size_t>::max();
+        constexpr std::uint32_t unbounded = std::numeric_limits<std::uint32_t>::max();
+        constexpr std::size_t maxNesting = 256u;
+        constexpr std::uint32_t maxCountedRepeat = 1000u;
+        constexpr std::size_t maxProgramSize = 1u << 15u;
+        constexpr std::size_t maxDfaStates = 4096u;
+        constexpr std::size_t patternCacheCapacity = 64u;
+
+        bool isWordByte(const unsigned char byte) noexcept
         {
-            if (escaped) { escaped = false; previousQuantifier = false; continue; }
-            if (ch == '\\') { escaped = true; continue; }
-            if (ch == '(') { ++groupDepth; groupHasQuantifier.push_back(false); previousQuantifier = false; continue; }
-            if (ch == ')') { if (groupDepth > 0) --groupDepth; previousQuantifier = false; continue; }
-            const bool quantifier = ch == '*' || ch == '+' || ch == '?';
-            if (quantifier)
+            return (byte >= 'a' && byte <= 'z') || (byte >= 'A' && byte <= 'Z') ||
+                (byte >= '0' && byte <= '9') || byte == '_';
+        }
+
+        bool isAlnumByte(const unsigned char byte) noexcept
+        {
+            return isWordByte(byte) && byte != '_';
+        }
+
+        int hexValue(const char ch) noexcept
+        {
+            if (ch >= '0' && ch <= '9') return ch - '0';
+            if (ch >= 'a' && ch <= 'f') return ch - 'a' + 10;
+            if (ch >= 'A' && ch <= 'F') return ch - 'A' + 10;
+            return -1;
+        }
+
+        struct ByteSet
+        {
+            std::array<std::uint64_t, 4> bits{};
+
+            void Add(const unsigned char byte) noexcept { bits[byte >> 6u] |= std::uint64_t{1} << (byte & 63u); }
+            void Remove(const unsigned char byte) noexcept { bits[byte >> 6u] &= ~(std::uint64_t{1} << (byte & 63u)); }
+
+            [[nodiscard]] bool Has(const unsigned char byte) const noexcept
             {
-                if (previousQuantifier) return false;
-                if (!groupHasQuantifier.empty()) groupHasQuantifier.back() = true;
+                return ((bits[byte >> 6u] >> (byte & 63u)) & 1u) != 0u;
             }
-            if (quantifier && !groupHasQuantifier.empty() && groupHasQuantifier.back() && ch == '+')
+
+            void AddRange(const unsigned char low, const unsigned char high) noexcept
             {
-                // Conservative rejection of common nested/repeated forms.
-                const auto close = pattern.find(')');
-                if (close != std::string_view::npos && close + 1 < pattern.size() &&
-                    (pattern[close + 1] == '+' || pattern[close + 1] == '*')) return false;
+                for (unsigned value = low; value <= high; ++value)
+                    Add(static_cast<unsigned char>(value));
             }
-            previousQuantifier = quantifier;
+
+            void Merge(const ByteSet& other) noexcept
+            {
+                for (std::size_t i = 0; i < bits.size(); ++i)
+                    bits[i] |= other.bits[i];
+            }
+
+            void Invert() noexcept
+            {
+                for (auto& word : bits)
+                    word = ~word;
+            }
+
+            // ASCII case folding, the same folding std::regex::icase applies
+            // in the "C" locale.
+            void FoldCase() noexcept
+            {
+                for (unsigned char lower = 'a'; lower <= 'z'; ++lower)
+                {
+                    const auto upper = static_cast<unsigned char>(lower - 'a' + 'A');
+                    if (Has(lower) || Has(upper))
+                    {
+                        Add(lower);
+                        Add(upper);
+                    }
+                }
+            }
+
+            [[nodiscard]] int Count() const noexcept
+            {
+                int count = 0;
+                for (const auto word : bits)
+                    count += std::popcount(word);
+                return count;
+            }
+
+            [[nodiscard]] unsigned char First() const noexcept
+            {
+                for (unsigned value = 0; value < 256u; ++value)
+                    if (Has(static_cast<unsigned char>(value)))
+                        return static_cast<unsigned char>(value);
+                return 0;
+            }
+        };
+
+        ByteSet classSet(const char name)
+        {
+            ByteSet set;
+            switch (name)
+            {
+            case 'd': case 'D':
+                set.AddRange('0', '9');
+                break;
+            case 'w': case 'W':
+                for (unsigned value = 0; value < 256u; ++value)
+                    if (isWordByte(static_cast<unsigned char>(value)))
+                        set.Add(static_cast<unsigned char>(value));
+                break;
+            default:
+                for (const char space : {' ', '\t', '\n', '\v', '\f', '\r'})
+                    set.Add(static_cast<unsigned char>(space));
+                break;
+            }
+            if (name == 'D' || name == 'W' || name == 'S')
+                set.Invert();
+            return set;
         }
-        return !escaped && groupDepth == 0;
-    }
 
-    namespace
-    {
-        std::regex compile(const std::string_view pattern, const bool ignoreCase)
+        enum class NodeKind : std::uint8_t
+        {
+            Empty,
+            Bytes,
+            Concat,
+            Alternate,
+            Repeat,
+            Capture,
+            Begin,
+            End,
+            WordBoundary,
+            NotWordBoundary
+        };
+
+        struct Node
+        {
+            NodeKind kind = NodeKind::Empty;
+            ByteSet set;
+            std::vector<std::uint32_t> children;
+            std::uint32_t min = 0;
+            std::uint32_t max = 0;
+            std::uint32_t group = 0;
+            bool greedy = true;
+        };
+
+        // Recursive-descent parser for the ECMAScript subset the automaton
+        // covers. Anything outside it, invalid patterns included, is reported
+        // as unsupported and left to std::regex, which either runs the
+        // pattern or produces its usual error.
+        class Parser
+        {
+        public:
+            Parser(const std::string_view pattern, const bool ignoreCase)
+                : pattern_(pattern), ignoreCase_(ignoreCase)
+            {
+            }
+
+            bool Parse(std::vector<Node>& nodes, std::uint32_t& root, std::uint32_t& groups)
+            {
+                nodes_ = &nodes;
+                if (!parseAlternation(root, 0) || pos_ != pattern_.size())
+                    return false;
+                groups = groups_;
+                return true;
+            }
+
+        private:
+            std::string_view pattern_;
+            bool ignoreCase_;
+            std::size_t pos_ = 0;
+            std::uint32_t groups_ = 0;
+            std::vector<Node>* nodes_ = nullptr;
+
+            [[nodiscard]] bool more() const noexcept { return pos_ < pattern_.size(); }
+            [[nodiscard]] char peek() const noexcept { return pattern_[pos_]; }
+
+            std::uint32_t add(Node node)
+            {
+                nodes_->push_back(std::move(node));
+                return static_cast<std::uint32_t>(nodes_->size() - 1u);
+            }
+
+            std::uint32_t addKind(const NodeKind kind)
+            {
+                Node node;
+                node.kind = kind;
+                return add(std::move(node));
+            }
+
+            std::uint32_t addBytes(ByteSet set)
+            {
+                if (ignoreCase_)
+                    set.FoldCase();
+                Node node;
+                node.kind = NodeKind::Bytes;
+                node.set = set;
+                return add(std::move(node));
+            }
+
+            bool parseAlternation(std::uint32_t& out, const std::size_t depth)
+            {
+                if (depth > maxNesting)
+                    return false;
+                std::vector<std::uint32_t> branches;
+                std::uint32_t branch = 0;
+                if (!parseConcat(branch, depth))
+                    return false;
+                branches.push_back(branch);
+                while (more() && peek() == '|')
+                {
+                    ++pos_;
+                    if (!parseConcat(branch, depth))
+                        return false;
+                    branches.push_back(branch);
+                }
+                if (branches.size() == 1u)
+                {
+                    out = branches.front();
+                    return true;
+                }
+                Node node;
+                node.kind = NodeKind::Alternate;
+                node.children = std::move(branches);
+                out = add(std::move(node));
+                return true;
+            }
+
+            bool parseConcat(std::uint32_t& out, const std::size_t depth)
+            {
+                std::vector<std::uint32_t> items;
+                while (more() && peek() != '|' && peek() != ')')
+                {
+                    std::uint32_t item = 0;
+                    if (!parseRepeat(item, depth))
+                        return false;
+                    items.push_back(item);
+                }
+                if (items.empty())
+                    out = addKind(NodeKind::Empty);
+                else if (items.size() == 1u)
+                    out = items.front();
+                else
+                {
+                    Node node;
+                    node.kind = NodeKind::Concat;
+                    node.children = std::move(items);
+                    out = add(std::move(node));
+                }
+                return true;
+            }
+
+            bool parseCount(std::uint32_t& min, std::uint32_t& max)
+            {
+                ++pos_;
+                const auto readNumber = [this](std::uint32_t& value)
+                {
+                    const std::size_t begin = pos_;
+                    std::uint64_t number = 0;
+                    while (more() && peek() >= '0' && peek() <= '9')
+                    {
+                        number = std::min<std::uint64_t>(number * 10u + static_cast<std::uint64_t>(peek() - '0'),
+                                                         std::uint64_t{unbounded} - 1u);
+                        ++pos_;
+                    }
+                    value = static_cast<std::uint32_t>(number);
+                    return pos_ != begin;
+                };
+
+                if (!readNumber(min))
+                    return false;
+                max = min;
+                if (more() && peek() == ',')
+                {
+                    ++pos_;
+                    if (!readNumber(max))
+                        max = unbounded;
+                }
+                if (!more() || peek() != '}')
+                    return false;
+                ++pos_;
+                return min <= max && min <= maxCountedRepeat && (max == unbounded || max <= maxCountedRepeat);
+            }
+
+            bool parseRepeat(std::uint32_t& out, const std::size_t depth)
+            {
+                std::uint32_t atom = 0;
+                if (!parseAtom(atom, depth))
+                    return false;
+                if (!more())
+                {
+                    out = atom;
+                    return true;
+                }
+
+                std::uint32_t min = 0;
+                std::uint32_t max = 0;
+                switch (peek())
+                {
+                case '*': min = 0; max = unbounded; ++pos_; break;
+                case '+': min = 1; max = unbounded; ++pos_; break;
+                case '?': min = 0; max = 1; ++pos_; break;
+                case '{':
+                    if (!parseCount(min, max))
+                        return false;
+                    break;
+                default:
+                    out = atom;
+                    return true;
+                }
+
+                const NodeKind kind = (*nodes_)[atom].kind;
+                if (kind == NodeKind::Begin || kind == NodeKind::End ||
+                    kind == NodeKind::WordBoundary || kind == NodeKind::NotWordBoundary)
+                    return false;
+
+                bool greedy = true;
+                if (more() && peek() == '?')
+                {
+                    greedy = false;
+                    ++pos_;
+                }
+                if (more() && (peek() == '*' || peek() == '+' || peek() == '?' || peek() == '{'))
+                    return false;
+
+                Node node;
+                node.kind = NodeKind::Repeat;
+                node.children.push_back(atom);
+                node.min = min;
+                node.max = max;
+                node.greedy = greedy;
+                out = add(std::move(node));
+                return true;
+            }
+
+            // Escapes that stand for one byte, valid inside and outside
+            // classes; -1 when the escape is not one of them.
+            int byteEscape(const char ch)
+            {
+                switch (ch)
+                {
+                case 't': return '\t';
+                case 'n': return '\n';
+                case 'r': return '\r';
+                case 'f': return '\f';
+                case 'v': return '\v';
+                case 'x':
+                {
+                    if (pos_ + 2u > pattern_.size())
+                        return -1;
+                    const int high = hexValue(pattern_[pos_]);
+                    const int low = hexValue(pattern_[pos_ + 1u]);
+                    if (high < 0 || low < 0 || high >= 8)
+                        return -1;
+                    pos_ += 2u;
+                    return high * 16 + low;
+                }
+                default:
+                    break;
+                }
+                const auto byte = static_cast<unsigned char>(ch);
+                if (byte > 0x20u && byte < 0x7fu && !isAlnumByte(byte))
+                    return byte;
+                return -1;
+            }
+
+            static bool isClassEscape(const char ch) noexcept
+            {
+                return ch == 'd' || ch == 'D' || ch == 'w' || ch == 'W' || ch == 's' || ch == 'S';
+            }
+
+            bool parseEscape(std::uint32_t& out)
+            {
+                if (pos_ + 1u >= pattern_.size())
+                    return false;
+                const char ch = pattern_[pos_ + 1u];
+                pos_ += 2u;
+                if (isClassEscape(ch))
+                {
+                    out = addBytes(classSet(ch));
+                    return true;
+                }
+                if (ch == 'b' || ch == 'B')
+                {
+                    out = addKind(ch == 'b' ? NodeKind::WordBoundary : NodeKind::NotWordBoundary);
+                    return true;
+                }
+                const int byte = byteEscape(ch);
+                if (byte < 0)
+                    return false;
+                ByteSet set;
+                set.Add(static_cast<unsigned char>(byte));
+                out = addBytes(set);
+                return true;
+            }
+
+            // One class member: a byte (returned through `value`) or a class
+            // escape merged straight into `set` (value = -1).
+            bool parseClassAtom(ByteSet& set, int& value)
+            {
+                const char ch = peek();
+                if (ch == '[')
+                    return false;
+                if (ch != '\\')
+                {
+                    value = static_cast<unsigned char>(ch);
+                    ++pos_;
+                    return true;
+                }
+                if (pos_ + 1u >= pattern_.size())
+                    return false;
+                const char escaped = pattern_[pos_ + 1u];
+                pos_ += 2u;
+                if (isClassEscape(escaped))
+                {
+                    set.Merge(classSet(escaped));
+                    value = -1;
+                    return true;
+                }
+                value = byteEscape(escaped);
+                return value >= 0;
+            }
+
+            bool parseClass(std::uint32_t& out)
+            {
+                ++pos_;
+                bool negate = false;
+                if (more() && peek() == '^')
+                {
+                    negate = true;
+                    ++pos_;
+                }
+                if (more() && peek() == ']')
+                    return false;
+
+                ByteSet set;
+                while (true)
+                {
+                    if (!more())
+                        return false;
+                    if (peek() == ']')
+                    {
+                        ++pos_;
+                        break;
+                    }
+                    int low = 0;
+                    if (!parseClassAtom(set, low))
+                        return false;
+                    const bool range = pos_ + 1u < pattern_.size() && peek() == '-' && pattern_[pos_ + 1u] != ']';
+                    if (!range)
+                    {
+                        if (low >= 0)
+                            set.Add(static_cast<unsigned char>(low));
+                        continue;
+                    }
+                    if (low < 0)
+                        return false;
+                    ++pos_;
+                    int high = 0;
+                    if (!parseClassAtom(set, high) || high < 0 || low > high || high >= 0x80)
+                        return false;
+                    set.AddRange(static_cast<unsigned char>(low), static_cast<unsigned char>(high));
+                }
+
+                if (ignoreCase_)
+                    set.FoldCase();
+                if (negate)
+                    set.Invert();
+                Node node;
+                node.kind = NodeKind::Bytes;
+                node.set = set;
+                out = add(std::move(node));
+                return true;
+            }
+
+            bool parseAtom(std::uint32_t& out, const std::size_t depth)
+            {
+                const char ch = peek();
+                switch (ch)
+                {
+                case '(':
+                {
+                    ++pos_;
+                    bool capture = true;
+                    if (more() && peek() == '?')
+                    {
+                        if (pos_ + 1u >= pattern_.size() || pattern_[pos_ + 1u] != ':')
+                            return false;
+                        capture = false;
+                        pos_ += 2u;
+                    }
+                    const std::uint32_t group = capture ? ++groups_ : 0u;
+                    std::uint32_t inner = 0;
+                    if (!parseAlternation(inner, depth + 1u) || !more() || peek() != ')')
+                        return false;
+                    ++pos_;
+                    if (!capture)
+                    {
+                        out = inner;
+                        return true;
+                    }
+                    Node node;
+                    node.kind = NodeKind::Capture;
+                    node.group = group;
+                    node.children.push_back(inner);
+                    out = add(std::move(node));
+                    return true;
+                }
+                case '[':
+                    return parseClass(out);
+                case '.':
+                {
+                    ++pos_;
+                    ByteSet set;
+                    set.Invert();
+                    set.Remove('\n');
+                    set.Remove('\r');
+                    out = addBytes(set);
+                    return true;
+                }
+                case '^':
+                    ++pos_;
+                    out = addKind(NodeKind::Begin);
+                    return true;
+                case '$':
+                    ++pos_;
+                    out = addKind(NodeKind::End);
+                    return true;
+                case '\\':
+                    return parseEscape(out);
+                case ')': case '*': case '+': case '?': case '{': case '}': case ']':
+                    return false;
+                default:
+                {
+                    ++pos_;
+                    ByteSet set;
+                    set.Add(static_cast<unsigned char>(ch));
+                    out = addBytes(set);
+                    return true;
+                }
+                }
+            }
+        };
+
+        enum class Op : std::uint8_t
+        {
+            Byte,
+            Class,
+            Split,
+            Jump,
+            Save,
+            Begin,
+            End,
+            WordBoundary,
+            NotWordBoundary,
+            Match
+        };
+
+        // Split prefers x over y; that order is what gives leftmost-first
+        // (ECMAScript) priority between alternatives and for lazy loops.
+        struct Inst
+        {
+            Op op = Op::Match;
+            unsigned char byte = 0;
+            std::uint32_t x = 0;
+            std::uint32_t y = 0;
+        };
+
+        struct Program
+        {
+            std::vector<Inst> insts;
+            std::vector<ByteSet> sets;
+            std::uint32_t groups = 0;
+            bool wordBoundaries = false;
+            // Every match has to begin where ^ holds.
+            bool anchoredStart = false;
+            // While no thread is live, searches skip to the next occurrence
+            // of the literal every match starts with, or else to the next
+            // byte a match can start with.
+            bool canSkip = false;
+            std::string prefix;
+            std::array<bool, 256> firstBytes{};
+            // Bytes no instruction tells apart share one DFA column.
+            std::array<std::uint8_t, 256> byteClass{};
+            std::uint32_t classCount = 1;
+
+            [[nodiscard]] bool Consumes(const Inst& inst, const unsigned char byte) const noexcept
+            {
+                return inst.op == Op::Byte ? inst.byte == byte : inst.op == Op::Class && sets[inst.x].Has(byte);
+            }
+        };
+
+        class Compiler
+        {
+        public:
+            Compiler(const std::vector<Node>& nodes, Program& program)
+                : nodes_(nodes), program_(program)
+            {
+            }
+
+            bool Compile(const std::uint32_t root)
+            {
+                push(Inst{Op::Save, 0, 0, 0});
+                if (!emit(root))
+                    return false;
+                push(Inst{Op::Save, 0, 1, 0});
+                push(Inst{Op::Match});
+                return program_.insts.size() <= maxProgramSize;
+            }
+
+        private:
+            const std::vector<Node>& nodes_;
+            Program& program_;
+
+            std::size_t push(const Inst inst)
+            {
+                program_.insts.push_back(inst);
+                return program_.insts.size() - 1u;
+            }
+
+            [[nodiscard]] std::uint32_t here() const noexcept
+            {
+                return static_cast<std::uint32_t>(program_.insts.size());
+            }
+
+            void setSplit(const std::size_t at, const std::uint32_t preferred, const std::uint32_t other)
+            {
+                program_.insts[at].x = preferred;
+                program_.insts[at].y = other;
+            }
+
+            bool emit(const std::uint32_t index)
+            {
+                if (program_.insts.size() > maxProgramSize)
+                    return false;
+
+                const Node& node = nodes_[index];
+                switch (node.kind)
+                {
+                case NodeKind::Empty:
+                    return true;
+                case NodeKind::Bytes:
+                    if (node.set.Count() == 1)
+                        push(Inst{Op::Byte, node.set.First()});
+                    else
+                    {
+                        program_.sets.push_back(node.set);
+                        push(Inst{Op::Class, 0, static_cast<std::uint32_t>(program_.sets.size() - 1u)});
+                    }
+                    return true;
+                case NodeKind::Concat:
+                    for (const auto child : node.children)
+                        if (!emit(child))
+                            return false;
+                    return true;
+                case NodeKind::Alternate:
+                {
+                    std::vector<std::size_t> exits;
+                    for (std::size_t i = 0; i < node.children.size(); ++i)
+                    {
+                        if (i + 1u == node.children.size())
+                        {
+                            if (!emit(node.children[i]))
+                                return false;
+                            break;
+                        }
+                        const auto split = push(Inst{Op::Split});
+                        if (!emit(node.children[i]))
+                            return false;
+                        exits.push_back(push(Inst{Op::Jump}));
+                        setSplit(split, static_cast<std::uint32_t>(split + 1u), here());
+                    }
+                    for (const auto exit : exits)
+                        program_.insts[exit].x = here();
+                    return true;
+                }
+                case NodeKind::Capture:
+                    push(Inst{Op::Save, 0, node.group * 2u});
+                    if (!emit(node.children.front()))
+                        return false;
+                    push(Inst{Op::Save, 0, node.group * 2u + 1u});
+                    return true;
+                case NodeKind::Repeat:
+                    return emitRepeat(node);
+                case NodeKind::Begin:
+                    push(Inst{Op::Begin});
+                    return true;
+                case NodeKind::End:
+                    push(Inst{Op::End});
+                    return true;
+                case NodeKind::WordBoundary:
+                    program_.wordBoundaries = true;
+                    push(Inst{Op::WordBoundary});
+                    return true;
+                case NodeKind::NotWordBoundary:
+                    program_.wordBoundaries = true;
+                    push(Inst{Op::NotWordBoundary});
+                    return true;
+                }
+                return false;
+            }
+
+            [[nodiscard]] bool nullable(const std::uint32_t index) const
+            {
+                const Node& node = nodes_[index];
+                switch (node.kind)
+                {
+                case NodeKind::Bytes:
+                    return false;
+                case NodeKind::Concat:
+                    return std::all_of(node.children.begin(), node.children.end(),
+                                       [this](const std::uint32_t child) { return nullable(child); });
+                case NodeKind::Alternate:
+                    return std::any_of(node.children.begin(), node.children.end(),
+                                       [this](const std::uint32_t child) { return nullable(child); });
+                case NodeKind::Repeat:
+                    return node.min == 0u || nullable(node.children.front());
+                case NodeKind::Capture:
+                    return nullable(node.children.front());
+                default:
+                    return true;
+                }
+            }
+
+            bool emitRepeat(const Node& node)
+            {
+                const std::uint32_t child = node.children.front();
+                if (node.max == unbounded)
+                {
+                    // A backtracking engine lets an unbounded loop take one
+                    // more empty iteration and keeps its captures; the VM
+                    // would drop that thread instead and could pick a
+                    // different match. Such loops stay with std::regex.
+                    if (nullable(child))
+                        return false;
+                    if (node.min > 0u)
+                    {
+                        // e{n,}: n - 1 copies, then e+.
+                        for (std::uint32_t i = 1; i < node.min; ++i)
+                            if (!emit(child))
+                                return false;
+                        const std::uint32_t loop = here();
+                        if (!emit(child))
+                            return false;
+                        const auto split = push(Inst{Op::Split});
+                        if (node.greedy)
+                            setSplit(split, loop, here());
+                        else
+                            setSplit(split, here(), loop);
+                        return true;
+                    }
+                    const auto split = push(Inst{Op::Split});
+                    if (!emit(child))
+                        return false;
+                    push(Inst{Op::Jump, 0, static_cast<std::uint32_t>(split)});
+                    if (node.greedy)
+                        setSplit(split, static_cast<std::uint32_t>(split + 1u), here());
+                    else
+                        setSplit(split, here(), static_cast<std::uint32_t>(split + 1u));
+                    return true;
+                }
+
+                for (std::uint32_t i = 0; i < node.min; ++i)
+                    if (!emit(child))
+                        return false;
+                // e{n,m}: the optional copies all exit to the same end, so a
+                // later copy only runs after the earlier ones matched.
+                std::vector<std::size_t> splits;
+                for (std::uint32_t i = node.min; i < node.max; ++i)
+                {
+                    splits.push_back(push(Inst{Op::Split}));
+                    if (!emit(child))
+                        return false;
+                }
+                for (const auto split : splits)
+                {
+                    if (node.greedy)
+                        setSplit(split, static_cast<std::uint32_t>(split + 1u), here());
+                    else
+                        setSplit(split, here(), static_cast<std::uint32_t>(split + 1u));
+                }
+                return true;
+            }
+        };
+
+        // Walks the epsilon closure of pc 0, letting through the assertions
+        // `passes` accepts; reports whether Match is reachable and collects
+        // the consuming instructions reached.
+        template <typename TPasses>
+        bool reachFromStart(const Program& program, TPasses&& passes, std::vector<std::uint32_t>& consumers)
+        {
+            std::vector<bool> seen(program.insts.size(), false);
+            std::vector<std::uint32_t> stack{0u};
+            bool match = false;
+            while (!stack.empty())
+            {
+                const auto pc = stack.back();
+                stack.pop_back();
+                if (seen[pc])
+                    continue;
+                seen[pc] = true;
+                const Inst& inst = program.insts[pc];
+                switch (inst.op)
+                {
+                case Op::Jump: stack.push_back(inst.x); break;
+                case Op::Split: stack.push_back(inst.y); stack.push_back(inst.x); break;
+                case Op::Save: stack.push_back(pc + 1u); break;
+                case Op::Begin: case Op::End: case Op::WordBoundary: case Op::NotWordBoundary:
+                    if (passes(inst.op))
+                        stack.push_back(pc + 1u);
+                    break;
+                case Op::Match: match = true; break;
+                default: consumers.push_back(pc); break;
+                }
+            }
+            return match;
+        }
+
+        std::string literalPrefix(const std::vector<Node>& nodes, const std::uint32_t root)
+        {
+            std::string prefix;
+            const auto literal = [&](const std::uint32_t index)
+            {
+                const Node& node = nodes[index];
+                if (node.kind != NodeKind::Bytes || node.set.Count() != 1)
+                    return false;
+                prefix.push_back(static_cast<char>(node.set.First()));
+                return true;
+            };
+            const Node& node = nodes[root];
+            if (node.kind == NodeKind::Concat)
+            {
+                for (const auto child : node.children)
+                    if (!literal(child))
+                        break;
+            }
+            else
+                literal(root);
+            return prefix;
+        }
+
+        void analyze(Program& program)
+        {
+            std::vector<std::uint32_t> consumers;
+            program.anchoredStart =
+                !reachFromStart(program, [](const Op op) { return op != Op::Begin; }, consumers) &&
+                consumers.empty();
+
+            consumers.clear();
+            program.canSkip = !reachFromStart(program, [](Op) { return true; }, consumers) && !consumers.empty();
+            for (const auto pc : consumers)
+                for (unsigned value = 0; value < 256u; ++value)
+                    if (program.Consumes(program.insts[pc], static_cast<unsigned char>(value)))
+                        program.firstBytes[value] = true;
+
+            std::array<bool, 257> boundary{};
+            for (const Inst& inst : program.insts)
+            {
+                if (inst.op == Op::Byte)
+                {
+                    boundary[inst.byte] = true;
+                    boundary[inst.byte + 1u] = true;
+                }
+                else if (inst.op == Op::Class)
+                {
+                    const ByteSet& set = program.sets[inst.x];
+                    for (unsigned value = 1; value < 256u; ++value)
+                        if (set.Has(static_cast<unsigned char>(value)) != set.Has(static_cast<unsigned char>(value - 1u)))
+                            boundary[value] = true;
+                }
+            }
+            std::uint32_t current = 0;
+            for (unsigned value = 0; value < 256u; ++value)
+            {
+                if (value > 0u && boundary[value])
+                    ++current;
+                program.byteClass[value] = static_cast<std::uint8_t>(current);
+            }
+            program.classCount = current + 1u;
+        }
+
+        bool buildProgram(const std::string_view source, const bool ignoreCase, Program& program)
+        {
+            std::vector<Node> nodes;
+            std::uint32_t root = 0;
+            if (!Parser(source, ignoreCase).Parse(nodes, root, program.groups))
+                return false;
+            if (!Compiler(nodes, program).Compile(root))
+                return false;
+            if (!ignoreCase)
+                program.prefix = literalPrefix(nodes, root);
+            analyze(program);
+            return true;
+        }
+
+        std::size_t nextCandidate(const Program& program, const std::string_view input, std::size_t pos) noexcept
+        {
+            if (!program.prefix.empty())
+            {
+                const auto found = input.find(program.prefix, pos);
+                return found == std::string_view::npos ? unset : found;
+            }
+            for (; pos < input.size(); ++pos)
+                if (program.firstBytes[static_cast<unsigned char>(input[pos])])
+                    return pos;
+            return unset;
+        }
+
+        struct SearchFlags
+        {
+            // The byte before `start` belongs to the input (std::regex's
+            // match_prev_avail); without it `start` acts as the beginning.
+            bool prevAvail = false;
+            bool notNull = false;
+            bool continuous = false;
+        };
+
+        struct SearchContext
+        {
+            std::string_view input;
+            std::size_t start;
+            SearchFlags flags;
+
+            [[nodiscard]] bool AtBegin(const std::size_t pos) const noexcept
+            {
+                return pos == 0u || (pos == start && !flags.prevAvail);
+            }
+
+            [[nodiscard]] bool Holds(const Op op, const std::size_t pos) const noexcept
+            {
+                switch (op)
+                {
+                case Op::Begin:
+                    return AtBegin(pos);
+                case Op::End:
+                    return pos == input.size();
+                default:
+                {
+                    const bool before = !AtBegin(pos) && isWordByte(static_cast<unsigned char>(input[pos - 1u]));
+                    const bool after = pos < input.size() && isWordByte(static_cast<unsigned char>(input[pos]));
+                    return (before != after) == (op == Op::WordBoundary);
+                }
+                }
+            }
+        };
+
+        class SparseSet
+        {
+        public:
+            void Resize(const std::size_t capacity)
+            {
+                dense_.assign(capacity, 0u);
+                sparse_.assign(capacity, 0u);
+                size_ = 0;
+            }
+
+            [[nodiscard]] bool Contains(const std::uint32_t value) const noexcept
+            {
+                const auto slot = sparse_[value];
+                return slot < size_ && dense_[slot] == value;
+            }
+
+            void Insert(const std::uint32_t value) noexcept
+            {
+                dense_[size_] = value;
+                sparse_[value] = size_;
+                ++size_;
+            }
+
+            void Clear() noexcept { size_ = 0; }
+            [[nodiscard]] std::uint32_t Size() const noexcept { return size_; }
+            [[nodiscard]] std::uint32_t operator[](const std::uint32_t index) const noexcept { return dense_[index]; }
+
+        private:
+            std::vector<std::uint32_t> dense_;
+            std::vector<std::uint32_t> sparse_;
+            std::uint32_t size_ = 0;
+        };
+
+        // Pike VM: simulates the program over the input in one pass, one
+        // thread per instruction, threads kept in priority order. Time is
+        // O(input x program) whatever the pattern.
+        class PikeVm
+        {
+        public:
+            PikeVm(const Program& program, const std::size_t slotCount)
+                : program_(program), slotCount_(slotCount), scratch_(slotCount, unset)
+            {
+                for (auto* threads : {&current_, &next_})
+                {
+                    threads->set.Resize(program.insts.size());
+                    threads->slots.assign(program.insts.size() * slotCount, unset);
+                }
+            }
+
+            bool Search(const SearchContext& context, std::vector<std::size_t>& slots, const bool earliest)
+            {
+                const std::size_t start = context.start;
+                if (program_.anchoredStart && !context.AtBegin(start))
+                    return false;
+                const bool anchored = context.flags.continuous || program_.anchoredStart;
+                const std::size_t size = context.input.size();
+
+                current_.set.Clear();
+                bool matched = false;
+                for (std::size_t pos = start;; ++pos)
+                {
+                    if (!matched && (pos == start || !anchored))
+                    {
+                        if (current_.set.Size() == 0u && !anchored && program_.canSkip)
+                        {
+                            pos = nextCandidate(program_, context.input, pos);
+                            if (pos == unset)
+                                return false;
+                        }
+                        std::fill(scratch_.begin(), scratch_.end(), unset);
+                        add(current_, 0u, pos, context);
+                    }
+                    if (current_.set.Size() == 0u)
+                        break;
+
+                    next_.set.Clear();
+                    const bool hasByte = pos < size;
+                    const auto byte = hasByte ? static_cast<unsigned char>(context.input[pos]) : 0u;
+                    for (std::uint32_t i = 0; i < current_.set.Size(); ++i)
+                    {
+                        const std::uint32_t pc = current_.set[i];
+                        const Inst& inst = program_.insts[pc];
+                        const std::size_t* threadSlots = current_.slots.data() + pc * slotCount_;
+                        if (inst.op == Op::Match)
+                        {
+                            if (context.flags.notNull && pos == start)
+                                continue;
+                            slots.assign(threadSlots, threadSlots + slotCount_);
+                            matched = true;
+                            if (earliest)
+                                return true;
+                            // Lower-priority threads lose to this match.
+                            break;
+                        }
+                        if (!hasByte || !program_.Consumes(inst, static_cast<unsigned char>(byte)))
+                            continue;
+                        std::copy_n(threadSlots, slotCount_, scratch_.begin());
+                        add(next_, pc + 1u, pos + 1u, context);
+                    }
+                    std::swap(current_, next_);
+                    if (!hasByte)
+                        break;
+                }
+                return matched;
+            }
+
+        private:
+            struct Threads
+            {
+                SparseSet set;
+                std::vector<std::size_t> slots;
+            };
+
+            // Either an instruction to explore or a capture slot to restore
+            // once the branch that overwrote it has been explored.
+            struct Frame
+            {
+                std::uint32_t pc;
+                std::uint32_t slot;
+                std::size_t value;
+                bool restore;
+            };
+
+            const Program& program_;
+            std::size_t slotCount_;
+            Threads current_;
+            Threads next_;
+            std::vector<Frame> stack_;
+            std::vector<std::size_t> scratch_;
+
+            void add(Threads& threads, const std::uint32_t first, const std::size_t pos, const SearchContext& context)
+            {
+                stack_.push_back(Frame{first, 0u, 0u, false});
+                while (!stack_.empty())
+                {
+                    const Frame frame = stack_.back();
+                    stack_.pop_back();
+                    if (frame.restore)
+                    {
+                        scratch_[frame.slot] = frame.value;
+                        continue;
+                    }
+
+                    std::uint32_t pc = frame.pc;
+                    while (!threads.set.Contains(pc))
+                    {
+                        threads.set.Insert(pc);
+                        const Inst& inst = program_.insts[pc];
+                        bool follow = true;
+                        switch (inst.op)
+                        {
+                        case Op::Jump:
+                            pc = inst.x;
+                            break;
+                        case Op::Split:
+                            stack_.push_back(Frame{inst.y, 0u, 0u, false});
+                            pc = inst.x;
+                            break;
+                        case Op::Save:
+                            if (inst.x < slotCount_)
+                            {
+                                stack_.push_back(Frame{0u, inst.x, scratch_[inst.x], true});
+                                scratch_[inst.x] = pos;
+                            }
+                            ++pc;
+                            break;
+                        case Op::Begin: case Op::End: case Op::WordBoundary: case Op::NotWordBoundary:
+                            follow = context.Holds(inst.op, pos);
+                            ++pc;
+                            break;
+                        default:
+                            std::copy_n(scratch_.begin(), slotCount_, threads.slots.begin() + pc * slotCount_);
+                            follow = false;
+                            break;
+                        }
+                        if (!follow)
+                            break;
+                    }
+                }
+            }
+        };
+
+        // Lazily built DFA over sets of program counters. It answers "is
+        // there a match" for unanchored searches without tracking captures
+        // and is used as the IsMatch engine and as a prefilter before the
+        // Pike VM. Patterns with \b or \B need the next byte to resolve the
+        // assertion and stay on the Pike VM.
+        class LazyDfa
+        {
+        public:
+            enum class Outcome : std::uint8_t
+            {
+                NoMatch,
+                Match,
+                GaveUp
+            };
+
+            explicit LazyDfa(const Program& program)
+                : program_(program), mark_(program.insts.size(), 0u)
+            {
+                seeds_.assign(1u, 0u);
+                closure(false, false, restart_);
+                seeds_.assign(1u, 0u);
+                closure(true, false, pcs_);
+                beginState_ = intern(pcs_);
+                pcs_ = restart_;
+                restartState_ = intern(pcs_);
+            }
+
+            Outcome Scan(const std::string_view input, const std::size_t start, const bool beginContext)
+            {
+                std::int32_t state = beginContext ? beginState_ : restartState_;
+                if (state < 0)
+                    return Outcome::GaveUp;
+                const std::size_t size = input.size();
+                const auto* bytes = reinterpret_cast<const unsigned char*>(input.data());
+                std::size_t pos = start;
+                while (true)
+                {
+                    if (accepting_[static_cast<std::size_t>(state)])
+                        return Outcome::Match;
+                    if (states_[static_cast<std::size_t>(state)].empty())
+                        return Outcome::NoMatch;
+                    if (pos == size)
+                        break;
+                    if (state == restartState_ && program_.canSkip)
+                    {
+                        pos = nextCandidate(program_, input, pos);
+                        if (pos == unset)
+                            return Outcome::NoMatch;
+                    }
+                    const unsigned char byte = bytes[pos];
+                    std::int32_t next = table_[static_cast<std::size_t>(state) * program_.classCount +
+                                               program_.byteClass[byte]];
+                    if (next < 0)
+                    {
+                        next = transition(state, byte);
+                        if (next < 0)
+                            return Outcome::GaveUp;
+                    }
+                    state = next;
+                    ++pos;
+                }
+                return acceptsAtEnd(state, size == start && beginContext) ? Outcome::Match : Outcome::NoMatch;
+            }
+
+        private:
+            const Program& program_;
+            std::vector<std::vector<std::uint32_t>> states_;
+            std::vector<std::uint8_t> accepting_;
+            std::vector<std::int32_t> table_;
+            std::unordered_map<std::string, std::int32_t> index_;
+            std::vector<std::uint32_t> restart_;
+            std::int32_t beginState_ = -1;
+            std::int32_t restartState_ = -1;
+            std::vector<std::uint32_t> mark_;
+            std::uint32_t generation_ = 0;
+            std::vector<std::uint32_t> stack_;
+            std::vector<std::uint32_t> seeds_;
+            std::vector<std::uint32_t> pcs_;
+
+            // Closure of seeds_ into `out`: consuming instructions, Match,
+            // and $ assertions still waiting for the end of input.
+            void closure(const bool atBegin, const bool atEnd, std::vector<std::uint32_t>& out)
+            {
+                ++generation_;
+                out.clear();
+                stack_.assign(seeds_.rbegin(), seeds_.rend());
+                while (!stack_.empty())
+                {
+                    const auto pc = stack_.back();
+                    stack_.pop_back();
+                    if (mark_[pc] == generation_)
+                        continue;
+                    mark_[pc] = generation_;
+                    const Inst& inst = program_.insts[pc];
+                    switch (inst.op)
+                    {
+                    case Op::Jump: stack_.push_back(inst.x); break;
+                    case Op::Split: stack_.push_back(inst.y); stack_.push_back(inst.x); break;
+                    case Op::Save: stack_.push_back(pc + 1u); break;
+                    case Op::Begin:
+                        if (atBegin)
+                            stack_.push_back(pc + 1u);
+                        break;
+                    case Op::End:
+                        if (atEnd)
+                            stack_.push_back(pc + 1u);
+                        else
+                            out.push_back(pc);
+                        break;
+                    default:
+                        out.push_back(pc);
+                        break;
+                    }
+                }
+            }
+
+            std::int32_t intern(std::vector<std::uint32_t>& pcs)
+            {
+                std::sort(pcs.begin(), pcs.end());
+                pcs.erase(std::unique(pcs.begin(), pcs.end()), pcs.end());
+                std::string key(reinterpret_cast<const char*>(pcs.data()), pcs.size() * sizeof(std::uint32_t));
+                if (const auto found = index_.find(key); found != index_.end())
+                    return found->second;
+                if (states_.size() >= maxDfaStates)
+                    return -1;
+
+                const auto state = static_cast<std::int32_t>(states_.size());
+                const bool accepting = std::any_of(pcs.begin(), pcs.end(), [this](const std::uint32_t pc)
+                {
+                    return program_.insts[pc].op == Op::Match;
+                });
+                states_.push_back(pcs);
+                accepting_.push_back(accepting ? 1u : 0u);
+                table_.resize(table_.size() + program_.classCount, -1);
+                index_.emplace(std::move(key), state);
+                return state;
+            }
+
+            std::int32_t transition(const std::int32_t state, const unsigned char byte)
+            {
+                seeds_.clear();
+                for (const auto pc : states_[static_cast<std::size_t>(state)])
+                    if (program_.Consumes(program_.insts[pc], byte))
+                        seeds_.push_back(pc + 1u);
+                closure(false, false, pcs_);
+                pcs_.insert(pcs_.end(), restart_.begin(), restart_.end());
+                const std::int32_t next = intern(pcs_);
+                if (next >= 0)
+                    table_[static_cast<std::size_t>(state) * program_.classCount + program_.byteClass[byte]] = next;
+                return next;
+            }
+
+            bool acceptsAtEnd(const std::int32_t state, const bool atBegin)
+            {
+                seeds_.clear();
+                for (const auto pc : states_[static_cast<std::size_t>(state)])
+                    if (program_.insts[pc].op == Op::End)
+                        seeds_.push_back(pc + 1u);
+                if (seeds_.empty())
+                    return false;
+                closure(atBegin, true, pcs_);
+                return std::any_of(pcs_.begin(), pcs_.end(), [this](const std::uint32_t pc)
+                {
+                    return program_.insts[pc].op == Op::Match;
+                });
+            }
+        };
+
+        // A compiled pattern: the automaton program when the pattern is in
+        // its syntax, otherwise a std::regex. Immutable once built, so the
+        // cache and compiled handles share it across threads.
+        class Pattern
+        {
+        public:
+            static std::shared_ptr<const Pattern> Compile(const std::string_view source, const bool ignoreCase)
+            {
+                auto pattern = std::make_shared<Pattern>();
+                if (buildProgram(source, ignoreCase, pattern->program_))
+                {
+                    pattern->groups_ = pattern->program_.groups;
+                    return pattern;
+                }
+
+                auto flags = std::regex_constants::ECMAScript;
+                if (ignoreCase)
+                    flags |= std::regex_constants::icase;
+                pattern->fallback_.emplace(std::string(source), flags);
+                pattern->groups_ = pattern->fallback_->mark_count();
+                return pattern;
+            }
+
+            [[nodiscard]] bool Linear() const noexcept { return !fallback_.has_value(); }
+            [[nodiscard]] std::size_t Groups() const noexcept { return groups_; }
+            [[nodiscard]] const Program& Automaton() const noexcept { return program_; }
+            [[nodiscard]] const std::regex& Fallback() const noexcept { return *fallback_; }
+
+            // The DFA cache is mutable, so one search holds it at a time; a
+            // concurrent search on the same pattern builds its own.
+            [[nodiscard]] std::unique_ptr<LazyDfa> AcquireDfa() const
+            {
+                {
+                    std::lock_guard lock(dfaMutex_);
+                    if (dfa_)
+                        return std::move(dfa_);
+                }
+                return std::make_unique<LazyDfa>(program_);
+            }
+
+            void ReleaseDfa(std::unique_ptr<LazyDfa> dfa) const noexcept
+            {
+                std::lock_guard lock(dfaMutex_);
+                if (!dfa_)
+                    dfa_ = std::move(dfa);
+            }
+
+        private:
+            Program program_;
+            std::optional<std::regex> fallback_;
+            std::size_t groups_ = 0;
+            mutable std::mutex dfaMutex_;
+            mutable std::unique_ptr<LazyDfa> dfa_;
+        };
+
+        // Per-call search state over one pattern, reused across the matches
+        // of FindAll/Replace/Split.
+        class Matcher
+        {
+        public:
+            Matcher(const Pattern& pattern, const bool wantGroups)
+                : pattern_(pattern), slots_(wantGroups ? (pattern.Groups() + 1u) * 2u : 2u, unset)
+            {
+                if (pattern.Linear())
+                    vm_.emplace(pattern.Automaton(), slots_.size());
+            }
+
+            ~Matcher()
+            {
+                if (dfa_)
+                    pattern_.ReleaseDfa(std::move(dfa_));
+            }
+
+            Matcher(const Matcher&) = delete;
+            Matcher& operator=(const Matcher&) = delete;
+
+            bool Test(const std::string_view input)
+            {
+                if (!pattern_.Linear())
+                    return Search(input, 0u, SearchFlags{});
+                const auto outcome = scan(input, 0u, SearchFlags{});
+                if (outcome != LazyDfa::Outcome::GaveUp)
+                    return outcome == LazyDfa::Outcome::Match;
+                return vm_->Search(SearchContext{input, 0u, SearchFlags{}}, slots_, true);
+            }
+
+            bool Search(const std::string_view input, const std::size_t start, const SearchFlags& flags)
+            {
+                if (!pattern_.Linear())
+                    return searchFallback(input, start, flags);
+                if (scan(input, start, flags) == LazyDfa::Outcome::NoMatch)
+                    return false;
+                return vm_->Search(SearchContext{input, start, flags}, slots_, false);
+            }
+
+            [[nodiscard]] std::size_t Groups() const noexcept { return pattern_.Groups(); }
+            [[nodiscard]] std::size_t Begin(const std::size_t group) const noexcept { return slot(group * 2u); }
+            [[nodiscard]] std::size_t End(const std::size_t group) const noexcept { return slot(group * 2u + 1u); }
+
+            [[nodiscard]] std::string_view Group(const std::string_view input, const std::size_t group) const noexcept
+            {
+                const auto begin = Begin(group);
+                const auto end = End(group);
+                if (begin == unset || end == unset)
+                    return {};
+                return input.substr(begin, end - begin);
+            }
+
+        private:
+            const Pattern& pattern_;
+            std::vector<std::size_t> slots_;
+            std::optional<PikeVm> vm_;
+            std::unique_ptr<LazyDfa> dfa_;
+
+            [[nodiscard]] std::size_t slot(const std::size_t index) const noexcept
+            {
+                return index < slots_.size() ? slots_[index] : unset;
+            }
+
+            LazyDfa::Outcome scan(const std::string_view input, const std::size_t start, const SearchFlags& flags)
+            {
+                if (flags.continuous || pattern_.Automaton().wordBoundaries)
+                    return LazyDfa::Outcome::GaveUp;
+                if (!dfa_)
+                    dfa_ = pattern_.AcquireDfa();
+                return dfa_->Scan(input, start, start == 0u || !flags.prevAvail);
+            }
+
+            bool searchFallback(const std::string_view input, const std::size_t start, const SearchFlags& flags)
+            {
+                auto matchFlags = std::regex_constants::match_default;
+                if (flags.prevAvail)
+                    matchFlags |= std::regex_constants::match_prev_avail;
+                if (flags.notNull)
+                    matchFlags |= std::regex_constants::match_not_null;
+                if (flags.continuous)
+                    matchFlags |= std::regex_constants::match_continuous;
+
+                const char* base = input.data() ? input.data() : "";
+                std::cmatch match;
+                if (!std::regex_search(base + start, base + input.size(), match, pattern_.Fallback(), matchFlags))
+                    return false;
+                for (std::size_t group = 0; group * 2u < slots_.size(); ++group)
+                {
+                    const bool matched = group < match.size() && match[group].matched;
+                    slots_[group * 2u] = matched ? static_cast<std::size_t>(match[group].first - base) : unset;
+                    slots_[group * 2u + 1u] = matched ? static_cast<std::size_t>(match[group].second - base) : unset;
+                }
+                return true;
+            }
+        };
+
+        // Successive matches the way std::regex_iterator produces them: after
+        // an empty match the next one must be non-empty at the same position
+        // or start one byte later.
+        template <typename TVisit>
+        void forEachMatch(Matcher& matcher, const std::string_view input, TVisit&& visit)
+        {
+            SearchFlags flags;
+            if (!matcher.Search(input, 0u, flags))
+                return;
+            while (true)
+            {
+                visit();
+                std::size_t start = matcher.End(0);
+                if (matcher.Begin(0) == start)
+                {
+                    if (start == input.size())
+                        return;
+                    SearchFlags retry = flags;
+                    retry.notNull = true;
+                    retry.continuous = true;
+                    if (matcher.Search(input, start, retry))
+                        continue;
+                    ++start;
+                }
+                flags.prevAvail = true;
+                if (!matcher.Search(input, start, flags))
+                    return;
+            }
+        }
+
+        // ECMAScript replacement format, as std::regex_replace expands it:
+        // $$, $&, $`, $', $n and $nn.
+        void appendFormat(std::string& output, const std::string_view format, const std::string_view input,
+                          const Matcher& matcher, const std::size_t prefixBegin)
         {
-            auto flags = std::regex_constants::ECMAScript;
-            if (ignoreCase)
-                flags |= std::regex_constants::icase;
-            return std::regex(std::string(pattern), flags);
+            std::size_t cursor = 0;
+            while (true)
+            {
+                const auto dollar = format.find('$', cursor);
+                if (dollar == std::string_view::npos)
+                    break;
+                output.append(format.substr(cursor, dollar - cursor));
+                std::size_t next = dollar + 1u;
+                if (next == format.size())
+                    output.push_back('$');
+                else if (format[next] == '$')
+                {
+                    output.push_back('$');
+                    ++next;
+                }
+                else if (format[next] == '&')
+                {
+                    output.append(matcher.Group(input, 0));
+                    ++next;
+                }
+                else if (format[next] == '`')
+                {
+                    output.append(input.substr(prefixBegin, matcher.Begin(0) - prefixBegin));
+                    ++next;
+                }
+                else if (format[next] == '\'')
+                {
+                    output.append(input.substr(matcher.End(0)));
+                    ++next;
+                }
+                else if (format[next] >= '0' && format[next] <= '9')
+                {
+                    std::size_t group = static_cast<std::size_t>(format[next] - '0');
+                    ++next;
+                    if (next < format.size() && format[next] >= '0' && format[next] <= '9')
+                    {
+                        group = group * 10u + static_cast<std::size_t>(format[next] - '0');
+                        ++next;
+                    }
+                    if (group <= matcher.Groups())
+                        output.append(matcher.Group(input, group));
+                }
+                else
+                    output.push_back('$');
+                cursor = next;
+            }
+            output.append(format.substr(cursor));
+        }
+
+        void runIsMatch(const Pattern& pattern, const std::string_view input, bool& matched)
+        {
+            Matcher matcher(pattern, false);
+            matched = matcher.Test(input);
+        }
+
+        void runFind(const Pattern& pattern, const std::string_view input, bool& found, std::size_t& index,
+                     std::size_t& length, std::string& value, std::vector<std::string>& groups)
+        {
+            Matcher matcher(pattern, true);
+            found = matcher.Search(input, 0u, SearchFlags{});
+            if (!found)
+                return;
+            index = matcher.Begin(0);
+            length = matcher.End(0) - index;
+            value.assign(matcher.Group(input, 0));
+            groups.reserve(matcher.Groups());
+            for (std::size_t group = 1; group <= matcher.Groups(); ++group)
+                groups.emplace_back(matcher.Group(input, group));
+        }
+
+        void runFindAll(const Pattern& pattern, const std::string_view input, std::vector<std::string>& matches)
+        {
+            Matcher matcher(pattern, false);
+            forEachMatch(matcher, input, [&] { matches.emplace_back(matcher.Group(input, 0)); });
         }
 
+        void runReplace(const Pattern& pattern, const std::string_view input, const std::string_view replacement,
+                        std::string& output)
+        {
+            Matcher matcher(pattern, replacement.find('$') != std::string_view::npos);
+            std::size_t cursor = 0;
+            forEachMatch(matcher, input, [&]
+            {
+                output.append(input.substr(cursor, matcher.Begin(0) - cursor));
+                appendFormat(output, replacement, input, matcher, cursor);
+                cursor = matcher.End(0);
+            });
+            output.append(input.substr(cursor));
+        }
+
+        // Mirrors std::regex_token_iterator with submatch -1: the text
+        // before each match, then the rest of the input when non-empty, or
+        // the whole input when nothing matched.
+        void runSplit(const Pattern& pattern, const std::string_view input, std::vector<std::string>& output)
+        {
+            Matcher matcher(pattern, false);
+            std::size_t cursor = 0;
+            bool any = false;
+            forEachMatch(matcher, input, [&]
+            {
+                output.emplace_back(input.substr(cursor, matcher.Begin(0) - cursor));
+                cursor = matcher.End(0);
+                any = true;
+            });
+            if (!any)
+                output.emplace_back(input);
+            else if (cursor < input.size())
+                output.emplace_back(input.substr(cursor));
+        }
+
+        class PatternCache
+        {
+        public:
+            std::shared_ptr<const Pattern> Get(const std::string_view source, const bool ignoreCase)
+            {
+                thread_local std::string key;
+                key.assign(1u, ignoreCase ? 'i' : 'c');
+                key.append(source);
+                {
+                    std::lock_guard lock(mutex_);
+                    if (auto cached = lookup(key))
+                        return cached;
+                }
+
+                // Compile outside the lock; invalid patterns throw here and
+                // are not cached.
+                auto compiled = Pattern::Compile(source, ignoreCase);
+                std::lock_guard lock(mutex_);
+                if (auto cached = lookup(key))
+                    return cached;
+                entries_.emplace_front(key, compiled);
+                index_.emplace(key, entries_.begin());
+                if (entries_.size() > patternCacheCapacity)
+                {
+                    index_.erase(entries_.back().first);
+                    entries_.pop_back();
+                }
+                return compiled;
+            }
+
+            std::size_t Size()
+            {
+                std::lock_guard lock(mutex_);
+                return entries_.size();
+            }
+
+            void Clear()
+            {
+                std::lock_guard lock(mutex_);
+                index_.clear();
+                entries_.clear();
+            }
+
+        private:
+            using Entry = std::pair<std::string, std::shared_ptr<const Pattern>>;
+
+            struct KeyHash
+            {
+                using is_transparent = void;
+                std::size_t operator()(const std::string_view value) const noexcept
+                {
+                    return std::hash<std::string_view>{}(value);
+                }
+            };
+
+            std::mutex mutex_;
+            std::list<Entry> entries_;
+            std::unordered_map<std::string, std::list<Entry>::iterator, KeyHash, std::equal_to<>> index_;
+
+            std::shared_ptr<const Pattern> lookup(const std::string_view key)
+            {
+                const auto found = index_.find(key);
+                if (found == index_.end())
+                    return nullptr;
+                entries_.splice(entries_.begin(), entries_, found->second);
+                return found->second->second;
+            }
+        };
+
+        PatternCache& patternCache()
+        {
+            static PatternCache cache;
+            return cache;
+        }
+
+        struct CompiledRegex
+        {
+            std::shared_ptr<const Pattern> pattern;
+            RegexError error = RegexError::none;
+            std::string message;
+        };
+
         template <typename TAction>
         bool guarded(TAction&& action, RegexError& error, std::string& message) noexcept
         {
@@ -74,6 +1712,73 @@ namespace wio::runtime::std_regex
                 return false;
             }
         }
+
+        template <typename TAction>
+        bool guardedCompiled(void* handle, TAction&& action, RegexError& error, std::string& message) noexcept
+        {
+            const auto* compiled = static_cast<const CompiledRegex*>(handle);
+            if (compiled && compiled->pattern)
+                return guarded([&] { action(*compiled->pattern); }, error, message);
+            error = compiled ? compiled->error : RegexError::runtime_error;
+            try
+            {
+                message = compiled ? compiled->message : "regular expression handle is not initialized";
+            }
+            catch (...)
+            {
+                message.clear();
+            }
+            return false;
+        }
+
+        template <typename TAction>
+        bool guardedPattern(const std::string_view pattern, const bool ignoreCase, TAction&& action,
+                            RegexError& error, std::string& message) noexcept
+        {
+            return guarded([&] { action(*patternCache().Get(pattern, ignoreCase)); }, error, message);
+        }
+    }
+
+    bool PatternLooksSafe(const std::string_view pattern) noexcept
+    {
+        if (pattern.size() > 4096u) return false;
+        try
+        {
+            // The automaton runs in linear time whatever the pattern's shape;
+            // only patterns left to std::regex need the heuristic below.
+            Program program;
+            if (buildProgram(pattern, false, program)) return true;
+        }
+        catch (...)
+        {
+        }
+
+        bool escaped = false;
+        bool previousQuantifier = false;
+        int groupDepth = 0;
+        std::vector<bool> groupHasQuantifier;
+        for (const char ch : pattern)
+        {
+            if (escaped) { escaped = false; previousQuantifier = false; continue; }
+            if (ch == '\\') { escaped = true; continue; }
+            if (ch == '(') { ++groupDepth; groupHasQuantifier.push_back(false); previousQuantifier = false; continue; }
+            if (ch == ')') { if (groupDepth > 0) --groupDepth; previousQuantifier = false; continue; }
+            const bool quantifier = ch == '*' || ch == '+' || ch == '?';
+            if (quantifier)
+            {
+                if (previousQuantifier) return false;
+                if (!groupHasQuantifier.empty()) groupHasQuantifier.back() = true;
+            }
+            if (quantifier && !groupHasQuantifier.empty() && groupHasQuantifier.back() && ch == '+')
+            {
+                // Conservative rejection of common nested/repeated forms.
+                const auto close = pattern.find(')');
+                if (close != std::string_view::npos && close + 1 < pattern.size() &&
+                    (pattern[close + 1] == '+' || pattern[close + 1] == '*')) return false;
+            }
+            previousQuantifier = quantifier;
+        }
+        return !escaped && groupDepth == 0;
     }
 
     const char* ToString(const RegexError error) noexcept
@@ -101,10 +1806,9 @@ namespace wio::runtime::std_regex
         std::string& message) noexcept
     {
         matched = false;
-        return guarded([&]
+        return guardedPattern(pattern, ignoreCase, [&](const Pattern& compiled)
         {
-            const auto expression = compile(pattern, ignoreCase);
-            matched = std::regex_search(input.begin(), input.end(), expression);
+            runIsMatch(compiled, input, matched);
         }, error, message);
     }
 
@@ -125,20 +1829,9 @@ namespace wio::runtime::std_regex
         length = 0u;
         value.clear();
         groups.clear();
-        return guarded([&]
+        return guardedPattern(pattern, ignoreCase, [&](const Pattern& compiled)
         {
-            const auto expression = compile(pattern, ignoreCase);
-            std::match_results<std::string_view::const_iterator> match;
-            found = std::regex_search(input.begin(), input.end(), match, expression);
-            if (!found)
-                return;
-
-            index = static_cast<std::size_t>(match.position());
-            length = static_cast<std::size_t>(match.length());
-            value = match.str();
-            groups.reserve(match.size() > 0u ? match.size() - 1u : 0u);
-            for (std::size_t i = 1u; i < match.size(); ++i)
-                groups.push_back(match[i].matched ? match[i].str() : std::string{});
+            runFind(compiled, input, found, index, length, value, groups);
         }, error, message);
     }
 
@@ -151,13 +1844,9 @@ namespace wio::runtime::std_regex
         std::string& message) noexcept
     {
         matches.clear();
-        return guarded([&]
+        return guardedPattern(pattern, ignoreCase, [&](const Pattern& compiled)
         {
-            const auto expression = compile(pattern, ignoreCase);
-            const std::regex_iterator begin(input.begin(), input.end(), expression);
-            const std::regex_iterator<std::string_view::const_iterator> end;
-            for (auto it = begin; it != end; ++it)
-                matches.push_back(it->str());
+            runFindAll(compiled, input, matches);
         }, error, message);
     }
 
@@ -171,13 +1860,9 @@ namespace wio::runtime::std_regex
         std::string& message) noexcept
     {
         output.clear();
-        return guarded([&]
+        return guardedPattern(pattern, ignoreCase, [&](const Pattern& compiled)
         {
-            const auto expression = compile(pattern, ignoreCase);
-            output = std::regex_replace(
-                std::string(input),
-                expression,
-                std::string(replacement));
+            runReplace(compiled, input, replacement, output);
         }, error, message);
     }
 
@@ -190,20 +1875,139 @@ namespace wio::runtime::std_regex
         std::string& message) noexcept
     {
         output.clear();
-        return guarded([&]
-        {
-            const auto expression = compile(pattern, ignoreCase);
-            const std::cregex_token_iterator begin(
-                input.data(),
-                input.data() + input.size(),
-                expression,
-                -1);
-            const std::cregex_token_iterator end;
-            for (auto it = begin; it != end; ++it)
-                output.push_back(it->str());
+        return guardedPattern(pattern, ignoreCase, [&](const Pattern& compiled)
+        {
+            runSplit(compiled, input, output);
+        }, error, message);
+    }
+
+    void* Compile(const std::string_view pattern, const bool ignoreCase)
+    {
+        auto compiled = std::make_unique<CompiledRegex>();
+        auto* target = compiled.get();
+        (void)guarded([&] { target->pattern = patternCache().Get(pattern, ignoreCase); },
+                      target->error, target->message);
+        return compiled.release();
+    }
+
+    void Release(void* handle) noexcept
+    {
+        delete static_cast<CompiledRegex*>(handle);
+    }
+
+    bool TryValidate(void* handle, RegexError& error, std::string& message) noexcept
+    {
+        return guardedCompiled(handle, [](const Pattern&) {}, error, message);
+    }
+
+    bool UsesLinearEngine(void* handle) noexcept
+    {
+        const auto* compiled = static_cast<const CompiledRegex*>(handle);
+        return compiled && compiled->pattern && compiled->pattern->Linear();
+    }
+
+    bool TryIsMatchCompiled(
+        void* handle,
+        const std::string_view input,
+        bool& matched,
+        RegexError& error,
+        std::string& message) noexcept
+    {
+        matched = false;
+        return guardedCompiled(handle, [&](const Pattern& compiled)
+        {
+            runIsMatch(compiled, input, matched);
+        }, error, message);
+    }
+
+    bool TryFindCompiled(
+        void* handle,
+        const std::string_view input,
+        bool& found,
+        std::size_t& index,
+        std::size_t& length,
+        std::string& value,
+        std::vector<std::string>& groups,
+        RegexError& error,
+        std::string& message) noexcept
+    {
+        found = false;
+        index = 0u;
+        length = 0u;
+        value.clear();
+        groups.clear();
+        return guardedCompiled(handle, [&](const Pattern& compiled)
+        {
+            runFind(compiled, input, found, index, length, value, groups);
+        }, error, message);
+    }
+
+    bool TryFindAllCompiled(
+        void* handle,
+        const std::string_view input,
+        std::vector<std::string>& matches,
+        RegexError& error,
+        std::string& message) noexcept
+    {
+        matches.clear();
+        return guardedCompiled(handle, [&](const Pattern& compiled)
+        {
+            runFindAll(compiled, input, matches);
+        }, error, message);
+    }
+
+    bool TryReplaceCompiled(
+        void* handle,
+        const std::string_view input,
+        const std::string_view replacement,
+        std::string& output,
+        RegexError& error,
+        std::string& message) noexcept
+    {
+        output.clear();
+        return guardedCompiled(handle, [&](const Pattern& compiled)
+        {
+            runReplace(compiled, input, replacement, output);
+        }, error, message);
+    }
+
+    bool TrySplitCompiled(
+        void* handle,
+        const std::string_view input,
+        std::vector<std::string>& output,
+        RegexError& error,
+        std::string& message) noexcept
+    {
+        output.clear();
+        return guardedCompiled(handle, [&](const Pattern& compiled)
+        {
+            runSplit(compiled, input, output);
         }, error, message);
     }
 
+    std::size_t CachedPatternCount() noexcept
+    {
+        try
+        {
+            return patternCache().Size();
+        }
+        catch (...)
+        {
+            return 0u;
+        }
+    }
+
+    void ClearPatternCache() noexcept
+    {
+        try
+        {
+            patternCache().Clear();
+        }
+        catch (...)
+        {
+        }
+    }
+
     std::string Escape(const std::string_view value)
     {
         static constexpr std::string_view metacharacters = R"(\.^$|()[]{}*+?)";
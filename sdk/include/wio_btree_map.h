@@ -0,0 +1,854 @@
+#pragma once
+
+// B+-tree behind Wio `Tree<K, V>`.
+//
+// Entries live only in leaves, packed in key order in fixed-size nodes of
+// about 256 bytes, and the leaves form a doubly linked list. Interior nodes
+// hold separator keys and child pointers: every key in child i is less than
+// separator i, and separator i is no greater than any key in child i + 1. A
+// lookup touches one small sorted array per level instead of one heap node per
+// comparison, and an ordered scan walks neighbouring slots of the same leaf
+// before following a single pointer to the next one.
+//
+// The member functions mirror the std::map subset the runtime and generated
+// code rely on. Unlike std::map, inserting or erasing may move other entries
+// between nodes, so references and iterators are invalidated by any change to
+// the tree except assigning through an existing entry.
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace wio
+{
+    namespace btree_map_detail
+    {
+        // Four cache lines: large enough that a node search is a short scan
+        // over contiguous keys, small enough that a split stays cheap.
+        inline constexpr std::size_t kTargetNodeBytes = 256;
+    }
+
+    template <typename K, typename V, typename TCompare = std::less<K>>
+    class BTreeMap
+    {
+        struct InternalNode;
+
+        struct NodeBase
+        {
+            InternalNode* parent = nullptr;
+            std::uint16_t position = 0;
+            std::uint16_t count = 0;
+            bool leaf = true;
+        };
+
+    public:
+        using key_type = K;
+        using mapped_type = V;
+        using value_type = std::pair<const K, V>;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using key_compare = TCompare;
+        using reference = value_type&;
+        using const_reference = const value_type&;
+
+    private:
+        static constexpr size_type LeafCapacity = std::max<size_type>(
+            4, (btree_map_detail::kTargetNodeBytes - sizeof(NodeBase) - 2 * sizeof(void*)) / sizeof(value_type));
+        static constexpr size_type InternalCapacity = std::max<size_type>(
+            4, (btree_map_detail::kTargetNodeBytes - sizeof(NodeBase) - sizeof(void*)) / (sizeof(K) + sizeof(void*)));
+
+        // Erasing below these counts borrows from or merges with a sibling.
+        static constexpr size_type LeafMinimum = LeafCapacity / 2;
+        static constexpr size_type InternalMinimum = InternalCapacity / 2;
+
+        struct LeafNode final : NodeBase
+        {
+            value_type* Slots() noexcept { return reinterpret_cast<value_type*>(storage); }
+
+            LeafNode* previous = nullptr;
+            LeafNode* next = nullptr;
+            alignas(value_type) unsigned char storage[sizeof(value_type) * LeafCapacity];
+        };
+
+        struct InternalNode final : NodeBase
+        {
+            InternalNode() noexcept { this->leaf = false; }
+
+            K* Keys() noexcept { return reinterpret_cast<K*>(storage); }
+
+            NodeBase* children[InternalCapacity + 1] = {};
+            alignas(K) unsigned char storage[sizeof(K) * InternalCapacity];
+        };
+
+    public:
+        template <bool IsConst>
+        class Iterator
+        {
+        public:
+            using iterator_category = std::bidirectional_iterator_tag;
+            using value_type = BTreeMap::value_type;
+            using difference_type = std::ptrdiff_t;
+            using reference = std::conditional_t<IsConst, const value_type&, value_type&>;
+            using pointer = std::conditional_t<IsConst, const value_type*, value_type*>;
+
+            Iterator() noexcept = default;
+
+            template <bool OtherConst>
+                requires(IsConst && !OtherConst)
+            Iterator(const Iterator<OtherConst>& other) noexcept
+                : leaf_(other.leaf_), index_(other.index_), last_(other.last_)
+            {
+            }
+
+            reference operator*() const noexcept { return leaf_->Slots()[index_]; }
+            pointer operator->() const noexcept { return leaf_->Slots() + index_; }
+
+            Iterator& operator++() noexcept
+            {
+                if (++index_ == leaf_->count)
+                {
+                    leaf_ = leaf_->next;
+                    index_ = 0;
+                }
+                return *this;
+            }
+
+            Iterator operator++(int) noexcept
+            {
+                Iterator previous = *this;
+                ++*this;
+                return previous;
+            }
+
+            Iterator& operator--() noexcept
+            {
+                if (!leaf_)
+                {
+                    leaf_ = *last_;
+                    index_ = leaf_->count - 1u;
+                }
+                else if (index_ == 0)
+                {
+                    leaf_ = leaf_->previous;
+                    index_ = leaf_->count - 1u;
+                }
+                else
+                {
+                    --index_;
+                }
+                return *this;
+            }
+
+            Iterator operator--(int) noexcept
+            {
+                Iterator previous = *this;
+                --*this;
+                return previous;
+            }
+
+            friend bool operator==(const Iterator& a, const Iterator& b) noexcept
+            {
+                return a.leaf_ == b.leaf_ && a.index_ == b.index_;
+            }
+
+        private:
+            friend class BTreeMap;
+            template <bool>
+            friend class Iterator;
+
+            Iterator(LeafNode* leaf, const size_type index, LeafNode* const* last) noexcept
+                : leaf_(leaf), index_(index), last_(last)
+            {
+            }
+
+            LeafNode* leaf_ = nullptr;
+            size_type index_ = 0;
+            // The owning map's last leaf, so that decrementing end() works.
+            LeafNode* const* last_ = nullptr;
+        };
+
+        using iterator = Iterator<false>;
+        using const_iterator = Iterator<true>;
+        using reverse_iterator = std::reverse_iterator<iterator>;
+        using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+        BTreeMap() noexcept(std::is_nothrow_default_constructible_v<TCompare>) = default;
+
+        BTreeMap(std::initializer_list<value_type> values)
+        {
+            insert(values.begin(), values.end());
+        }
+
+        template <typename InputIt>
+        BTreeMap(InputIt first, InputIt last)
+        {
+            insert(first, last);
+        }
+
+        BTreeMap(const BTreeMap& other)
+            : compare_(other.compare_)
+        {
+            // Appending in key order takes the rightmost-leaf fast path and
+            // leaves every leaf but the last full.
+            for (const auto& entry : other)
+                TryEmplace(entry.first, entry.second);
+        }
+
+        BTreeMap(BTreeMap&& other) noexcept
+            : root_(std::exchange(other.root_, nullptr)),
+              first_(std::exchange(other.first_, nullptr)),
+              last_(std::exchange(other.last_, nullptr)),
+              size_(std::exchange(other.size_, 0)),
+              compare_(std::move(other.compare_))
+        {
+        }
+
+        ~BTreeMap() { clear(); }
+
+        BTreeMap& operator=(const BTreeMap& other)
+        {
+            if (this != &other)
+            {
+                BTreeMap copy(other);
+                swap(copy);
+            }
+            return *this;
+        }
+
+        BTreeMap& operator=(BTreeMap&& other) noexcept
+        {
+            if (this != &other)
+            {
+                clear();
+                root_ = std::exchange(other.root_, nullptr);
+                first_ = std::exchange(other.first_, nullptr);
+                last_ = std::exchange(other.last_, nullptr);
+                size_ = std::exchange(other.size_, 0);
+                compare_ = std::move(other.compare_);
+            }
+            return *this;
+        }
+
+        BTreeMap& operator=(std::initializer_list<value_type> values)
+        {
+            BTreeMap replacement(values);
+            swap(replacement);
+            return *this;
+        }
+
+        iterator begin() noexcept { return iterator(first_, 0, &last_); }
+        const_iterator begin() const noexcept { return const_iterator(first_, 0, &last_); }
+        iterator end() noexcept { return iterator(nullptr, 0, &last_); }
+        const_iterator end() const noexcept { return const_iterator(nullptr, 0, &last_); }
+        const_iterator cbegin() const noexcept { return begin(); }
+        const_iterator cend() const noexcept { return end(); }
+        reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+        const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+        reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+        const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+
+        [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+        size_type size() const noexcept { return size_; }
+        key_compare key_comp() const { return compare_; }
+
+        void clear() noexcept
+        {
+            if (root_)
+                DestroyNode(root_);
+            root_ = nullptr;
+            first_ = nullptr;
+            last_ = nullptr;
+            size_ = 0;
+        }
+
+        void swap(BTreeMap& other) noexcept
+        {
+            using std::swap;
+            swap(root_, other.root_);
+            swap(first_, other.first_);
+            swap(last_, other.last_);
+            swap(size_, other.size_);
+            swap(compare_, other.compare_);
+        }
+
+        friend void swap(BTreeMap& a, BTreeMap& b) noexcept { a.swap(b); }
+
+        iterator find(const key_type& key) { return MakeIterator(FindPosition(key)); }
+        const_iterator find(const key_type& key) const { return const_iterator(MakeIterator(FindPosition(key))); }
+        bool contains(const key_type& key) const { return FindPosition(key).first != nullptr; }
+        size_type count(const key_type& key) const { return contains(key) ? 1 : 0; }
+
+        iterator lower_bound(const key_type& key) { return MakeIterator(LowerBoundPosition(key)); }
+        const_iterator lower_bound(const key_type& key) const { return const_iterator(MakeIterator(LowerBoundPosition(key))); }
+        iterator upper_bound(const key_type& key) { return MakeIterator(UpperBoundPosition(key)); }
+        const_iterator upper_bound(const key_type& key) const { return const_iterator(MakeIterator(UpperBoundPosition(key))); }
+
+        std::pair<iterator, iterator> equal_range(const key_type& key)
+        {
+            return {lower_bound(key), upper_bound(key)};
+        }
+
+        std::pair<const_iterator, const_iterator> equal_range(const key_type& key) const
+        {
+            return {lower_bound(key), upper_bound(key)};
+        }
+
+        mapped_type& at(const key_type& key)
+        {
+            const auto [leaf, index] = FindPosition(key);
+            if (!leaf)
+                throw std::out_of_range("BTreeMap::at");
+            return leaf->Slots()[index].second;
+        }
+
+        const mapped_type& at(const key_type& key) const
+        {
+            const auto [leaf, index] = FindPosition(key);
+            if (!leaf)
+                throw std::out_of_range("BTreeMap::at");
+            return leaf->Slots()[index].second;
+        }
+
+        mapped_type& operator[](const key_type& key) { return try_emplace(key).first->second; }
+        mapped_type& operator[](key_type&& key) { return try_emplace(std::move(key)).first->second; }
+
+        template <typename... Args>
+        std::pair<iterator, bool> try_emplace(const key_type& key, Args&&... args)
+        {
+            return TryEmplace(key, std::forward<Args>(args)...);
+        }
+
+        template <typename... Args>
+        std::pair<iterator, bool> try_emplace(key_type&& key, Args&&... args)
+        {
+            return TryEmplace(std::move(key), std::forward<Args>(args)...);
+        }
+
+        template <typename M>
+        std::pair<iterator, bool> insert_or_assign(const key_type& key, M&& value)
+        {
+            auto result = TryEmplace(key, std::forward<M>(value));
+            if (!result.second)
+                result.first->second = std::forward<M>(value);
+            return result;
+        }
+
+        template <typename M>
+        std::pair<iterator, bool> insert_or_assign(key_type&& key, M&& value)
+        {
+            auto result = TryEmplace(std::move(key), std::forward<M>(value));
+            if (!result.second)
+                result.first->second = std::forward<M>(value);
+            return result;
+        }
+
+        template <typename... Args>
+        std::pair<iterator, bool> emplace(Args&&... args)
+        {
+            if constexpr (sizeof...(Args) == 2)
+            {
+                return EmplacePair(std::forward<Args>(args)...);
+            }
+            else
+            {
+                value_type entry(std::forward<Args>(args)...);
+                return TryEmplace(entry.first, std::move(entry.second));
+            }
+        }
+
+        std::pair<iterator, bool> insert(const value_type& value) { return TryEmplace(value.first, value.second); }
+
+        template <typename P>
+            requires std::is_constructible_v<value_type, P&&>
+        std::pair<iterator, bool> insert(P&& value)
+        {
+            return emplace(std::forward<P>(value));
+        }
+
+        template <typename InputIt>
+        void insert(InputIt first, InputIt last)
+        {
+            for (; first != last; ++first)
+                emplace(*first);
+        }
+
+        void insert(std::initializer_list<value_type> values) { insert(values.begin(), values.end()); }
+
+        size_type erase(const key_type& key)
+        {
+            const auto [leaf, index] = FindPosition(key);
+            if (!leaf)
+                return 0;
+            EraseAt(leaf, index);
+            return 1;
+        }
+
+        iterator erase(const_iterator position) { return EraseAt(position.leaf_, position.index_); }
+        iterator erase(iterator position) { return EraseAt(position.leaf_, position.index_); }
+
+        friend bool operator==(const BTreeMap& a, const BTreeMap& b)
+            requires requires(const K& key, const V& value) { key == key; value == value; }
+        {
+            if (a.size_ != b.size_)
+                return false;
+            auto other = b.begin();
+            for (const auto& entry : a)
+            {
+                if (!(entry.first == other->first) || !(entry.second == other->second))
+                    return false;
+                ++other;
+            }
+            return true;
+        }
+
+    private:
+        using Position = std::pair<LeafNode*, size_type>;
+
+        // Keys are const only to callers; every relocation destroys the
+        // source slot right after moving out of it.
+        static void Relocate(value_type* target, value_type* source)
+        {
+            ::new (static_cast<void*>(target)) value_type(
+                std::move(const_cast<key_type&>(source->first)), std::move(source->second));
+            std::destroy_at(source);
+        }
+
+        static void Relocate(K* target, K* source)
+        {
+            ::new (static_cast<void*>(target)) K(std::move(*source));
+            std::destroy_at(source);
+        }
+
+        // Moves [first, first + count) one slot towards the end.
+        template <typename T>
+        static void ShiftRight(T* first, const size_type count)
+        {
+            for (size_type index = count; index > 0; --index)
+                Relocate(first + index, first + index - 1);
+        }
+
+        // Moves [first + 1, first + 1 + count) one slot towards the front.
+        template <typename T>
+        static void ShiftLeft(T* first, const size_type count)
+        {
+            for (size_type index = 0; index < count; ++index)
+                Relocate(first + index, first + index + 1);
+        }
+
+        static void SetChild(InternalNode* node, const size_type index, NodeBase* child) noexcept
+        {
+            node->children[index] = child;
+            child->parent = node;
+            child->position = static_cast<std::uint16_t>(index);
+        }
+
+        iterator MakeIterator(const Position position) const noexcept
+        {
+            auto [leaf, index] = position;
+            if (leaf && index == leaf->count)
+            {
+                leaf = leaf->next;
+                index = 0;
+            }
+            return iterator(leaf, leaf ? index : 0, &last_);
+        }
+
+        LeafNode* DescendTo(const key_type& key) const
+        {
+            NodeBase* node = root_;
+            while (!node->leaf)
+            {
+                auto* internal = static_cast<InternalNode*>(node);
+                K* keys = internal->Keys();
+                const auto child = std::upper_bound(keys, keys + internal->count, key, compare_) - keys;
+                node = internal->children[child];
+            }
+            return static_cast<LeafNode*>(node);
+        }
+
+        // The slot of the first entry not less than key; the index equals the
+        // leaf's count when that entry starts the next leaf.
+        Position LowerBoundPosition(const key_type& key) const
+        {
+            if (!root_)
+                return {nullptr, 0};
+            LeafNode* leaf = DescendTo(key);
+            value_type* slots = leaf->Slots();
+            const auto index = std::lower_bound(slots, slots + leaf->count, key,
+                [this](const value_type& entry, const key_type& value) { return compare_(entry.first, value); }) - slots;
+            return {leaf, static_cast<size_type>(index)};
+        }
+
+        Position UpperBoundPosition(const key_type& key) const
+        {
+            if (!root_)
+                return {nullptr, 0};
+            LeafNode* leaf = DescendTo(key);
+            value_type* slots = leaf->Slots();
+            const auto index = std::upper_bound(slots, slots + leaf->count, key,
+                [this](const key_type& value, const value_type& entry) { return compare_(value, entry.first); }) - slots;
+            return {leaf, static_cast<size_type>(index)};
+        }
+
+        Position FindPosition(const key_type& key) const
+        {
+            const auto [leaf, index] = LowerBoundPosition(key);
+            if (!leaf || index == leaf->count || compare_(key, leaf->Slots()[index].first))
+                return {nullptr, 0};
+            return {leaf, index};
+        }
+
+        template <typename Key, typename... Args>
+        std::pair<iterator, bool> TryEmplace(Key&& key, Args&&... args)
+        {
+            if (!root_)
+            {
+                auto* leaf = new LeafNode;
+                root_ = leaf;
+                first_ = leaf;
+                last_ = leaf;
+            }
+
+            // Keys arriving in ascending order, as time series and copies do,
+            // go straight to the end of the last leaf.
+            Position position{last_, last_->count};
+            if (size_ == 0 || !compare_(last_->Slots()[last_->count - 1u].first, key))
+            {
+                position = LowerBoundPosition(key);
+                const auto [leaf, index] = position;
+                if (index != leaf->count && !compare_(key, leaf->Slots()[index].first))
+                    return {iterator(leaf, index, &last_), false};
+            }
+            return {InsertAt(position.first, position.second, std::forward<Key>(key), std::forward<Args>(args)...), true};
+        }
+
+        template <typename Key, typename Value>
+        std::pair<iterator, bool> EmplacePair(Key&& key, Value&& value)
+        {
+            if constexpr (std::is_same_v<std::remove_cvref_t<Key>, key_type>)
+            {
+                return TryEmplace(std::forward<Key>(key), std::forward<Value>(value));
+            }
+            else
+            {
+                key_type converted(std::forward<Key>(key));
+                return TryEmplace(std::move(converted), std::forward<Value>(value));
+            }
+        }
+
+        template <typename Key, typename... Args>
+        iterator InsertAt(LeafNode* leaf, size_type index, Key&& key, Args&&... args)
+        {
+            if (leaf->count < LeafCapacity)
+            {
+                value_type* slots = leaf->Slots();
+                ShiftRight(slots + index, leaf->count - index);
+                ::new (static_cast<void*>(slots + index)) value_type(
+                    std::piecewise_construct,
+                    std::forward_as_tuple(std::forward<Key>(key)),
+                    std::forward_as_tuple(std::forward<Args>(args)...));
+                ++leaf->count;
+                ++size_;
+                return iterator(leaf, index, &last_);
+            }
+
+            // Build the entry before touching the tree so a throwing
+            // constructor leaves it unchanged.
+            value_type entry(
+                std::piecewise_construct,
+                std::forward_as_tuple(std::forward<Key>(key)),
+                std::forward_as_tuple(std::forward<Args>(args)...));
+
+            // Appending to the last leaf starts a new one instead of halving
+            // the full leaf, so ascending inserts keep leaves full.
+            const size_type keep = index == LeafCapacity && leaf == last_ ? LeafCapacity : (LeafCapacity + 1) / 2;
+            auto* right = new LeafNode;
+            value_type* slots = leaf->Slots();
+            for (size_type moved = keep; moved < LeafCapacity; ++moved)
+                Relocate(right->Slots() + (moved - keep), slots + moved);
+            right->count = static_cast<std::uint16_t>(LeafCapacity - keep);
+            leaf->count = static_cast<std::uint16_t>(keep);
+
+            right->previous = leaf;
+            right->next = leaf->next;
+            if (leaf->next)
+                leaf->next->previous = right;
+            else
+                last_ = right;
+            leaf->next = right;
+
+            LeafNode* target = leaf;
+            if (index > keep || keep == LeafCapacity)
+            {
+                target = right;
+                index -= keep;
+            }
+            value_type* targetSlots = target->Slots();
+            ShiftRight(targetSlots + index, target->count - index);
+            Relocate(targetSlots + index, &entry);
+            ++target->count;
+            ++size_;
+
+            InsertIntoParent(leaf, key_type(right->Slots()[0].first), right);
+            return iterator(target, index, &last_);
+        }
+
+        void InsertIntoParent(NodeBase* left, key_type separator, NodeBase* right)
+        {
+            InternalNode* parent = left->parent;
+            if (!parent)
+            {
+                auto* root = new InternalNode();
+                ::new (static_cast<void*>(root->Keys())) K(std::move(separator));
+                root->count = 1;
+                SetChild(root, 0, left);
+                SetChild(root, 1, right);
+                root_ = root;
+                return;
+            }
+
+            size_type position = left->position;
+            if (parent->count < InternalCapacity)
+            {
+                InsertSeparator(parent, position, std::move(separator), right);
+                return;
+            }
+
+            // Split the full parent around its middle key, which moves up.
+            constexpr size_type middle = InternalCapacity / 2;
+            auto* sibling = new InternalNode();
+            K* keys = parent->Keys();
+            key_type promoted(std::move(keys[middle]));
+            std::destroy_at(keys + middle);
+            for (size_type index = middle + 1; index < InternalCapacity; ++index)
+                Relocate(sibling->Keys() + (index - middle - 1), keys + index);
+            for (size_type index = middle + 1; index <= InternalCapacity; ++index)
+                SetChild(sibling, index - middle - 1, parent->children[index]);
+            sibling->count = static_cast<std::uint16_t>(InternalCapacity - middle - 1);
+            parent->count = static_cast<std::uint16_t>(middle);
+
+            InternalNode* target = parent;
+            if (position > middle)
+            {
+                target = sibling;
+                position -= middle + 1;
+            }
+            InsertSeparator(target, position, std::move(separator), right);
+            InsertIntoParent(parent, std::move(promoted), sibling);
+        }
+
+        // Inserts separator after child `position` with `right` as the child
+        // that follows it.
+        static void InsertSeparator(InternalNode* node, const size_type position, key_type separator, NodeBase* right)
+        {
+            K* keys = node->Keys();
+            ShiftRight(keys + position, node->count - position);
+            ::new (static_cast<void*>(keys + position)) K(std::move(separator));
+            for (size_type index = node->count + 1u; index > position + 1; --index)
+                SetChild(node, index, node->children[index - 1]);
+            SetChild(node, position + 1, right);
+            ++node->count;
+        }
+
+        // Drops child `position` and the separator in front of it.
+        static void RemoveChild(InternalNode* node, const size_type position)
+        {
+            K* keys = node->Keys();
+            std::destroy_at(keys + position - 1);
+            ShiftLeft(keys + position - 1, node->count - position);
+            for (size_type index = position; index < node->count; ++index)
+                SetChild(node, index, node->children[index + 1]);
+            node->children[node->count] = nullptr;
+            --node->count;
+        }
+
+        iterator EraseAt(LeafNode* leaf, const size_type index)
+        {
+            value_type* slots = leaf->Slots();
+            std::destroy_at(slots + index);
+            ShiftLeft(slots + index, leaf->count - index - 1u);
+            --leaf->count;
+            --size_;
+
+            if (leaf == root_)
+            {
+                if (leaf->count == 0)
+                {
+                    clear();
+                    return end();
+                }
+                return MakeIterator({leaf, index});
+            }
+
+            // Track the entry after the erased one through any rebalancing.
+            Position next{leaf, index};
+            if (leaf->count < LeafMinimum)
+                RebalanceLeaf(leaf, next);
+            return MakeIterator(next);
+        }
+
+        void RebalanceLeaf(LeafNode* leaf, Position& tracked)
+        {
+            InternalNode* parent = leaf->parent;
+            const size_type position = leaf->position;
+            auto* left = position > 0 ? static_cast<LeafNode*>(parent->children[position - 1]) : nullptr;
+            auto* right = position < parent->count ? static_cast<LeafNode*>(parent->children[position + 1]) : nullptr;
+
+            if (left && left->count > LeafMinimum)
+            {
+                ShiftRight(leaf->Slots(), leaf->count);
+                Relocate(leaf->Slots(), left->Slots() + left->count - 1);
+                --left->count;
+                ++leaf->count;
+                parent->Keys()[position - 1] = leaf->Slots()[0].first;
+                if (tracked.first == leaf)
+                    ++tracked.second;
+                return;
+            }
+            if (right && right->count > LeafMinimum)
+            {
+                Relocate(leaf->Slots() + leaf->count, right->Slots());
+                ShiftLeft(right->Slots(), right->count - 1u);
+                ++leaf->count;
+                --right->count;
+                parent->Keys()[position] = right->Slots()[0].first;
+                return;
+            }
+
+            if (left)
+            {
+                if (tracked.first == leaf)
+                    tracked = {left, left->count + tracked.second};
+                MergeLeaves(left, leaf);
+            }
+            else
+            {
+                MergeLeaves(leaf, right);
+            }
+        }
+
+        void MergeLeaves(LeafNode* left, LeafNode* right)
+        {
+            for (size_type index = 0; index < right->count; ++index)
+                Relocate(left->Slots() + left->count + index, right->Slots() + index);
+            left->count = static_cast<std::uint16_t>(left->count + right->count);
+            left->next = right->next;
+            if (right->next)
+                right->next->previous = left;
+            else
+                last_ = left;
+
+            InternalNode* parent = right->parent;
+            RemoveChild(parent, right->position);
+            delete right;
+            RebalanceInternal(parent);
+        }
+
+        void RebalanceInternal(InternalNode* node)
+        {
+            if (node == root_)
+            {
+                if (node->count == 0)
+                {
+                    root_ = node->children[0];
+                    root_->parent = nullptr;
+                    root_->position = 0;
+                    delete node;
+                }
+                return;
+            }
+            if (node->count >= InternalMinimum)
+                return;
+
+            InternalNode* parent = node->parent;
+            const size_type position = node->position;
+            auto* left = position > 0 ? static_cast<InternalNode*>(parent->children[position - 1]) : nullptr;
+            auto* right = position < parent->count ? static_cast<InternalNode*>(parent->children[position + 1]) : nullptr;
+            K* separators = parent->Keys();
+
+            if (left && left->count > InternalMinimum)
+            {
+                // Rotate the left sibling's last child through the parent.
+                K* keys = node->Keys();
+                ShiftRight(keys, node->count);
+                ::new (static_cast<void*>(keys)) K(std::move(separators[position - 1]));
+                for (size_type index = node->count + 1u; index > 0; --index)
+                    SetChild(node, index, node->children[index - 1]);
+                SetChild(node, 0, left->children[left->count]);
+                left->children[left->count] = nullptr;
+                separators[position - 1] = std::move(left->Keys()[left->count - 1u]);
+                std::destroy_at(left->Keys() + left->count - 1u);
+                --left->count;
+                ++node->count;
+                return;
+            }
+            if (right && right->count > InternalMinimum)
+            {
+                // Rotate the right sibling's first child through the parent.
+                ::new (static_cast<void*>(node->Keys() + node->count)) K(std::move(separators[position]));
+                SetChild(node, node->count + 1u, right->children[0]);
+                separators[position] = std::move(right->Keys()[0]);
+                std::destroy_at(right->Keys());
+                ShiftLeft(right->Keys(), right->count - 1u);
+                for (size_type index = 0; index < right->count; ++index)
+                    SetChild(right, index, right->children[index + 1]);
+                right->children[right->count] = nullptr;
+                --right->count;
+                ++node->count;
+                return;
+            }
+
+            if (left)
+                MergeInternal(left, node);
+            else
+                MergeInternal(node, right);
+        }
+
+        void MergeInternal(InternalNode* left, InternalNode* right)
+        {
+            InternalNode* parent = left->parent;
+            K* keys = left->Keys();
+            ::new (static_cast<void*>(keys + left->count)) K(std::move(parent->Keys()[right->position - 1u]));
+            for (size_type index = 0; index < right->count; ++index)
+                Relocate(keys + left->count + 1 + index, right->Keys() + index);
+            for (size_type index = 0; index <= right->count; ++index)
+                SetChild(left, left->count + 1u + index, right->children[index]);
+            left->count = static_cast<std::uint16_t>(left->count + 1u + right->count);
+
+            RemoveChild(parent, right->position);
+            delete right;
+            RebalanceInternal(parent);
+        }
+
+        static void DestroyNode(NodeBase* node) noexcept
+        {
+            if (node->leaf)
+            {
+                auto* leaf = static_cast<LeafNode*>(node);
+                std::destroy_n(leaf->Slots(), leaf->count);
+                delete leaf;
+                return;
+            }
+            auto* internal = static_cast<InternalNode*>(node);
+            std::destroy_n(internal->Keys(), internal->count);
+            for (size_type index = 0; index <= internal->count; ++index)
+                DestroyNode(internal->children[index]);
+            delete internal;
+        }
+
+        NodeBase* root_ = nullptr;
+        LeafNode* first_ = nullptr;
+        LeafNode* last_ = nullptr;
+        size_type size_ = 0;
+        [[no_unique_address]] TCompare compare_{};
+    };
+}
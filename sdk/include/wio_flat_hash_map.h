@@ -0,0 +1,754 @@
+#pragma once
+
+// Open-addressing hash map behind Wio `Dict<K, V>`.
+//
+// Slots live in one flat array next to a control byte per slot: the top bit
+// marks an empty or deleted slot, and a full slot stores the low 7 bits of its
+// hash. Lookups compare a whole group of control bytes at once (SSE2 where
+// available, 8-byte SWAR elsewhere) and only touch the slots whose hash bits
+// match, so a lookup is one probe of the control bytes and usually one key
+// comparison, without the per-entry allocation and pointer chasing of
+// std::unordered_map.
+//
+// The member functions mirror the std::unordered_map subset the runtime and
+// generated code rely on. Unlike std::unordered_map, inserting may move
+// existing entries, so references and iterators are invalidated by any
+// insertion that grows the table; erasing never moves other entries.
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define WIO_FLAT_HASH_MAP_SSE2 1
+#endif
+
+namespace wio
+{
+    namespace flat_hash_map_detail
+    {
+        using Control = std::int8_t;
+
+        inline constexpr Control kEmpty = -128;
+        inline constexpr Control kDeleted = -2;
+
+        // Matching slots of one group, lowest first. Each slot owns
+        // 2^Shift bits of the mask.
+        template <typename T, int SignificantBits, int Shift>
+        class BitMask
+        {
+        public:
+            explicit BitMask(const T mask) noexcept : mask_(mask) {}
+
+            explicit operator bool() const noexcept { return mask_ != 0; }
+
+            unsigned Lowest() const noexcept
+            {
+                return static_cast<unsigned>(std::countr_zero(mask_)) >> Shift;
+            }
+
+            unsigned TrailingZeros() const noexcept { return Lowest(); }
+
+            unsigned LeadingZeros() const noexcept
+            {
+                constexpr int unused = static_cast<int>(sizeof(T) * 8) - SignificantBits;
+                return static_cast<unsigned>(std::countl_zero(mask_) - unused) >> Shift;
+            }
+
+            BitMask& operator++() noexcept
+            {
+                mask_ &= mask_ - 1;
+                return *this;
+            }
+
+            unsigned operator*() const noexcept { return Lowest(); }
+            BitMask begin() const noexcept { return *this; }
+            BitMask end() const noexcept { return BitMask(0); }
+            friend bool operator==(const BitMask& a, const BitMask& b) noexcept { return a.mask_ == b.mask_; }
+
+        private:
+            T mask_;
+        };
+
+#if defined(WIO_FLAT_HASH_MAP_SSE2)
+        struct Group final
+        {
+            static constexpr std::size_t Width = 16;
+            using Mask = BitMask<std::uint32_t, Width, 0>;
+
+            explicit Group(const Control* position) noexcept
+                : control(_mm_loadu_si128(reinterpret_cast<const __m128i*>(position)))
+            {
+            }
+
+            Mask Match(const Control hash) const noexcept
+            {
+                return Mask(static_cast<std::uint32_t>(
+                    _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(hash), control))));
+            }
+
+            Mask MatchEmpty() const noexcept { return Match(kEmpty); }
+
+            Mask MatchEmptyOrDeleted() const noexcept
+            {
+                return Mask(static_cast<std::uint32_t>(
+                    _mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(-1), control))));
+            }
+
+            __m128i control;
+        };
+#else
+        struct Group final
+        {
+            static constexpr std::size_t Width = 8;
+            using Mask = BitMask<std::uint64_t, 64, 3>;
+
+            static constexpr std::uint64_t lsbs = 0x0101010101010101ULL;
+            static constexpr std::uint64_t msbs = 0x8080808080808080ULL;
+
+            explicit Group(const Control* position) noexcept
+            {
+                std::memcpy(&control, position, sizeof(control));
+                if constexpr (std::endian::native == std::endian::big)
+                    control = __builtin_bswap64(control);
+            }
+
+            // May report a false positive next to a true match; callers
+            // compare keys anyway.
+            Mask Match(const Control hash) const noexcept
+            {
+                const std::uint64_t x = control ^ (lsbs * static_cast<std::uint8_t>(hash));
+                return Mask((x - lsbs) & ~x & msbs);
+            }
+
+            Mask MatchEmpty() const noexcept { return Mask((control & (~control << 6)) & msbs); }
+            Mask MatchEmptyOrDeleted() const noexcept { return Mask((control & (~control << 7)) & msbs); }
+
+            std::uint64_t control = 0;
+        };
+#endif
+
+        inline std::uint64_t Mix(std::uint64_t hash) noexcept
+        {
+            // std::hash is the identity for integers; spread every input bit
+            // before the hash is split into probe position and control bits.
+            hash = (hash ^ (hash >> 30)) * 0xbf58476d1ce4e5b9ULL;
+            hash = (hash ^ (hash >> 27)) * 0x94d049bb133111ebULL;
+            return hash ^ (hash >> 31);
+        }
+    }
+
+    template <typename K, typename V, typename THash = std::hash<K>, typename TKeyEqual = std::equal_to<K>>
+    class FlatHashMap
+    {
+        using Control = flat_hash_map_detail::Control;
+        using Group = flat_hash_map_detail::Group;
+
+    public:
+        using key_type = K;
+        using mapped_type = V;
+        using value_type = std::pair<const K, V>;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using hasher = THash;
+        using key_equal = TKeyEqual;
+        using reference = value_type&;
+        using const_reference = const value_type&;
+
+        template <bool IsConst>
+        class Iterator
+        {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = FlatHashMap::value_type;
+            using difference_type = std::ptrdiff_t;
+            using reference = std::conditional_t<IsConst, const value_type&, value_type&>;
+            using pointer = std::conditional_t<IsConst, const value_type*, value_type*>;
+
+            Iterator() noexcept = default;
+
+            template <bool OtherConst>
+                requires(IsConst && !OtherConst)
+            Iterator(const Iterator<OtherConst>& other) noexcept
+                : control_(other.control_), slot_(other.slot_), end_(other.end_)
+            {
+            }
+
+            reference operator*() const noexcept { return *slot_; }
+            pointer operator->() const noexcept { return slot_; }
+
+            Iterator& operator++() noexcept
+            {
+                ++control_;
+                ++slot_;
+                SkipFree();
+                return *this;
+            }
+
+            Iterator operator++(int) noexcept
+            {
+                Iterator previous = *this;
+                ++*this;
+                return previous;
+            }
+
+            friend bool operator==(const Iterator& a, const Iterator& b) noexcept { return a.slot_ == b.slot_; }
+
+        private:
+            friend class FlatHashMap;
+            template <bool>
+            friend class Iterator;
+
+            Iterator(const Control* control, pointer slot, const Control* end) noexcept
+                : control_(control), slot_(slot), end_(end)
+            {
+            }
+
+            void SkipFree() noexcept
+            {
+                while (control_ != end_ && *control_ < 0)
+                {
+                    ++control_;
+                    ++slot_;
+                }
+            }
+
+            const Control* control_ = nullptr;
+            pointer slot_ = nullptr;
+            const Control* end_ = nullptr;
+        };
+
+        using iterator = Iterator<false>;
+        using const_iterator = Iterator<true>;
+
+        FlatHashMap() noexcept(std::is_nothrow_default_constructible_v<THash> &&
+                               std::is_nothrow_default_constructible_v<TKeyEqual>) = default;
+
+        FlatHashMap(std::initializer_list<value_type> values)
+        {
+            reserve(values.size());
+            insert(values.begin(), values.end());
+        }
+
+        template <typename InputIt>
+        FlatHashMap(InputIt first, InputIt last)
+        {
+            insert(first, last);
+        }
+
+        FlatHashMap(const FlatHashMap& other)
+            : hash_(other.hash_), equal_(other.equal_)
+        {
+            reserve(other.size_);
+            for (const auto& entry : other)
+                EmplaceNew(Hash(entry.first), entry.first, entry.second);
+        }
+
+        FlatHashMap(FlatHashMap&& other) noexcept
+            : control_(std::exchange(other.control_, nullptr)),
+              slots_(std::exchange(other.slots_, nullptr)),
+              capacity_(std::exchange(other.capacity_, 0)),
+              size_(std::exchange(other.size_, 0)),
+              growthLeft_(std::exchange(other.growthLeft_, 0)),
+              hash_(std::move(other.hash_)),
+              equal_(std::move(other.equal_))
+        {
+        }
+
+        ~FlatHashMap() { Release(); }
+
+        FlatHashMap& operator=(const FlatHashMap& other)
+        {
+            if (this != &other)
+            {
+                FlatHashMap copy(other);
+                swap(copy);
+            }
+            return *this;
+        }
+
+        FlatHashMap& operator=(FlatHashMap&& other) noexcept
+        {
+            if (this != &other)
+            {
+                Release();
+                control_ = std::exchange(other.control_, nullptr);
+                slots_ = std::exchange(other.slots_, nullptr);
+                capacity_ = std::exchange(other.capacity_, 0);
+                size_ = std::exchange(other.size_, 0);
+                growthLeft_ = std::exchange(other.growthLeft_, 0);
+                hash_ = std::move(other.hash_);
+                equal_ = std::move(other.equal_);
+            }
+            return *this;
+        }
+
+        FlatHashMap& operator=(std::initializer_list<value_type> values)
+        {
+            FlatHashMap replacement(values);
+            swap(replacement);
+            return *this;
+        }
+
+        iterator begin() noexcept
+        {
+            iterator it(control_, slots_, control_ + capacity_);
+            it.SkipFree();
+            return it;
+        }
+
+        const_iterator begin() const noexcept
+        {
+            const_iterator it(control_, slots_, control_ + capacity_);
+            it.SkipFree();
+            return it;
+        }
+
+        iterator end() noexcept { return iterator(control_ + capacity_, slots_ + capacity_, control_ + capacity_); }
+        const_iterator end() const noexcept { return const_iterator(control_ + capacity_, slots_ + capacity_, control_ + capacity_); }
+        const_iterator cbegin() const noexcept { return begin(); }
+        const_iterator cend() const noexcept { return end(); }
+
+        [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+        size_type size() const noexcept { return size_; }
+        size_type bucket_count() const noexcept { return capacity_; }
+        float load_factor() const noexcept { return capacity_ == 0 ? 0.0f : static_cast<float>(size_) / static_cast<float>(capacity_); }
+        hasher hash_function() const { return hash_; }
+        key_equal key_eq() const { return equal_; }
+
+        void clear() noexcept
+        {
+            if (size_ == 0 && growthLeft_ == MaxGrowth(capacity_))
+                return;
+            DestroySlots();
+            ResetControl();
+        }
+
+        void reserve(const size_type count)
+        {
+            if (count > size_ + growthLeft_)
+                Resize(CapacityFor(count));
+        }
+
+        void rehash(const size_type count)
+        {
+            const size_type wanted = CapacityFor(std::max(count, size_));
+            if (wanted != capacity_)
+                Resize(wanted);
+        }
+
+        void swap(FlatHashMap& other) noexcept
+        {
+            using std::swap;
+            swap(control_, other.control_);
+            swap(slots_, other.slots_);
+            swap(capacity_, other.capacity_);
+            swap(size_, other.size_);
+            swap(growthLeft_, other.growthLeft_);
+            swap(hash_, other.hash_);
+            swap(equal_, other.equal_);
+        }
+
+        friend void swap(FlatHashMap& a, FlatHashMap& b) noexcept { a.swap(b); }
+
+        iterator find(const key_type& key)
+        {
+            const size_type slot = FindSlot(key, Hash(key));
+            return slot == npos ? end() : IteratorAt(slot);
+        }
+
+        const_iterator find(const key_type& key) const
+        {
+            const size_type slot = FindSlot(key, Hash(key));
+            return slot == npos ? end() : ConstIteratorAt(slot);
+        }
+
+        bool contains(const key_type& key) const { return FindSlot(key, Hash(key)) != npos; }
+        size_type count(const key_type& key) const { return contains(key) ? 1 : 0; }
+
+        mapped_type& at(const key_type& key)
+        {
+            const size_type slot = FindSlot(key, Hash(key));
+            if (slot == npos)
+                throw std::out_of_range("FlatHashMap::at");
+            return slots_[slot].second;
+        }
+
+        const mapped_type& at(const key_type& key) const
+        {
+            const size_type slot = FindSlot(key, Hash(key));
+            if (slot == npos)
+                throw std::out_of_range("FlatHashMap::at");
+            return slots_[slot].second;
+        }
+
+        mapped_type& operator[](const key_type& key) { return try_emplace(key).first->second; }
+        mapped_type& operator[](key_type&& key) { return try_emplace(std::move(key)).first->second; }
+
+        template <typename... Args>
+        std::pair<iterator, bool> try_emplace(const key_type& key, Args&&... args)
+        {
+            return TryEmplace(key, std::forward<Args>(args)...);
+        }
+
+        template <typename... Args>
+        std::pair<iterator, bool> try_emplace(key_type&& key, Args&&... args)
+        {
+            return TryEmplace(std::move(key), std::forward<Args>(args)...);
+        }
+
+        template <typename M>
+        std::pair<iterator, bool> insert_or_assign(const key_type& key, M&& value)
+        {
+            auto result = TryEmplace(key, std::forward<M>(value));
+            if (!result.second)
+                result.first->second = std::forward<M>(value);
+            return result;
+        }
+
+        template <typename M>
+        std::pair<iterator, bool> insert_or_assign(key_type&& key, M&& value)
+        {
+            auto result = TryEmplace(std::move(key), std::forward<M>(value));
+            if (!result.second)
+                result.first->second = std::forward<M>(value);
+            return result;
+        }
+
+        template <typename... Args>
+        std::pair<iterator, bool> emplace(Args&&... args)
+        {
+            if constexpr (sizeof...(Args) == 2)
+            {
+                return EmplacePair(std::forward<Args>(args)...);
+            }
+            else
+            {
+                value_type entry(std::forward<Args>(args)...);
+                return TryEmplace(entry.first, std::move(entry.second));
+            }
+        }
+
+        std::pair<iterator, bool> insert(const value_type& value) { return TryEmplace(value.first, value.second); }
+
+        template <typename P>
+            requires std::is_constructible_v<value_type, P&&>
+        std::pair<iterator, bool> insert(P&& value)
+        {
+            return emplace(std::forward<P>(value));
+        }
+
+        template <typename InputIt>
+        void insert(InputIt first, InputIt last)
+        {
+            for (; first != last; ++first)
+                emplace(*first);
+        }
+
+        void insert(std::initializer_list<value_type> values) { insert(values.begin(), values.end()); }
+
+        size_type erase(const key_type& key)
+        {
+            const size_type slot = FindSlot(key, Hash(key));
+            if (slot == npos)
+                return 0;
+            EraseSlot(slot);
+            return 1;
+        }
+
+        iterator erase(const_iterator position)
+        {
+            const auto slot = static_cast<size_type>(position.slot_ - slots_);
+            EraseSlot(slot);
+            iterator next = IteratorAt(slot);
+            next.SkipFree();
+            return next;
+        }
+
+        iterator erase(iterator position) { return erase(const_iterator(position)); }
+
+        friend bool operator==(const FlatHashMap& a, const FlatHashMap& b)
+            requires requires(const V& value) { value == value; }
+        {
+            if (a.size_ != b.size_)
+                return false;
+            for (const auto& entry : a)
+            {
+                const auto found = b.find(entry.first);
+                if (found == b.end() || !(found->second == entry.second))
+                    return false;
+            }
+            return true;
+        }
+
+    private:
+        static constexpr size_type npos = static_cast<size_type>(-1);
+
+        // Tables stay at most 7/8 full, counting deleted slots, so every
+        // probe sequence reaches an empty slot.
+        static constexpr size_type MaxGrowth(const size_type capacity) noexcept
+        {
+            return capacity - capacity / 8;
+        }
+
+        static size_type CapacityFor(const size_type count) noexcept
+        {
+            if (count == 0)
+                return 0;
+            const size_type minimum = count + (count + 6) / 7;
+            return std::max<size_type>(Group::Width, std::bit_ceil(minimum));
+        }
+
+        static constexpr size_type SlotOffset(const size_type capacity) noexcept
+        {
+            constexpr size_type alignment = alignof(value_type);
+            return (capacity + Group::Width + alignment - 1) / alignment * alignment;
+        }
+
+        static constexpr std::align_val_t Alignment() noexcept
+        {
+            return std::align_val_t(std::max<size_type>(alignof(value_type), alignof(std::max_align_t)));
+        }
+
+        std::uint64_t Hash(const key_type& key) const
+        {
+            return flat_hash_map_detail::Mix(static_cast<std::uint64_t>(hash_(key)));
+        }
+
+        static Control ControlByte(const std::uint64_t hash) noexcept
+        {
+            return static_cast<Control>(hash & 0x7F);
+        }
+
+        iterator IteratorAt(const size_type slot) noexcept
+        {
+            return iterator(control_ + slot, slots_ + slot, control_ + capacity_);
+        }
+
+        const_iterator ConstIteratorAt(const size_type slot) const noexcept
+        {
+            return const_iterator(control_ + slot, slots_ + slot, control_ + capacity_);
+        }
+
+        // The first Width control bytes are mirrored after the last slot, so
+        // a group load that starts near the end wraps around the table.
+        void SetControl(const size_type slot, const Control value) noexcept
+        {
+            control_[slot] = value;
+            if (slot < Group::Width)
+                control_[capacity_ + slot] = value;
+        }
+
+        size_type FindSlot(const key_type& key, const std::uint64_t hash) const
+        {
+            if (size_ == 0)
+                return npos;
+            const size_type mask = capacity_ - 1;
+            const Control h2 = ControlByte(hash);
+            size_type offset = static_cast<size_type>(hash >> 7) & mask;
+            size_type step = 0;
+            for (;;)
+            {
+                const Group group(control_ + offset);
+                for (const unsigned index : group.Match(h2))
+                {
+                    const size_type slot = (offset + index) & mask;
+                    if (equal_(slots_[slot].first, key))
+                        return slot;
+                }
+                if (group.MatchEmpty())
+                    return npos;
+                step += Group::Width;
+                offset = (offset + step) & mask;
+            }
+        }
+
+        size_type FindFree(const std::uint64_t hash) const noexcept
+        {
+            const size_type mask = capacity_ - 1;
+            size_type offset = static_cast<size_type>(hash >> 7) & mask;
+            size_type step = 0;
+            for (;;)
+            {
+                const auto free = Group(control_ + offset).MatchEmptyOrDeleted();
+                if (free)
+                    return (offset + free.Lowest()) & mask;
+                step += Group::Width;
+                offset = (offset + step) & mask;
+            }
+        }
+
+        template <typename Key, typename... Args>
+        std::pair<iterator, bool> TryEmplace(Key&& key, Args&&... args)
+        {
+            const std::uint64_t hash = Hash(key);
+            if (const size_type slot = FindSlot(key, hash); slot != npos)
+                return {IteratorAt(slot), false};
+            return {EmplaceNew(hash, std::forward<Key>(key), std::forward<Args>(args)...), true};
+        }
+
+        template <typename Key, typename Value>
+        std::pair<iterator, bool> EmplacePair(Key&& key, Value&& value)
+        {
+            if constexpr (std::is_same_v<std::remove_cvref_t<Key>, key_type>)
+            {
+                return TryEmplace(std::forward<Key>(key), std::forward<Value>(value));
+            }
+            else
+            {
+                key_type converted(std::forward<Key>(key));
+                return TryEmplace(std::move(converted), std::forward<Value>(value));
+            }
+        }
+
+        // Inserts a key known to be absent.
+        template <typename Key, typename... Args>
+        iterator EmplaceNew(const std::uint64_t hash, Key&& key, Args&&... args)
+        {
+            size_type slot = capacity_ == 0 ? 0 : FindFree(hash);
+            if (capacity_ == 0 || (growthLeft_ == 0 && control_[slot] != flat_hash_map_detail::kDeleted))
+            {
+                Grow();
+                slot = FindFree(hash);
+            }
+            ::new (static_cast<void*>(slots_ + slot)) value_type(
+                std::piecewise_construct,
+                std::forward_as_tuple(std::forward<Key>(key)),
+                std::forward_as_tuple(std::forward<Args>(args)...));
+            if (control_[slot] == flat_hash_map_detail::kEmpty)
+                --growthLeft_;
+            SetControl(slot, ControlByte(hash));
+            ++size_;
+            return IteratorAt(slot);
+        }
+
+        // A slot can go straight back to empty when no probe ever had to
+        // pass it: some group window around it still has an empty slot.
+        void EraseSlot(const size_type slot) noexcept
+        {
+            std::destroy_at(slots_ + slot);
+            --size_;
+            const size_type mask = capacity_ - 1;
+            const auto emptyAfter = Group(control_ + slot).MatchEmpty();
+            const auto emptyBefore = Group(control_ + ((slot - Group::Width) & mask)).MatchEmpty();
+            const bool neverFull = emptyBefore && emptyAfter &&
+                emptyAfter.TrailingZeros() + emptyBefore.LeadingZeros() < Group::Width;
+            SetControl(slot, neverFull ? flat_hash_map_detail::kEmpty : flat_hash_map_detail::kDeleted);
+            if (neverFull)
+                ++growthLeft_;
+        }
+
+        // Doubles the table, or rebuilds it at the same size when deleted
+        // slots rather than live entries used up the growth budget.
+        void Grow()
+        {
+            if (capacity_ == 0)
+                Resize(Group::Width);
+            else if (size_ * 32 <= capacity_ * 25)
+                Resize(capacity_);
+            else
+                Resize(capacity_ * 2);
+        }
+
+        void Resize(const size_type capacity)
+        {
+            Control* oldControl = control_;
+            value_type* oldSlots = slots_;
+            const size_type oldCapacity = capacity_;
+
+            if (capacity == 0)
+            {
+                control_ = nullptr;
+                slots_ = nullptr;
+                capacity_ = 0;
+                growthLeft_ = 0;
+            }
+            else
+            {
+                const size_type offset = SlotOffset(capacity);
+                auto* memory = static_cast<unsigned char*>(
+                    ::operator new(offset + capacity * sizeof(value_type), Alignment()));
+                control_ = reinterpret_cast<Control*>(memory);
+                slots_ = reinterpret_cast<value_type*>(memory + offset);
+                capacity_ = capacity;
+                ResetControl();
+            }
+
+            if (!oldControl)
+                return;
+            size_type moved = 0;
+            for (size_type slot = 0; slot < oldCapacity; ++slot)
+            {
+                if (oldControl[slot] < 0)
+                    continue;
+                auto& entry = oldSlots[slot];
+                const std::uint64_t hash = Hash(entry.first);
+                const size_type target = FindFree(hash);
+                // Keys are const only to callers; the old slot is destroyed
+                // right after, so moving out of it is safe.
+                ::new (static_cast<void*>(slots_ + target)) value_type(
+                    std::move(const_cast<key_type&>(entry.first)), std::move(entry.second));
+                SetControl(target, ControlByte(hash));
+                std::destroy_at(&entry);
+                ++moved;
+            }
+            size_ = moved;
+            growthLeft_ -= moved;
+            ::operator delete(oldControl, Alignment());
+        }
+
+        void ResetControl() noexcept
+        {
+            if (!control_)
+                return;
+            std::fill_n(control_, capacity_ + Group::Width, flat_hash_map_detail::kEmpty);
+            size_ = 0;
+            growthLeft_ = MaxGrowth(capacity_);
+        }
+
+        void DestroySlots() noexcept
+        {
+            if constexpr (!std::is_trivially_destructible_v<value_type>)
+            {
+                for (size_type slot = 0; slot < capacity_ && size_ != 0; ++slot)
+                {
+                    if (control_[slot] >= 0)
+                        std::destroy_at(slots_ + slot);
+                }
+            }
+        }
+
+        void Release() noexcept
+        {
+            if (!control_)
+                return;
+            DestroySlots();
+            ::operator delete(control_, Alignment());
+            control_ = nullptr;
+            slots_ = nullptr;
+            capacity_ = 0;
+            size_ = 0;
+            growthLeft_ = 0;
+        }
+
+        Control* control_ = nullptr;
+        value_type* slots_ = nullptr;
+        size_type capacity_ = 0;
+        size_type size_ = 0;
+        size_type growthLeft_ = 0;
+        [[no_unique_address]] THash hash_{};
+        [[no_unique_address]] TKeyEqual equal_{};
+    };
+}
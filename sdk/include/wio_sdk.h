@@ -23,7 +23,9 @@
 #include <vector>
 
 #include "module_api.h"
+#include "wio_btree_map.h"
 #include "wio_features.h"
+#include "wio_flat_hash_map.h"
 #include "wio_values.h"
 
 #if defined(_WIN32)
@@ -32,6 +34,11 @@
 #include <dlfcn.h>
 #endif
 
+#if defined(__linux__)
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
 namespace wio
 {
     using String = std::string;
@@ -60,10 +67,10 @@ namespace wio
     using SArray = std::array<T, N>;
 
     template <typename K, typename V>
-    using Dict = std::unordered_map<K, V>;
+    using Dict = FlatHashMap<K, V>;
 
     template <typename K, typename V>
-    using Tree = std::map<K, V>;
+    using Tree = BTreeMap<K, V>;
 }
 
 namespace wio::sdk
@@ -1549,6 +1556,13 @@ namespace wio::sdk
             using Value = TValue;
         };
 
+        template <typename TKey, typename TValue, typename THash, typename TEqual>
+        struct IsStdUnorderedMap<FlatHashMap<TKey, TValue, THash, TEqual>> : std::true_type
+        {
+            using Key = TKey;
+            using Value = TValue;
+        };
+
         template <typename T>
         struct IsStdMap : std::false_type
         {
@@ -1561,6 +1575,13 @@ namespace wio::sdk
             using Value = TValue;
         };
 
+        template <typename TKey, typename TValue, typename TCompare>
+        struct IsStdMap<BTreeMap<TKey, TValue, TCompare>> : std::true_type
+        {
+            using Key = TKey;
+            using Value = TValue;
+        };
+
         template <typename T>
         struct IsStdFunction : std::false_type
         {
@@ -6521,6 +6542,105 @@ namespace wio::sdk
         std::shared_ptr<detail::BindingState> bindingState_{};
     };
 
+    namespace detail
+    {
+        // Tells whether a library file may have changed since the watch was
+        // opened, through inotify on its directory. The SDK does not link
+        // the Wio runtime, so this is a minimal copy of std::os's watcher.
+        // An inactive watch (other platforms, inotify unavailable) answers
+        // every check with "maybe" and callers stat the file as before.
+        class LibraryChangeWatch
+        {
+        public:
+            LibraryChangeWatch() = default;
+
+            explicit LibraryChangeWatch(const std::filesystem::path& file)
+            {
+#if defined(__linux__)
+                fd_ = ::inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+                if (fd_ < 0)
+                    return;
+                constexpr std::uint32_t mask = IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE | IN_DELETE | IN_ATTRIB |
+                                               IN_DELETE_SELF | IN_MOVE_SELF | IN_ONLYDIR;
+                if (::inotify_add_watch(fd_, file.parent_path().c_str(), mask) < 0)
+                {
+                    ::close(fd_);
+                    fd_ = -1;
+                    return;
+                }
+                name_ = file.filename().string();
+#else
+                static_cast<void>(file);
+#endif
+            }
+
+            LibraryChangeWatch(LibraryChangeWatch&& other) noexcept
+                : fd_(std::exchange(other.fd_, -1)), name_(std::move(other.name_))
+            {
+            }
+
+            LibraryChangeWatch& operator=(LibraryChangeWatch&& other) noexcept
+            {
+                if (this != &other)
+                {
+                    reset();
+                    fd_ = std::exchange(other.fd_, -1);
+                    name_ = std::move(other.name_);
+                }
+                return *this;
+            }
+
+            LibraryChangeWatch(const LibraryChangeWatch&) = delete;
+            LibraryChangeWatch& operator=(const LibraryChangeWatch&) = delete;
+
+            ~LibraryChangeWatch() { reset(); }
+
+            // Drains pending events without blocking. False only when the
+            // watch is active and nothing touched the file.
+            [[nodiscard]] bool mayHaveChanged()
+            {
+#if defined(__linux__)
+                if (fd_ < 0)
+                    return true;
+                bool touched = false;
+                alignas(inotify_event) char buffer[4096];
+                while (true)
+                {
+                    const ssize_t length = ::read(fd_, buffer, sizeof(buffer));
+                    if (length <= 0)
+                        break;
+                    for (ssize_t offset = 0; offset < length;)
+                    {
+                        const auto* event = reinterpret_cast<const inotify_event*>(buffer + offset);
+                        // Overflow, or the directory itself went away.
+                        if ((event->mask & (IN_Q_OVERFLOW | IN_IGNORED | IN_DELETE_SELF | IN_MOVE_SELF)) != 0 ||
+                            (event->len > 0 && name_ == event->name))
+                        {
+                            touched = true;
+                        }
+                        offset += static_cast<ssize_t>(sizeof(inotify_event) + event->len);
+                    }
+                }
+                return touched;
+#else
+                return true;
+#endif
+            }
+
+        private:
+            void reset() noexcept
+            {
+#if defined(__linux__)
+                if (fd_ >= 0)
+                    ::close(std::exchange(fd_, -1));
+#endif
+            }
+
+            int fd_ = -1;
+            std::string name_;
+        };
+    }
+
     struct HotReloadOptions
     {
         std::filesystem::path stagingDirectory{};
@@ -6569,6 +6689,7 @@ namespace wio::sdk
         void set_source_path(const std::filesystem::path& libraryPath)
         {
             sourcePath_ = std::filesystem::absolute(libraryPath).make_preferred();
+            changeWatch_ = {};
         }
 
         [[nodiscard]] const std::filesystem::path& source_path() const noexcept
@@ -6596,9 +6717,11 @@ namespace wio::sdk
             module_.validate_api();
         }
 
+        // Auto-reload calls this before every bound export call, so on Linux
+        // the no-change case is one non-blocking inotify read, not two stats.
         bool reload_if_changed()
         {
-            if (sourcePath_.empty() || !std::filesystem::exists(sourcePath_))
+            if (sourcePath_.empty() || !changeWatch_.mayHaveChanged() || !std::filesystem::exists(sourcePath_))
                 return false;
 
             const auto writeTime = std::filesystem::last_write_time(sourcePath_);
@@ -6768,6 +6891,9 @@ namespace wio::sdk
 
         void loadFresh(bool allowRestore)
         {
+            // Opened before the library is staged so a write during the load
+            // is seen by the next reload_if_changed.
+            detail::LibraryChangeWatch changeWatch(sourcePath_);
             std::optional<std::int32_t> snapshot;
             if (allowRestore && options_.preserveState && module_.supports_save_state())
                 snapshot = module_.save_state();
@@ -6790,6 +6916,7 @@ namespace wio::sdk
 
             module_ = std::move(nextModule);
             lastLoadedWriteTime_ = std::filesystem::last_write_time(sourcePath_);
+            changeWatch_ = std::move(changeWatch);
             pruneStagedArtifacts();
         }
 
@@ -6797,6 +6924,7 @@ namespace wio::sdk
         HotReloadOptions options_;
         Module module_;
         std::filesystem::file_time_type lastLoadedWriteTime_{};
+        detail::LibraryChangeWatch changeWatch_;
         bool autoReloadEnabled_ = false;
         std::uint64_t generation_ = 0;
         std::vector<std::filesystem::path> stagedArtifacts_;
@@ -0,0 +1,147 @@
+#include "std_async_fs.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+namespace
+{
+    using wio::runtime::AsyncTask;
+    namespace async_fs = wio::runtime::std_async_fs;
+    using Clock = std::chrono::steady_clock;
+
+    void Require(const bool condition, const char* message)
+    {
+        if (!condition)
+            throw std::runtime_error(message);
+    }
+
+    std::size_t ReadCount(const char* name, const std::size_t fallback)
+    {
+        const char* value = std::getenv(name);
+        if (!value || !*value)
+            return fallback;
+        const auto parsed = std::strtoull(value, nullptr, 10);
+        return parsed == 0 ? fallback : static_cast<std::size_t>(parsed);
+    }
+
+    // Reference for the retired string channel: the completion was appended
+    // into a length-prefixed payload and substr-copied back out on decode.
+    std::string EncodeLegacy(const async_fs::OperationResult& result)
+    {
+        std::string payload("WAF1", 4);
+        payload.push_back(result.succeeded ? '\1' : '\0');
+        const auto size = static_cast<std::uint64_t>(result.text.size());
+        for (unsigned shift = 0; shift < 64; shift += 8)
+            payload.push_back(static_cast<char>((size >> shift) & 0xffu));
+        payload.append(result.text);
+        return payload;
+    }
+
+    std::string DecodeLegacy(const std::string& payload)
+    {
+        Require(payload.size() >= 13 && payload.compare(0, 4, "WAF1") == 0, "legacy payload header");
+        std::uint64_t size = 0;
+        for (unsigned shift = 0; shift < 64; shift += 8)
+            size |= static_cast<std::uint64_t>(static_cast<unsigned char>(payload[5 + shift / 8])) << shift;
+        return payload.substr(13, static_cast<std::size_t>(size));
+    }
+
+    AsyncTask<std::string> ReadTextLegacy(const std::string path)
+    {
+        std::function<async_fs::OperationResult()> operation = [path]
+        {
+            async_fs::OperationResult result;
+            result.succeeded = wio::runtime::std_fs::TryReadTextResult(
+                path, result.text, result.error, result.nativeError, result.message);
+            return result;
+        };
+        auto task = wio::runtime::RunIoAsync<async_fs::OperationResult>(std::move(operation));
+        const auto result = co_await task;
+        co_return EncodeLegacy(result);
+    }
+
+    double MeasureLegacy(const std::string& path, const std::size_t operations, const std::size_t expectedSize)
+    {
+        const auto started = Clock::now();
+        for (std::size_t index = 0; index < operations; ++index)
+        {
+            const auto payload = wio::runtime::BlockOn(ReadTextLegacy(path));
+            const auto text = DecodeLegacy(payload);
+            Require(text.size() == expectedSize, "legacy payload size");
+        }
+        const auto elapsed = std::chrono::duration<double>(Clock::now() - started).count();
+        return static_cast<double>(operations) / std::max(elapsed, 1e-9);
+    }
+
+    double MeasureTyped(const std::string& path, const std::size_t operations, const std::size_t expectedSize)
+    {
+        const auto started = Clock::now();
+        for (std::size_t index = 0; index < operations; ++index)
+        {
+            auto completion = wio::runtime::BlockOn(async_fs::ReadText(path));
+            bool succeeded = false;
+            std::string text;
+            std::int32_t error = 0;
+            std::int64_t nativeError = 0;
+            std::string message;
+            async_fs::DecodeText(completion, succeeded, text, error, nativeError, message);
+            Require(succeeded && text.size() == expectedSize, "typed completion size");
+            Require(async_fs::detail::Take(completion).text.empty(),
+                "typed completion moves its buffer to the consumer");
+        }
+        const auto elapsed = std::chrono::duration<double>(Clock::now() - started).count();
+        return static_cast<double>(operations) / std::max(elapsed, 1e-9);
+    }
+}
+
+int main()
+{
+    try
+    {
+        const auto operations = ReadCount("WIO_ASYNC_COMPLETION_OPERATIONS", 2000);
+        const std::size_t payloadSize = 64 * 1024;
+        const auto path = (std::filesystem::temp_directory_path() /
+            ("wio_async_completion_" + std::to_string(
+                Clock::now().time_since_epoch().count()) + ".txt")).string();
+        {
+            std::ofstream output(path, std::ios::binary);
+            output << std::string(payloadSize, 'w');
+        }
+
+        const auto legacy = MeasureLegacy(path, operations, payloadSize);
+        const auto typed = MeasureTyped(path, operations, payloadSize);
+        std::filesystem::remove(path);
+        std::cout << "read_text payload=" << payloadSize << " operations=" << operations
+                  << " string_channel_ops=" << static_cast<std::uint64_t>(legacy)
+                  << " typed_channel_ops=" << static_cast<std::uint64_t>(typed) << '\n';
+
+        auto mismatched = wio::runtime::MakeAsyncCompletion(std::string("not-a-result"));
+        bool rejected = false;
+        try
+        {
+            static_cast<void>(async_fs::detail::Take(mismatched));
+        }
+        catch (const std::invalid_argument&)
+        {
+            rejected = true;
+        }
+        Require(rejected, "mismatched completion type is rejected");
+
+        wio::runtime::ShutdownAsyncRuntime();
+        std::cout << "async-completion-runtime-stress-ok\n";
+        return 0;
+    }
+    catch (const std::exception& error)
+    {
+        std::cerr << error.what() << '\n';
+        return 1;
+    }
+}
@@ -0,0 +1,258 @@
+#include "std_async_net.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    using wio::runtime::AsyncTask;
+    namespace async_net = wio::runtime::std_async_net;
+    namespace net = wio::runtime::std_net;
+    using Clock = std::chrono::steady_clock;
+
+    void Require(const bool condition, const char* message)
+    {
+        if (!condition)
+            throw std::runtime_error(message);
+    }
+
+    std::size_t ReadCount(const char* name, const std::size_t fallback)
+    {
+        const char* value = std::getenv(name);
+        if (!value || !*value)
+            return fallback;
+        const auto parsed = std::strtoull(value, nullptr, 10);
+        return parsed == 0 ? fallback : static_cast<std::size_t>(parsed);
+    }
+
+    // The pre-reactor shape: every wait holds an I/O executor thread inside a
+    // blocking socket call.
+    AsyncTask<async_net::OperationResult> ThreadedReceive(void* handle)
+    {
+        std::function<async_net::OperationResult()> operation = [handle]
+        {
+            async_net::OperationResult value;
+            value.succeeded = net::Receive(handle, 256, value.bytes, value.error);
+            return value;
+        };
+        auto threaded = async_net::detail::RunThreaded(std::move(operation));
+        auto result = co_await threaded;
+        co_return result;
+    }
+
+    AsyncTask<async_net::OperationResult> ThreadedSend(void* handle, const std::string bytes)
+    {
+        std::function<async_net::OperationResult()> operation = [handle, bytes]
+        {
+            async_net::OperationResult value;
+            value.succeeded = net::Send(handle, bytes, value.count, value.error);
+            return value;
+        };
+        auto threaded = async_net::detail::RunThreaded(std::move(operation));
+        auto result = co_await threaded;
+        co_return result;
+    }
+
+    AsyncTask<async_net::OperationResult> ReceiveOnce(void* handle, const bool reactor)
+    {
+        if (!reactor)
+        {
+            auto threaded = ThreadedReceive(handle);
+            co_return co_await threaded;
+        }
+        auto receive = async_net::Receive(handle, 256);
+        auto completion = co_await receive;
+        co_return std::move(async_net::detail::Take(completion));
+    }
+
+    AsyncTask<async_net::OperationResult> SendOnce(void* handle, const std::string bytes, const bool reactor)
+    {
+        if (!reactor)
+        {
+            auto threaded = ThreadedSend(handle, bytes);
+            co_return co_await threaded;
+        }
+        auto send = async_net::Send(handle, bytes);
+        auto completion = co_await send;
+        co_return std::move(async_net::detail::Take(completion));
+    }
+
+    AsyncTask<void> EchoSession(void* handle, const bool reactor)
+    {
+        for (;;)
+        {
+            auto receive = ReceiveOnce(handle, reactor);
+            const auto received = co_await receive;
+            if (!received.succeeded || received.bytes.empty())
+                break;
+
+            auto send = SendOnce(handle, received.bytes, reactor);
+            const auto sent = co_await send;
+            if (!sent.succeeded)
+                break;
+        }
+        net::Close(handle);
+    }
+
+    AsyncTask<void> AcceptLoop(void* listener, const std::size_t connections, const bool reactor)
+    {
+        std::vector<AsyncTask<void>> sessions;
+        sessions.reserve(connections);
+        for (std::size_t index = 0; index < connections; ++index)
+        {
+            auto accept = async_net::Accept(listener);
+            auto completion = co_await accept;
+            const auto& ready = async_net::detail::Take(completion);
+            Require(ready.succeeded, "listener accept readiness");
+            void* accepted = nullptr;
+            std::string error;
+            Require(net::TcpAccept(listener, accepted, error), "listener accept");
+            sessions.push_back(wio::runtime::StartAsync(EchoSession(accepted, reactor)));
+        }
+        for (const auto& session : sessions)
+            co_await session;
+    }
+
+    void* Connect(const std::uint16_t port)
+    {
+        void* handle = nullptr;
+        std::string error;
+        Require(net::TcpConnect("127.0.0.1", port, 5000, handle, error), "loopback connect");
+        return handle;
+    }
+
+    void RoundTrip(void* client)
+    {
+        std::size_t sent = 0;
+        std::string error;
+        Require(net::Send(client, "ping", sent, error), "client send");
+        std::string reply;
+        Require(net::Receive(client, 256, reply, error), "client receive");
+        Require(reply == "ping", "echo payload");
+    }
+
+    struct EchoReport final
+    {
+        double connectionsPerSecond = 0.0;
+        double p99Microseconds = 0.0;
+    };
+
+    EchoReport RunEcho(const bool reactor, const std::size_t connections)
+    {
+        void* listener = nullptr;
+        std::string error;
+        Require(net::TcpListen("127.0.0.1", 0, 1024, listener, error), "loopback listen");
+        const auto port = net::LocalPort(listener);
+        const auto server = wio::runtime::StartAsync(AcceptLoop(listener, connections, reactor));
+
+        std::vector<double> latencies;
+        latencies.reserve(connections);
+        const auto started = Clock::now();
+        for (std::size_t index = 0; index < connections; ++index)
+        {
+            const auto connectionStarted = Clock::now();
+            void* client = Connect(port);
+            RoundTrip(client);
+            net::Close(client);
+            latencies.push_back(std::chrono::duration<double, std::micro>(
+                Clock::now() - connectionStarted).count());
+        }
+        const auto elapsed = std::chrono::duration<double>(Clock::now() - started).count();
+        Require(wio::runtime::AsyncWaitFor(server, 10000), "echo server drains");
+        net::Close(listener);
+
+        std::sort(latencies.begin(), latencies.end());
+        EchoReport report;
+        report.connectionsPerSecond = static_cast<double>(connections) / std::max(elapsed, 1e-9);
+        report.p99Microseconds = latencies[(latencies.size() - 1) * 99 / 100];
+        return report;
+    }
+
+    bool WaitForParked(const std::uint64_t expected)
+    {
+        const auto deadline = Clock::now() + std::chrono::seconds(10);
+        while (Clock::now() < deadline)
+        {
+            if (net::ReactorPendingCount() >= expected)
+                return true;
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        }
+        return false;
+    }
+
+    // Idle connections must park on the reactor without occupying I/O
+    // workers, so an active connection still completes while they wait.
+    void RunIdle(const std::size_t idleConnections)
+    {
+        void* listener = nullptr;
+        std::string error;
+        Require(net::TcpListen("127.0.0.1", 0, 1024, listener, error), "idle listen");
+        const auto port = net::LocalPort(listener);
+        const auto server = wio::runtime::StartAsync(AcceptLoop(listener, idleConnections + 1, true));
+
+        std::vector<void*> idle;
+        idle.reserve(idleConnections);
+        for (std::size_t index = 0; index < idleConnections; ++index)
+            idle.push_back(Connect(port));
+        // Accept keeps one waiter parked on the listener until the last
+        // connection arrives.
+        Require(WaitForParked(idleConnections + 1), "idle connections park on the reactor");
+        Require(wio::runtime::AsyncIoPendingCount() == 0, "idle connections leave the I/O queue empty");
+
+        void* active = Connect(port);
+        RoundTrip(active);
+        net::Close(active);
+
+        for (void* client : idle)
+            net::Close(client);
+        Require(wio::runtime::AsyncWaitFor(server, 10000), "idle server drains");
+        net::Close(listener);
+        Require(net::ReactorPendingCount() == 0, "reactor releases every waiter");
+    }
+}
+
+int main()
+{
+    try
+    {
+        if (!net::ReactorAvailable())
+        {
+            std::cout << "async-net-reactor-stress-skipped\n";
+            return 0;
+        }
+
+        const auto connections = ReadCount("WIO_NET_BENCH_CONNECTIONS", 512);
+        const auto idleConnections = ReadCount("WIO_NET_BENCH_IDLE", 256);
+        const auto baselineSockets = net::LiveSocketCount();
+
+        const auto threaded = RunEcho(false, connections);
+        const auto reactor = RunEcho(true, connections);
+        std::cout << "echo connections=" << connections
+                  << " threaded_cps=" << static_cast<std::uint64_t>(threaded.connectionsPerSecond)
+                  << " threaded_p99_us=" << static_cast<std::uint64_t>(threaded.p99Microseconds)
+                  << " reactor_cps=" << static_cast<std::uint64_t>(reactor.connectionsPerSecond)
+                  << " reactor_p99_us=" << static_cast<std::uint64_t>(reactor.p99Microseconds)
+                  << '\n';
+
+        RunIdle(idleConnections);
+        std::cout << "idle connections=" << idleConnections
+                  << " io_workers=" << wio::runtime::AsyncIoWorkerCount() << '\n';
+
+        Require(net::LiveSocketCount() == baselineSockets, "every socket state is reclaimed");
+        wio::runtime::ShutdownAsyncRuntime();
+        std::cout << "async-net-reactor-stress-ok\n";
+        return 0;
+    }
+    catch (const std::exception& error)
+    {
+        std::cerr << error.what() << '\n';
+        return 1;
+    }
+}
@@ -0,0 +1,266 @@
+#include "std_async_process.h"
+#include "std_process.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <ctime>
+#include <filesystem>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    using wio::runtime::AsyncTask;
+    namespace async_process = wio::runtime::std_async_process;
+    namespace process = wio::runtime::std_process;
+    using Clock = std::chrono::steady_clock;
+
+    void Require(const bool condition, const char* message)
+    {
+        if (!condition)
+            throw std::runtime_error(message);
+    }
+
+    std::size_t ReadCount(const char* name, const std::size_t fallback)
+    {
+        const char* value = std::getenv(name);
+        if (!value || !*value)
+            return fallback;
+        const auto parsed = std::strtoull(value, nullptr, 10);
+        return parsed == 0 ? fallback : static_cast<std::size_t>(parsed);
+    }
+
+    void* Spawn(const std::string& program)
+    {
+        void* handle = nullptr;
+        process::ProcessError error = process::ProcessError::none;
+        int nativeError = 0;
+        std::string message;
+        Require(process::Spawn(program, {}, {}, handle, error, nativeError, message), "process spawn");
+        return handle;
+    }
+
+    // The pre-reactor shape: poll the child and sleep 10 ms between attempts.
+    AsyncTask<async_process::OperationResult> PolledWait(void* handle)
+    {
+        while (true)
+        {
+            async_process::OperationResult result;
+            int nativeError = 0;
+            result.succeeded = process::ProcessIsRunning(
+                handle, result.running, result.error, nativeError, result.message);
+            if (!result.succeeded || !result.running)
+            {
+                int exitCode = -1;
+                if (result.succeeded)
+                    result.succeeded = process::ProcessWait(
+                        handle, exitCode, result.error, nativeError, result.message);
+                result.exitCode = exitCode;
+                co_return result;
+            }
+            wio::runtime::AsyncDelayAwaiter delay{std::chrono::milliseconds(10)};
+            co_await delay;
+        }
+    }
+
+    AsyncTask<async_process::OperationResult> PolledRead(void* handle, const std::size_t maximumBytes)
+    {
+        while (true)
+        {
+            async_process::OperationResult result;
+            int nativeError = 0;
+            result.succeeded = process::ProcessTryReadStdout(
+                handle, maximumBytes, result.output, result.eof,
+                result.error, nativeError, result.message);
+            if (!result.succeeded || result.eof || !result.output.empty())
+                co_return result;
+            wio::runtime::AsyncDelayAwaiter delay{std::chrono::milliseconds(10)};
+            co_await delay;
+        }
+    }
+
+    AsyncTask<async_process::OperationResult> WaitOnce(void* handle, const bool reactor)
+    {
+        if (!reactor)
+        {
+            auto polled = PolledWait(handle);
+            co_return co_await polled;
+        }
+        auto wait = async_process::Wait(handle);
+        auto completion = co_await wait;
+        co_return std::move(async_process::detail::Take(completion));
+    }
+
+    AsyncTask<async_process::OperationResult> ReadOnce(void* handle, const bool reactor)
+    {
+        if (!reactor)
+        {
+            auto polled = PolledRead(handle, 1u << 16u);
+            co_return co_await polled;
+        }
+        auto read = async_process::ReadStdout(handle, 1u << 16u);
+        auto completion = co_await read;
+        co_return std::move(async_process::detail::Take(completion));
+    }
+
+    struct Report final
+    {
+        double wallSeconds = 0.0;
+        double cpuSeconds = 0.0;
+    };
+
+    template <typename Body>
+    Report Measure(Body&& body)
+    {
+        const auto started = Clock::now();
+        const std::clock_t cpuStarted = std::clock();
+        body();
+        Report report;
+        report.cpuSeconds = static_cast<double>(std::clock() - cpuStarted) / CLOCKS_PER_SEC;
+        report.wallSeconds = std::chrono::duration<double>(Clock::now() - started).count();
+        return report;
+    }
+
+    AsyncTask<void> SpawnSequence(const std::size_t children, const bool reactor)
+    {
+        for (std::size_t index = 0; index < children; ++index)
+        {
+            void* child = Spawn("/bin/true");
+            auto wait = WaitOnce(child, reactor);
+            const auto result = co_await wait;
+            Require(result.succeeded && result.exitCode == 0, "child exits cleanly");
+            process::ProcessClose(child);
+        }
+    }
+
+    AsyncTask<std::size_t> DrainStdout(void* handle, const bool reactor)
+    {
+        std::size_t total = 0;
+        for (;;)
+        {
+            auto read = ReadOnce(handle, reactor);
+            const auto result = co_await read;
+            Require(result.succeeded, "stdout read");
+            if (result.eof)
+                break;
+            total += result.output.size();
+        }
+        co_return total;
+    }
+
+    void StreamThroughCat(const std::size_t megabytes, const bool reactor)
+    {
+        void* child = Spawn("/bin/cat");
+        std::thread writer([child, megabytes]
+        {
+            const std::string chunk(1u << 20u, 'w');
+            process::ProcessError error = process::ProcessError::none;
+            int nativeError = 0;
+            std::string message;
+            for (std::size_t index = 0; index < megabytes; ++index)
+            {
+                std::size_t written = 0;
+                if (!process::ProcessWriteStdin(child, chunk, written, error, nativeError, message))
+                    break;
+            }
+            static_cast<void>(process::ProcessCloseStdin(child, error, nativeError, message));
+        });
+        auto drain = DrainStdout(child, reactor);
+        const std::size_t total = wio::runtime::BlockOn(drain);
+        writer.join();
+        Require(total == megabytes * (1u << 20u), "cat echoes every byte");
+        auto wait = WaitOnce(child, reactor);
+        Require(wio::runtime::BlockOn(wait).exitCode == 0, "cat exits cleanly");
+        process::ProcessClose(child);
+    }
+
+    bool ExitWatchAvailable()
+    {
+        void* child = Spawn("/bin/true");
+        const auto token = process::ProcessWatch(child, process::ProcessEvent::exited, [] {});
+        process::ProcessCancelWatch(token);
+        process::ProcessClose(child);
+        return token != 0;
+    }
+
+    // A watch parked on a live child must be woken by ProcessClose, not left
+    // on the reactor.
+    void CloseWakesParkedWaiters()
+    {
+        void* child = Spawn("/bin/cat");
+        auto read = async_process::ReadStdout(child, 64);
+        auto wait = async_process::Wait(child);
+        const auto deadline = Clock::now() + std::chrono::seconds(10);
+        while (process::ProcessWatchPendingCount() < 2 && Clock::now() < deadline)
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        Require(process::ProcessWatchPendingCount() == 2, "pipe and exit waits park on the reactor");
+        process::ProcessClose(child);
+        auto readCompletion = wio::runtime::BlockOn(read);
+        Require(async_process::detail::Take(readCompletion).error == process::ProcessError::process_closed,
+            "close wakes a parked pipe read");
+        static_cast<void>(wio::runtime::BlockOn(wait));
+        Require(process::ProcessWatchPendingCount() == 0, "close releases every waiter");
+    }
+
+    void Print(const char* name, const Report& polled, const Report& reactor)
+    {
+        std::cout << name
+                  << " polled_wall_ms=" << static_cast<std::uint64_t>(polled.wallSeconds * 1000.0)
+                  << " polled_cpu_ms=" << static_cast<std::uint64_t>(polled.cpuSeconds * 1000.0)
+                  << " reactor_wall_ms=" << static_cast<std::uint64_t>(reactor.wallSeconds * 1000.0)
+                  << " reactor_cpu_ms=" << static_cast<std::uint64_t>(reactor.cpuSeconds * 1000.0)
+                  << '\n';
+    }
+}
+
+int main()
+{
+    try
+    {
+        if (!std::filesystem::exists("/bin/true") || !std::filesystem::exists("/bin/cat") ||
+            !ExitWatchAvailable())
+        {
+            std::cout << "async-process-reactor-stress-skipped\n";
+            return 0;
+        }
+
+        const auto children = ReadCount("WIO_PROCESS_BENCH_CHILDREN", 1000);
+        const auto megabytes = ReadCount("WIO_PROCESS_BENCH_MEGABYTES", 100);
+        const auto baseline = process::LiveProcessCount();
+
+        const auto polledSpawn = Measure([&]
+        {
+            auto sequence = SpawnSequence(children, false);
+            wio::runtime::BlockOn(sequence);
+        });
+        const auto reactorSpawn = Measure([&]
+        {
+            auto sequence = SpawnSequence(children, true);
+            wio::runtime::BlockOn(sequence);
+        });
+        std::cout << "spawn children=" << children << ' ';
+        Print("/bin/true", polledSpawn, reactorSpawn);
+
+        const auto polledStream = Measure([&] { StreamThroughCat(megabytes, false); });
+        const auto reactorStream = Measure([&] { StreamThroughCat(megabytes, true); });
+        std::cout << "stream megabytes=" << megabytes << ' ';
+        Print("/bin/cat", polledStream, reactorStream);
+
+        CloseWakesParkedWaiters();
+        Require(process::ProcessWatchPendingCount() == 0, "reactor releases every waiter");
+        Require(process::LiveProcessCount() == baseline, "every process state is reclaimed");
+        wio::runtime::ShutdownAsyncRuntime();
+        std::cout << "async-process-reactor-stress-ok\n";
+        return 0;
+    }
+    catch (const std::exception& error)
+    {
+        wio::runtime::ShutdownAsyncRuntime();
+        std::cerr << "async process reactor stress failed: " << error.what() << '\n';
+        return 1;
+    }
+}
@@ -0,0 +1,155 @@
+#include "std_async.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    using wio::runtime::AsyncScheduler;
+    using wio::runtime::AsyncTask;
+    using Clock = std::chrono::steady_clock;
+
+    void Require(const bool condition, const char* message)
+    {
+        if (!condition)
+            throw std::runtime_error(message);
+    }
+
+    std::size_t ReadCount(const char* name, const std::size_t fallback)
+    {
+        const char* value = std::getenv(name);
+        if (!value || !*value)
+            return fallback;
+        const auto parsed = std::strtoull(value, nullptr, 10);
+        return parsed == 0 ? fallback : static_cast<std::size_t>(parsed);
+    }
+
+    // Binary fan-out: every task posts up to two children from inside a
+    // worker, which exercises the LIFO slot, local run queues, and stealing.
+    struct Fanout final
+    {
+        AsyncScheduler& scheduler;
+        std::atomic<std::size_t> remaining;
+        std::mutex mutex;
+        std::condition_variable finished;
+        bool done = false;
+
+        void Run(const std::size_t budget)
+        {
+            const auto children = budget - 1;
+            const auto left = children / 2;
+            const auto right = children - left;
+            if (left != 0)
+                Require(scheduler.Post([this, left] { Run(left); }), "fan-out post");
+            if (right != 0)
+                Require(scheduler.Post([this, right] { Run(right); }), "fan-out post");
+            if (remaining.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            {
+                std::lock_guard lock(mutex);
+                done = true;
+                finished.notify_all();
+            }
+        }
+    };
+
+    double MeasureFanout(const std::size_t workers, const std::size_t tasks)
+    {
+        AsyncScheduler scheduler(workers);
+        Fanout fanout{scheduler, tasks};
+        const auto started = Clock::now();
+        Require(scheduler.Post([&fanout, tasks] { fanout.Run(tasks); }), "fan-out root");
+        {
+            std::unique_lock lock(fanout.mutex);
+            Require(fanout.finished.wait_for(lock, std::chrono::seconds(30), [&fanout] { return fanout.done; }),
+                "fan-out completes");
+        }
+        const auto elapsed = std::chrono::duration<double>(Clock::now() - started).count();
+        scheduler.Shutdown();
+        Require(scheduler.PendingCount() == 0, "scheduler drains on shutdown");
+        return static_cast<double>(tasks) / std::max(elapsed, 1e-9);
+    }
+
+    AsyncTask<int> YieldingChild(const int value)
+    {
+        co_await wio::runtime::AsyncYield();
+        co_return value;
+    }
+
+    double MeasureWhenAll(const std::size_t tasks)
+    {
+        std::vector<AsyncTask<int>> children;
+        children.reserve(tasks);
+        const auto started = Clock::now();
+        for (std::size_t index = 0; index < tasks; ++index)
+            children.push_back(YieldingChild(static_cast<int>(index % 7)));
+        const auto values = wio::runtime::BlockOn(wio::runtime::WhenAll(std::move(children)));
+        const auto elapsed = std::chrono::duration<double>(Clock::now() - started).count();
+        Require(values.size() == tasks, "WhenAll result count");
+        for (std::size_t index = 0; index < tasks; ++index)
+            Require(values[index] == static_cast<int>(index % 7), "WhenAll preserves order");
+        return static_cast<double>(tasks) / std::max(elapsed, 1e-9);
+    }
+
+    void VerifyTimersAndShutdown()
+    {
+        AsyncScheduler scheduler(2);
+        std::atomic<int> fired{0};
+        auto cancelled = scheduler.PostAfter(std::chrono::milliseconds(1), [&fired] { fired += 100; });
+        Require(static_cast<bool>(cancelled), "timer arms");
+        Require(cancelled->Cancel(), "armed timer cancels");
+        Require(static_cast<bool>(scheduler.PostAfter(std::chrono::milliseconds(2), [&fired] { ++fired; })),
+            "second timer arms");
+        const auto deadline = Clock::now() + std::chrono::seconds(5);
+        while (fired.load() == 0 && Clock::now() < deadline)
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        Require(fired.load() == 1, "cancelled timer is skipped and live timer fires");
+
+        // Shutdown releases delayed work immediately instead of waiting it out.
+        Require(static_cast<bool>(scheduler.PostAfter(std::chrono::hours(1), [&fired] { ++fired; })),
+            "long timer arms");
+        const auto shutdownStarted = Clock::now();
+        scheduler.Shutdown();
+        Require(Clock::now() - shutdownStarted < std::chrono::seconds(5), "shutdown drains timers promptly");
+        Require(fired.load() == 2, "shutdown runs pending timers");
+        Require(!scheduler.Post([] {}), "stopped scheduler rejects work");
+    }
+}
+
+int main()
+{
+    try
+    {
+        const auto tasks = ReadCount("WIO_ASYNC_BENCH_TASKS", 200000);
+        const auto hardware = std::max<std::size_t>(2, std::thread::hardware_concurrency());
+        const auto maximumWorkers = ReadCount("WIO_ASYNC_BENCH_MAX_WORKERS", hardware);
+
+        for (std::size_t workers = 2; workers <= maximumWorkers; workers *= 2)
+        {
+            std::cout << "fanout workers=" << workers << " tasks=" << tasks
+                      << " tasks_per_sec=" << static_cast<std::uint64_t>(MeasureFanout(workers, tasks)) << '\n';
+        }
+
+        const auto fanIn = std::min<std::size_t>(tasks, 20000);
+        std::cout << "when_all workers=" << wio::runtime::AsyncWorkerCount() << " tasks=" << fanIn
+                  << " tasks_per_sec=" << static_cast<std::uint64_t>(MeasureWhenAll(fanIn)) << '\n';
+
+        VerifyTimersAndShutdown();
+        wio::runtime::ShutdownAsyncRuntime();
+        std::cout << "async-scheduler-runtime-stress-ok\n";
+        return 0;
+    }
+    catch (const std::exception& error)
+    {
+        std::cerr << error.what() << '\n';
+        return 1;
+    }
+}
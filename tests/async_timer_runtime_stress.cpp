@@ -0,0 +1,190 @@
+#include "std_async.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+#include <unistd.h>
+#endif
+
+namespace
+{
+    using wio::runtime::AsyncScheduler;
+    using wio::runtime::AsyncTask;
+    using Clock = std::chrono::steady_clock;
+
+    void Require(const bool condition, const char* message)
+    {
+        if (!condition)
+            throw std::runtime_error(message);
+    }
+
+    std::size_t ReadCount(const char* name, const std::size_t fallback)
+    {
+        const char* value = std::getenv(name);
+        if (!value || !*value)
+            return fallback;
+        const auto parsed = std::strtoull(value, nullptr, 10);
+        return parsed == 0 ? fallback : static_cast<std::size_t>(parsed);
+    }
+
+    std::uint64_t ResidentKilobytes()
+    {
+#if defined(__linux__)
+        std::ifstream statm("/proc/self/statm");
+        std::uint64_t size = 0;
+        std::uint64_t resident = 0;
+        if (statm >> size >> resident)
+            return resident * static_cast<std::uint64_t>(sysconf(_SC_PAGESIZE)) / 1024;
+#endif
+        return 0;
+    }
+
+    // The server pattern from the wheel's motivation: every request arms a
+    // long timeout and almost all of them are cancelled before expiring.
+    void MeasureArmCancel(const std::size_t timers)
+    {
+        AsyncScheduler scheduler(2);
+        std::atomic<std::size_t> fired{0};
+        std::vector<std::shared_ptr<AsyncScheduler::Timer>> handles;
+        handles.reserve(timers);
+        const auto baseline = ResidentKilobytes();
+
+        const auto armStarted = Clock::now();
+        for (std::size_t index = 0; index < timers; ++index)
+        {
+            // Spread deadlines across several wheel levels.
+            const auto delay = std::chrono::milliseconds(30000 + static_cast<std::int64_t>(index % 4096) * 97);
+            handles.push_back(scheduler.PostAfter(delay, [&fired] { ++fired; }));
+        }
+        const auto armSeconds = std::chrono::duration<double>(Clock::now() - armStarted).count();
+        Require(scheduler.TimerCount() == timers, "every timer is armed");
+        const auto armed = ResidentKilobytes();
+
+        const auto cancelStarted = Clock::now();
+        for (const auto& handle : handles)
+            Require(handle->Cancel(), "armed timer cancels");
+        const auto cancelSeconds = std::chrono::duration<double>(Clock::now() - cancelStarted).count();
+        Require(scheduler.TimerCount() == 0, "cancel removes timers from the wheel");
+        Require(scheduler.PendingCount() == 0, "cancelled timers are not pending");
+        Require(!handles.front()->Cancel(), "second cancel is a no-op");
+        handles.clear();
+        handles.shrink_to_fit();
+        const auto released = ResidentKilobytes();
+
+        scheduler.Shutdown();
+        Require(fired.load() == 0, "cancelled timers never fire");
+
+        std::cout << "arm_cancel timers=" << timers
+                  << " arm_per_sec=" << static_cast<std::uint64_t>(static_cast<double>(timers) / std::max(armSeconds, 1e-9))
+                  << " cancel_per_sec=" << static_cast<std::uint64_t>(static_cast<double>(timers) / std::max(cancelSeconds, 1e-9))
+                  << " rss_baseline_kb=" << baseline
+                  << " rss_armed_kb=" << armed
+                  << " rss_after_cancel_kb=" << released
+                  << " wheel_timers_after_cancel=" << scheduler.TimerCount() << '\n';
+    }
+
+    // Deadlines on level 0 and level 1 must fire, and never early.
+    void VerifyDeadlines()
+    {
+        AsyncScheduler scheduler(2);
+        constexpr std::size_t timers = 400;
+        std::vector<std::int64_t> lateness(timers, -1);
+        std::atomic<std::size_t> fired{0};
+        std::vector<std::shared_ptr<AsyncScheduler::Timer>> handles;
+        const auto started = Clock::now();
+        for (std::size_t index = 0; index < timers; ++index)
+        {
+            const auto delay = std::chrono::milliseconds(static_cast<std::int64_t>(index % 200));
+            auto timer = scheduler.PostAfter(delay, [&, index, delay]
+            {
+                lateness[index] = std::chrono::duration_cast<std::chrono::milliseconds>(
+                    Clock::now() - started - delay).count();
+                ++fired;
+            });
+            Require(static_cast<bool>(timer), "deadline timer arms");
+            handles.push_back(std::move(timer));
+        }
+        // A zero-delay timer may already have run; only a successful cancel
+        // has to stay silent.
+        std::vector<bool> silenced(timers, false);
+        std::size_t expected = timers;
+        for (std::size_t index = 0; index < timers; index += 5)
+        {
+            silenced[index] = handles[index]->Cancel();
+            expected -= silenced[index] ? 1 : 0;
+        }
+
+        const auto deadline = Clock::now() + std::chrono::seconds(10);
+        while (fired.load() < expected && Clock::now() < deadline)
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        Require(fired.load() == expected, "every live timer fires once");
+        for (std::size_t index = 0; index < timers; ++index)
+        {
+            if (silenced[index])
+                Require(lateness[index] == -1, "cancelled timer stays silent");
+            else
+                Require(lateness[index] >= 0, "timer never fires early");
+        }
+        Require(scheduler.TimerCount() == 0, "fired timers leave the wheel");
+    }
+
+    AsyncTask<int> FastValue()
+    {
+        co_await wio::runtime::AsyncSleep(1);
+        co_return 7;
+    }
+
+    // A timed-out sleep is cancelled and an on-time task removes its timeout,
+    // so neither leaves a timer behind on the default scheduler. Timeout
+    // cancels the task it owns; awaiter cancellation does not reach nested
+    // children, so the slow task is the sleep itself.
+    void VerifyTimeoutsRelease()
+    {
+        bool timedOut = false;
+        try
+        {
+            wio::runtime::BlockOn(wio::runtime::WithTimeout(wio::runtime::AsyncSleep(60000), 5));
+        }
+        catch (const wio::runtime::AsyncTimeout&)
+        {
+            timedOut = true;
+        }
+        Require(timedOut, "slow task times out");
+        Require(wio::runtime::BlockOn(wio::runtime::WithTimeout(FastValue(), 60000)) == 7,
+            "fast task beats its timeout");
+
+        const auto deadline = Clock::now() + std::chrono::seconds(5);
+        while (wio::runtime::DefaultAsyncScheduler().TimerCount() != 0 && Clock::now() < deadline)
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        Require(wio::runtime::DefaultAsyncScheduler().TimerCount() == 0, "timeouts release their timers");
+    }
+}
+
+int main()
+{
+    try
+    {
+        MeasureArmCancel(ReadCount("WIO_ASYNC_TIMER_COUNT", 1000000));
+        VerifyDeadlines();
+        VerifyTimeoutsRelease();
+        wio::runtime::ShutdownAsyncRuntime();
+        std::cout << "async-timer-runtime-stress-ok\n";
+        return 0;
+    }
+    catch (const std::exception& error)
+    {
+        std::cerr << error.what() << '\n';
+        return 1;
+    }
+}
@@ -0,0 +1,294 @@
+#include "std_bigint.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+    using wio::runtime::std_bigint::Words;
+    namespace bigint = wio::runtime::std_bigint;
+    using Clock = std::chrono::steady_clock;
+
+    void Require(const bool condition, const char* message)
+    {
+        if (!condition)
+            throw std::runtime_error(message);
+    }
+
+    std::size_t ReadCount(const char* name, const std::size_t fallback)
+    {
+        const char* value = std::getenv(name);
+        if (!value || !*value)
+            return fallback;
+        const auto parsed = std::strtoull(value, nullptr, 10);
+        return parsed == 0 ? fallback : static_cast<std::size_t>(parsed);
+    }
+
+    double MillisecondsSince(const Clock::time_point started)
+    {
+        return std::chrono::duration<double, std::milli>(Clock::now() - started).count();
+    }
+
+    // The decimal-string engine std::bigint used before the limb engine,
+    // kept here as the correctness oracle and the benchmark baseline.
+    namespace decimal
+    {
+        std::string Normalize(const std::string_view text)
+        {
+            if (text.empty()) return {};
+            std::size_t index = 0;
+            bool negative = false;
+            if (text[index] == '-' || text[index] == '+') { negative = text[index] == '-'; ++index; }
+            if (index == text.size()) return {};
+            for (std::size_t cursor = index; cursor < text.size(); ++cursor)
+                if (text[cursor] < '0' || text[cursor] > '9') return {};
+            while (index < text.size() && text[index] == '0') ++index;
+            if (index == text.size()) return "0";
+            return (negative ? "-" : "") + std::string(text.substr(index));
+        }
+
+        bool Negative(const std::string_view value) noexcept { return value.starts_with('-'); }
+        std::string_view Absolute(const std::string_view value) noexcept { return Negative(value) ? value.substr(1) : value; }
+        int CompareAbsolute(const std::string_view left, const std::string_view right) noexcept
+        {
+            if (left.size() != right.size()) return left.size() < right.size() ? -1 : 1;
+            return left == right ? 0 : (left < right ? -1 : 1);
+        }
+        std::string AddAbsolute(std::string_view left, std::string_view right)
+        {
+            std::string output; output.reserve(std::max(left.size(), right.size()) + 1);
+            std::ptrdiff_t li = static_cast<std::ptrdiff_t>(left.size()) - 1;
+            std::ptrdiff_t ri = static_cast<std::ptrdiff_t>(right.size()) - 1;
+            int carry = 0;
+            while (li >= 0 || ri >= 0 || carry)
+            {
+                const int sum = carry + (li >= 0 ? left[static_cast<std::size_t>(li--)] - '0' : 0) +
+                    (ri >= 0 ? right[static_cast<std::size_t>(ri--)] - '0' : 0);
+                output.push_back(static_cast<char>('0' + sum % 10)); carry = sum / 10;
+            }
+            std::reverse(output.begin(), output.end()); return output;
+        }
+        std::string SubtractAbsolute(std::string_view left, std::string_view right)
+        {
+            std::string output; output.reserve(left.size()); int borrow = 0;
+            std::ptrdiff_t ri = static_cast<std::ptrdiff_t>(right.size()) - 1;
+            for (std::ptrdiff_t li = static_cast<std::ptrdiff_t>(left.size()) - 1; li >= 0; --li)
+            {
+                int digit = left[static_cast<std::size_t>(li)] - '0' - borrow -
+                    (ri >= 0 ? right[static_cast<std::size_t>(ri--)] - '0' : 0);
+                if (digit < 0) { digit += 10; borrow = 1; } else borrow = 0;
+                output.push_back(static_cast<char>('0' + digit));
+            }
+            while (output.size() > 1 && output.back() == '0') output.pop_back();
+            std::reverse(output.begin(), output.end()); return output;
+        }
+        std::string Add(const std::string_view leftText, const std::string_view rightText)
+        {
+            const std::string left = Normalize(leftText), right = Normalize(rightText);
+            if (left.empty() || right.empty()) return {};
+            const bool ln = Negative(left), rn = Negative(right);
+            const auto la = Absolute(left), ra = Absolute(right);
+            if (ln == rn) { const std::string sum = AddAbsolute(la, ra); return ln && sum != "0" ? "-" + sum : sum; }
+            const int comparison = CompareAbsolute(la, ra);
+            if (comparison == 0) return "0";
+            const bool resultNegative = comparison > 0 ? ln : rn;
+            const std::string difference = comparison > 0 ? SubtractAbsolute(la, ra) : SubtractAbsolute(ra, la);
+            return resultNegative ? "-" + difference : difference;
+        }
+        std::string Subtract(const std::string_view left, const std::string_view right)
+        {
+            const std::string normalized = Normalize(right); if (normalized.empty()) return {};
+            return Add(left, Negative(normalized) ? normalized.substr(1) : "-" + normalized);
+        }
+        std::string Multiply(const std::string_view leftText, const std::string_view rightText)
+        {
+            const std::string left = Normalize(leftText), right = Normalize(rightText);
+            if (left.empty() || right.empty()) return {};
+            const auto la = Absolute(left), ra = Absolute(right);
+            if (la == "0" || ra == "0") return "0";
+            std::vector<int> digits(la.size() + ra.size(), 0);
+            for (std::ptrdiff_t li = static_cast<std::ptrdiff_t>(la.size()) - 1; li >= 0; --li)
+                for (std::ptrdiff_t ri = static_cast<std::ptrdiff_t>(ra.size()) - 1; ri >= 0; --ri)
+                {
+                    const std::size_t position = static_cast<std::size_t>(li + ri + 1);
+                    const int product = (la[static_cast<std::size_t>(li)] - '0') * (ra[static_cast<std::size_t>(ri)] - '0') + digits[position];
+                    digits[position] = product % 10; digits[position - 1] += product / 10;
+                }
+            std::string output; std::size_t index = 0; while (index < digits.size() && digits[index] == 0) ++index;
+            if (Negative(left) != Negative(right)) output.push_back('-');
+            for (; index < digits.size(); ++index) output.push_back(static_cast<char>('0' + digits[index]));
+            return output;
+        }
+        std::string Divide(const std::string_view leftText, const std::string_view rightText)
+        {
+            const std::string left = Normalize(leftText), right = Normalize(rightText);
+            if (left.empty() || right.empty() || Absolute(right) == "0") return {};
+            const auto dividend = Absolute(left), divisor = Absolute(right);
+            std::string remainder = "0", quotient;
+            for (const char digit : dividend)
+            {
+                remainder = Normalize((remainder == "0" ? std::string{} : remainder) + digit);
+                int count = 0;
+                while (CompareAbsolute(remainder, divisor) >= 0) { remainder = SubtractAbsolute(remainder, divisor); ++count; }
+                quotient.push_back(static_cast<char>('0' + count));
+            }
+            quotient = Normalize(quotient);
+            if (quotient != "0" && Negative(left) != Negative(right)) quotient.insert(quotient.begin(), '-');
+            return quotient;
+        }
+        std::string Remainder(const std::string_view left, const std::string_view right)
+        {
+            return Subtract(left, Multiply(Divide(left, right), right));
+        }
+        std::string ModPow(std::string base, const std::string_view exponent, const std::string_view modulus)
+        {
+            std::string result = "1";
+            base = Remainder(base, modulus);
+            for (const char digitText : exponent)
+            {
+                // result = result^10 * base^digit (mod modulus), one decimal digit at a time.
+                std::string tenth = result;
+                for (int index = 1; index < 10; ++index) tenth = Remainder(Multiply(tenth, result), modulus);
+                result = tenth;
+                for (int index = 0; index < digitText - '0'; ++index) result = Remainder(Multiply(result, base), modulus);
+            }
+            return result;
+        }
+    }
+
+    std::string RandomDecimal(std::mt19937_64& random, const std::size_t digits, const bool allowNegative)
+    {
+        std::string text;
+        if (allowNegative && (random() & 1u)) text.push_back('-');
+        text.push_back(static_cast<char>('1' + random() % 9));
+        for (std::size_t index = 1; index < digits; ++index)
+            text.push_back(static_cast<char>('0' + random() % 10));
+        return text;
+    }
+
+    // Cross-checks the limb engine against the decimal oracle on sizes that
+    // cover single-limb, schoolbook, and Karatsuba paths.
+    void CheckAgainstDecimal()
+    {
+        std::mt19937_64 random(0x5eed);
+        const std::size_t sizes[] = { 1, 5, 19, 20, 39, 120, 640, 1300 };
+        for (const auto leftDigits : sizes)
+        {
+            for (const auto rightDigits : sizes)
+            {
+                const auto left = RandomDecimal(random, leftDigits, true);
+                const auto right = RandomDecimal(random, rightDigits, true);
+                const auto l = bigint::Parse(left), r = bigint::Parse(right);
+                Require(bigint::ToString(l) == left, "decimal round trip");
+                Require(bigint::ToString(bigint::Add(l, r)) == decimal::Add(left, right), "add matches decimal engine");
+                Require(bigint::ToString(bigint::Subtract(l, r)) == decimal::Subtract(left, right), "subtract matches decimal engine");
+                Require(bigint::ToString(bigint::Multiply(l, r)) == decimal::Multiply(left, right), "multiply matches decimal engine");
+                if (leftDigits <= 640)
+                    Require(bigint::ToString(bigint::Divide(l, r)) == decimal::Divide(left, right), "divide matches decimal engine");
+            }
+        }
+
+        // Division identity well past the oracle's practical size.
+        for (std::size_t round = 0; round < 16; ++round)
+        {
+            const auto dividend = bigint::Parse(RandomDecimal(random, 6000 + round * 97, true));
+            const auto divisor = bigint::Parse(RandomDecimal(random, 40 + round * 181, true));
+            const auto quotient = bigint::Divide(dividend, divisor);
+            const auto remainder = bigint::Remainder(dividend, divisor);
+            Require(bigint::Compare(bigint::Add(bigint::Multiply(quotient, divisor), remainder), dividend) == 0, "q * d + r == n");
+            Require(bigint::Compare(bigint::Absolute(remainder), bigint::Absolute(divisor)) < 0, "|r| < |d|");
+        }
+
+        Require(bigint::Divide(bigint::FromI64(1), bigint::FromI64(0)).empty(), "division by zero is reported");
+        Require(bigint::ToHexString(bigint::ParseHex("-0xDeadBeefCafeBabe0123456789")) == "-deadbeefcafebabe0123456789", "hex round trip");
+        Require(bigint::ToString(bigint::ShiftRight(bigint::FromI64(-5), 1)) == "-3", "shift right floors");
+        Require(bigint::ToString(bigint::BitAnd(bigint::FromI64(-6), bigint::FromI64(7))) == "2", "two's complement and");
+        Require(bigint::ToString(bigint::BitOr(bigint::FromI64(-8), bigint::FromI64(3))) == "-5", "two's complement or");
+        Require(bigint::ToString(bigint::BitXor(bigint::FromI64(-1), bigint::FromI64(5))) == "-6", "two's complement xor");
+        Require(bigint::ToString(bigint::FromI64(INT64_MIN)) == "-9223372036854775808", "i64 minimum");
+    }
+
+    void MeasureFactorial(const std::size_t n, const bool withBaseline)
+    {
+        auto started = Clock::now();
+        Words limbs = bigint::FromI64(1);
+        for (std::size_t factor = 2; factor <= n; ++factor)
+            limbs = bigint::Multiply(limbs, bigint::FromU64(factor));
+        const auto limbText = bigint::ToString(limbs);
+        const double limbMs = MillisecondsSince(started);
+
+        std::cout << "factorial n=" << n << " digits=" << limbText.size()
+                  << " limb_ms=" << static_cast<std::uint64_t>(limbMs);
+        if (withBaseline)
+        {
+            started = Clock::now();
+            std::string text = "1";
+            for (std::size_t factor = 2; factor <= n; ++factor)
+                text = decimal::Multiply(text, std::to_string(factor));
+            const double decimalMs = MillisecondsSince(started);
+            Require(text == limbText, "factorial matches decimal engine");
+            std::cout << " decimal_ms=" << static_cast<std::uint64_t>(decimalMs)
+                      << " speedup=" << static_cast<std::uint64_t>(decimalMs / std::max(limbMs, 0.001)) << "x";
+        }
+        std::cout << '\n';
+    }
+
+    void MeasureModPow(const std::size_t bits, const bool withBaseline)
+    {
+        std::mt19937_64 random(bits);
+        const auto digits = bits * 30103 / 100000;
+        const auto baseText = RandomDecimal(random, digits, false);
+        const auto exponentText = RandomDecimal(random, digits, false);
+        const auto modulusText = RandomDecimal(random, digits, false);
+        const auto base = bigint::Parse(baseText);
+        const auto exponent = bigint::Parse(exponentText);
+        const auto modulus = bigint::Parse(modulusText);
+
+        auto started = Clock::now();
+        const auto result = bigint::ModPow(base, exponent, modulus);
+        const double limbMs = MillisecondsSince(started);
+
+        // a^(e+1) == a^e * a (mod m) ties the windowed ladder to plain multiplication.
+        const auto next = bigint::ModPow(base, bigint::Add(exponent, bigint::FromI64(1)), modulus);
+        Require(bigint::Compare(next, bigint::Remainder(bigint::Multiply(result, base), modulus)) == 0, "modpow step identity");
+
+        std::cout << "modpow bits=" << bits << " limb_ms=" << limbMs;
+        if (withBaseline)
+        {
+            started = Clock::now();
+            const auto text = decimal::ModPow(baseText, exponentText, modulusText);
+            const double decimalMs = MillisecondsSince(started);
+            Require(text == bigint::ToString(result), "modpow matches decimal engine");
+            std::cout << " decimal_ms=" << static_cast<std::uint64_t>(decimalMs)
+                      << " speedup=" << static_cast<std::uint64_t>(decimalMs / std::max(limbMs, 0.001)) << "x";
+        }
+        std::cout << '\n';
+    }
+}
+
+int main()
+{
+    try
+    {
+        CheckAgainstDecimal();
+        MeasureFactorial(ReadCount("WIO_BIGINT_STRESS_BASELINE_FACTORIAL", 2000), true);
+        MeasureFactorial(ReadCount("WIO_BIGINT_STRESS_FACTORIAL", 10000), false);
+        MeasureModPow(ReadCount("WIO_BIGINT_STRESS_BASELINE_MODPOW_BITS", 256), true);
+        MeasureModPow(ReadCount("WIO_BIGINT_STRESS_MODPOW_BITS", 4096), false);
+        std::cout << "bigint-runtime-stress-ok\n";
+        return 0;
+    }
+    catch (const std::exception& error)
+    {
+        std::cerr << error.what() << '\n';
+        return 1;
+    }
+}
@@ -0,0 +1,153 @@
+#include "compiler.h"
+#include "wio/common/arena.h"
+#include "wio/common/logger.h"
+#include "wio/lexer/lexer.h"
+#include "wio/parser/parser.h"
+#include "wio/sema/analyzer.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <optional>
+#include <stdexcept>
+#include <string>
+
+namespace
+{
+    std::atomic<std::uint64_t> gAllocations{0};
+
+    using Clock = std::chrono::steady_clock;
+
+    void Require(const bool condition, const char* message)
+    {
+        if (!condition)
+            throw std::runtime_error(message);
+    }
+
+    std::size_t ReadCount(const char* name, const std::size_t fallback)
+    {
+        const char* value = std::getenv(name);
+        if (!value || !*value)
+            return fallback;
+        const auto parsed = std::strtoull(value, nullptr, 10);
+        return parsed == 0 ? fallback : static_cast<std::size_t>(parsed);
+    }
+
+    // Ten lines per function: locals, arithmetic, branches, loops, an array
+    // literal, and a call into the previous function.
+    std::string MakeProgram(const std::size_t lines)
+    {
+        const std::size_t functions = std::max<std::size_t>(1, lines / 10);
+        std::string source;
+        source.reserve(lines * 40);
+        for (std::size_t index = 0; index < functions; ++index)
+        {
+            const auto name = "F" + std::to_string(index);
+            source += "fn " + name + "(a: i32, b: i32) -> i32 {\n";
+            source += "    let c = a + b * " + std::to_string(index % 7 + 1) + ";\n";
+            source += "    mut d = c;\n";
+            source += "    if (d > 10) { d = d - 1; }\n";
+            source += "    while (d > 100) { d = d / 2; }\n";
+            source += "    let values: i32[] = [a, b, c, d];\n";
+            source += "    d += values[0usize];\n";
+            source += index == 0 ? "    return d;\n" : "    return d + F" + std::to_string(index - 1) + "(a, b);\n";
+            source += "}\n\n";
+        }
+        source += "fn Entry() -> i32 {\n    return F" + std::to_string(functions - 1) + "(1, 2);\n}\n";
+        return source;
+    }
+
+    struct FrontendRun
+    {
+        std::uint64_t allocations = 0;
+        double seconds = 0.0;
+        std::size_t arenaObjects = 0;
+        std::size_t arenaBytes = 0;
+        wio::sema::SemanticAnalyzer::AnalysisStats analysis;
+    };
+
+    FrontendRun RunFrontend(const std::string& source, wio::Arena* arena)
+    {
+        std::optional<wio::ArenaScope> scope;
+        if (arena)
+            scope.emplace(*arena);
+
+        const auto allocationsBefore = gAllocations.load(std::memory_order_relaxed);
+        const auto started = Clock::now();
+        FrontendRun run;
+        {
+            wio::Lexer lexer(source, "frontend_stress.wio");
+            wio::Parser parser(lexer.lex());
+            auto program = parser.parseProgram();
+            wio::sema::SemanticAnalyzer analyzer;
+            analyzer.analyze(program);
+            run.analysis = analyzer.getStats();
+        }
+        run.seconds = std::chrono::duration<double>(Clock::now() - started).count();
+        run.allocations = gAllocations.load(std::memory_order_relaxed) - allocationsBefore;
+        Require(wio::Logger::get().getErrorCount() == 0, "synthetic program analyzes cleanly");
+        if (arena)
+        {
+            run.arenaObjects = arena->ObjectCount();
+            run.arenaBytes = arena->BytesUsed();
+        }
+        return run;
+    }
+}
+
+void* operator new(const std::size_t size)
+{
+    gAllocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* memory = std::malloc(size == 0 ? 1 : size))
+        return memory;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* memory) noexcept { std::free(memory); }
+void operator delete(void* memory, std::size_t) noexcept { std::free(memory); }
+
+int main()
+{
+    try
+    {
+        const auto lines = ReadCount("WIO_FRONTEND_STRESS_LINES", 50000);
+        const auto source = MakeProgram(lines);
+        static_cast<void>(wio::Compiler::get());
+        static_cast<void>(RunFrontend(MakeProgram(200), nullptr));
+
+        const auto heap = RunFrontend(source, nullptr);
+        // Arena objects must outlive every Ref that may still name them,
+        // including types interned by the shared TypeContext, which is only
+        // torn down after every function-local static; so it is never freed.
+        auto& arena = *new wio::Arena();
+        const auto pooled = RunFrontend(source, &arena);
+        Require(pooled.arenaObjects > 0, "arena run allocates nodes and types in the arena");
+        Require(pooled.allocations < heap.allocations, "arena run performs fewer heap allocations");
+        const auto& analysis = heap.analysis;
+        Require(analysis.lookups.lookups > lines && analysis.lookups.cacheHits > 0, "analysis resolves through scope caches");
+
+        std::cout << "frontend lines=" << lines
+                  << " heap_allocations=" << heap.allocations
+                  << " heap_ms=" << static_cast<std::uint64_t>(heap.seconds * 1000.0)
+                  << " arena_allocations=" << pooled.allocations
+                  << " arena_ms=" << static_cast<std::uint64_t>(pooled.seconds * 1000.0)
+                  << " arena_objects=" << pooled.arenaObjects
+                  << " arena_kb=" << pooled.arenaBytes / 1024 << '\n';
+        std::cout << "analyze ms=" << static_cast<std::uint64_t>(analysis.seconds * 1000.0)
+                  << " lookups=" << analysis.lookups.lookups
+                  << " lookups_per_sec=" << static_cast<std::uint64_t>(static_cast<double>(analysis.lookups.lookups) / analysis.seconds)
+                  << " cache_hits=" << analysis.lookups.cacheHits
+                  << " parent_steps=" << analysis.lookups.parentSteps << '\n';
+        std::cout << "compiler-frontend-stress-ok\n";
+        return 0;
+    }
+    catch (const std::exception& error)
+    {
+        std::cerr << error.what() << '\n';
+        return 1;
+    }
+}
@@ -0,0 +1,264 @@
+#include <wio_flat_hash_map.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+    std::atomic<std::int64_t> gLiveBytes{0};
+    std::atomic<std::int64_t> gLiveAllocations{0};
+
+    using Clock = std::chrono::steady_clock;
+
+    void Require(const bool condition, const char* message)
+    {
+        if (!condition)
+            throw std::runtime_error(message);
+    }
+
+    std::size_t ReadCount(const char* name, const std::size_t fallback)
+    {
+        const char* value = std::getenv(name);
+        if (!value || !*value)
+            return fallback;
+        const auto parsed = std::strtoull(value, nullptr, 10);
+        return parsed == 0 ? fallback : static_cast<std::size_t>(parsed);
+    }
+
+    void CheckSemantics()
+    {
+        wio::FlatHashMap<std::string, std::int32_t> map{{"one", 1}, {"two", 2}};
+        Require(map.size() == 2 && map.at("two") == 2, "initializer list");
+        Require(map.find("three") == map.end() && !map.contains("three"), "missing key");
+        map["three"] = 3;
+        Require(map.try_emplace("three", 30).second == false && map["three"] == 3, "try_emplace keeps existing");
+        map.insert_or_assign("three", 33);
+        Require(map.at("three") == 33, "insert_or_assign replaces");
+
+        bool threw = false;
+        try
+        {
+            static_cast<void>(map.at("absent"));
+        }
+        catch (const std::out_of_range&)
+        {
+            threw = true;
+        }
+        Require(threw, "at throws for a missing key");
+
+        wio::FlatHashMap<std::int32_t, std::int32_t> numbers;
+        for (std::int32_t key = 0; key < 10000; ++key)
+            numbers.emplace(key, key * 2);
+        std::int64_t sum = 0;
+        std::size_t visited = 0;
+        for (const auto& [key, value] : numbers)
+        {
+            Require(value == key * 2, "iteration sees each value");
+            sum += key;
+            ++visited;
+        }
+        Require(visited == 10000 && sum == 49995000, "iteration visits every entry once");
+
+        for (auto it = numbers.begin(); it != numbers.end();)
+            it = it->first % 2 == 0 ? numbers.erase(it) : std::next(it);
+        Require(numbers.size() == 5000 && !numbers.contains(4) && numbers.contains(5), "erase while iterating");
+
+        // Churn through deleted slots without growing the table.
+        const auto capacity = numbers.bucket_count();
+        for (std::int32_t round = 0; round < 50; ++round)
+        {
+            for (std::int32_t key = 0; key < 1000; ++key)
+                numbers[100000 + key] = round;
+            for (std::int32_t key = 0; key < 1000; ++key)
+                Require(numbers.erase(100000 + key) == 1, "churn erase");
+        }
+        Require(numbers.size() == 5000 && numbers.bucket_count() == capacity, "deleted slots are reused");
+
+        auto copy = numbers;
+        Require(copy == numbers, "copies compare equal");
+        copy[1] = -1;
+        Require(!(copy == numbers) && numbers.at(1) == 2, "copies are independent");
+        auto moved = std::move(copy);
+        Require(moved.size() == 5000 && copy.empty(), "move leaves the source empty");
+        moved.clear();
+        Require(moved.empty() && moved.begin() == moved.end() && moved.bucket_count() != 0, "clear keeps capacity");
+    }
+
+    std::vector<std::string> MakeKeys(const std::size_t count)
+    {
+        std::vector<std::string> keys;
+        keys.reserve(count);
+        for (std::size_t index = 0; index < count; ++index)
+            keys.push_back("symbol::module::name_" + std::to_string(index * 2654435761u % 1000003u) + "_" + std::to_string(index));
+        return keys;
+    }
+
+    struct Report final
+    {
+        double insertSeconds = 0.0;
+        double lookupSeconds = 0.0;
+        double eraseSeconds = 0.0;
+        double bytesPerEntry = 0.0;
+        double allocationsPerEntry = 0.0;
+        double loadFactor = 0.0;
+    };
+
+    double Since(const Clock::time_point started)
+    {
+        return std::chrono::duration<double>(Clock::now() - started).count();
+    }
+
+    // Lookups and erases visit the keys in a fixed shuffled order so neither
+    // table benefits from entries that happen to sit in insertion order.
+    template <typename Map, typename Key>
+    Report Measure(const std::vector<Key>& keys, const std::vector<std::size_t>& order)
+    {
+        Report report;
+        std::int64_t checksum = 0;
+        {
+            const auto bytesBefore = gLiveBytes.load();
+            const auto allocationsBefore = gLiveAllocations.load();
+            Map map;
+            auto started = Clock::now();
+            for (std::size_t index = 0; index < keys.size(); ++index)
+                map[keys[index]] = static_cast<std::int64_t>(index);
+            report.insertSeconds = Since(started);
+            report.bytesPerEntry = static_cast<double>(gLiveBytes.load() - bytesBefore) / static_cast<double>(keys.size());
+            report.allocationsPerEntry =
+                static_cast<double>(gLiveAllocations.load() - allocationsBefore) / static_cast<double>(keys.size());
+            report.loadFactor = map.load_factor();
+
+            started = Clock::now();
+            for (std::size_t round = 0; round < 4; ++round)
+            {
+                for (const std::size_t index : order)
+                {
+                    const auto found = map.find(keys[index]);
+                    checksum += found == map.end() ? -1 : found->second;
+                }
+            }
+            report.lookupSeconds = Since(started) / 4.0;
+
+            started = Clock::now();
+            for (std::size_t position = 0; position < order.size(); position += 2)
+                checksum += static_cast<std::int64_t>(map.erase(keys[order[position]]));
+            report.eraseSeconds = Since(started) * 2.0;
+            Require(map.size() == keys.size() / 2, "half the entries remain");
+        }
+        Require(checksum != 0, "benchmark checksum");
+        return report;
+    }
+
+    void Print(const char* name, const std::size_t entries, const Report& report)
+    {
+        const auto perSecond = [entries](const double seconds)
+        {
+            return seconds <= 0.0 ? 0ull : static_cast<unsigned long long>(static_cast<double>(entries) / seconds);
+        };
+        std::cout << name
+                  << " insert_per_s=" << perSecond(report.insertSeconds)
+                  << " lookup_per_s=" << perSecond(report.lookupSeconds)
+                  << " erase_per_s=" << perSecond(report.eraseSeconds)
+                  << " bytes_per_entry=" << static_cast<unsigned long long>(report.bytesPerEntry)
+                  << " allocations_per_entry=" << report.allocationsPerEntry
+                  << " load_factor=" << report.loadFactor
+                  << '\n';
+    }
+
+    template <typename Key>
+    void Compare(const char* label, const std::vector<Key>& keys)
+    {
+        std::vector<std::size_t> order(keys.size());
+        std::iota(order.begin(), order.end(), std::size_t{0});
+        std::shuffle(order.begin(), order.end(), std::mt19937_64(0x5eed));
+        const auto node = Measure<std::unordered_map<Key, std::int64_t>>(keys, order);
+        const auto flat = Measure<wio::FlatHashMap<Key, std::int64_t>>(keys, order);
+        std::cout << label << " entries=" << keys.size() << '\n';
+        Print("  unordered_map", keys.size(), node);
+        Print("  flat_hash_map", keys.size(), flat);
+        Require(flat.allocationsPerEntry < node.allocationsPerEntry, "flat map does not allocate per entry");
+    }
+}
+
+// Live byte and block counting for the memory-per-entry figures; each block carries
+// its size in a header so delete can subtract it.
+namespace
+{
+    constexpr std::size_t kHeader = alignof(std::max_align_t);
+
+    void* CountedAllocate(const std::size_t size, const std::size_t alignment)
+    {
+        const std::size_t header = alignment > kHeader ? alignment : kHeader;
+        auto* block = static_cast<unsigned char*>(std::aligned_alloc(header, (size + header * 2 - 1) / header * header));
+        if (!block)
+            throw std::bad_alloc();
+        *reinterpret_cast<std::size_t*>(block + header - sizeof(std::size_t)) = size;
+        *reinterpret_cast<std::size_t*>(block) = header;
+        gLiveBytes.fetch_add(static_cast<std::int64_t>(size), std::memory_order_relaxed);
+        gLiveAllocations.fetch_add(1, std::memory_order_relaxed);
+        return block + header;
+    }
+
+    void CountedFree(void* memory, const std::size_t alignment) noexcept
+    {
+        if (!memory)
+            return;
+        const std::size_t header = alignment > kHeader ? alignment : kHeader;
+        auto* block = static_cast<unsigned char*>(memory) - header;
+        gLiveBytes.fetch_sub(static_cast<std::int64_t>(*reinterpret_cast<std::size_t*>(block + header - sizeof(std::size_t))),
+            std::memory_order_relaxed);
+        gLiveAllocations.fetch_sub(1, std::memory_order_relaxed);
+        std::free(block);
+    }
+}
+
+void* operator new(const std::size_t size) { return CountedAllocate(size, kHeader); }
+void* operator new(const std::size_t size, const std::align_val_t alignment)
+{
+    return CountedAllocate(size, static_cast<std::size_t>(alignment));
+}
+
+void operator delete(void* memory) noexcept { CountedFree(memory, kHeader); }
+void operator delete(void* memory, std::size_t) noexcept { CountedFree(memory, kHeader); }
+void operator delete(void* memory, const std::align_val_t alignment) noexcept
+{
+    CountedFree(memory, static_cast<std::size_t>(alignment));
+}
+void operator delete(void* memory, std::size_t, const std::align_val_t alignment) noexcept
+{
+    CountedFree(memory, static_cast<std::size_t>(alignment));
+}
+
+int main()
+{
+    try
+    {
+        CheckSemantics();
+
+        const auto entries = ReadCount("WIO_DICT_BENCH_ENTRIES", 1000000);
+        std::vector<std::int64_t> integerKeys;
+        integerKeys.reserve(entries);
+        for (std::size_t index = 0; index < entries; ++index)
+            integerKeys.push_back(static_cast<std::int64_t>(index) * 7919);
+        Compare("i64 keys", integerKeys);
+        Compare("string keys", MakeKeys(entries));
+
+        std::cout << "dict-flat-map-stress-ok\n";
+        return 0;
+    }
+    catch (const std::exception& error)
+    {
+        std::cerr << "dict flat map stress failed: " << error.what() << '\n';
+        return 1;
+    }
+}
@@ -0,0 +1,277 @@
+#include "std_async_fs.h"
+#include "std_fs.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <ctime>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#if !defined(_WIN32)
+#include <unistd.h>
+#endif
+
+namespace
+{
+    using wio::runtime::AsyncTask;
+    namespace async_fs = wio::runtime::std_async_fs;
+    namespace fs = wio::runtime::std_fs;
+    using Clock = std::chrono::steady_clock;
+
+    void Require(const bool condition, const char* message)
+    {
+        if (!condition)
+            throw std::runtime_error(message);
+    }
+
+    std::size_t ReadCount(const char* name, const std::size_t fallback)
+    {
+        const char* value = std::getenv(name);
+        if (!value || !*value)
+            return fallback;
+        const auto parsed = std::strtoull(value, nullptr, 10);
+        return parsed == 0 ? fallback : static_cast<std::size_t>(parsed);
+    }
+
+    void WriteFile(const std::filesystem::path& path, const std::string& text)
+    {
+        std::ofstream output(path, std::ios::binary | std::ios::trunc);
+        output << text;
+        Require(output.good(), "fixture write");
+    }
+
+    void* OpenWatch(const std::filesystem::path& path, const bool recursive)
+    {
+        void* handle = nullptr;
+        std::int32_t error = 0;
+        std::int64_t nativeError = 0;
+        std::string message;
+        Require(fs::WatchOpen(path.generic_string(), recursive, handle, error, nativeError, message),
+            "watch opens");
+        return handle;
+    }
+
+    std::unordered_map<std::string, std::int32_t> Collect(void* handle)
+    {
+        bool changed = false;
+        std::int32_t error = 0;
+        std::int64_t nativeError = 0;
+        std::string message;
+        Require(fs::WatchRefresh(handle, changed, error, nativeError, message), "watch refresh");
+        std::vector<std::string> paths;
+        std::vector<std::int32_t> kinds;
+        Require(fs::WatchTake(handle, paths, kinds, error, nativeError, message), "watch take");
+        std::unordered_map<std::string, std::int32_t> changes;
+        for (std::size_t index = 0; index < paths.size(); ++index)
+            changes.emplace(paths[index], kinds[index]);
+        return changes;
+    }
+
+    constexpr auto created = static_cast<std::int32_t>(fs::WatchChangeKind::Created);
+    constexpr auto modified = static_cast<std::int32_t>(fs::WatchChangeKind::Modified);
+
+    void CoalescesBursts(const std::filesystem::path& root)
+    {
+        std::filesystem::create_directories(root);
+        void* handle = OpenWatch(root, true);
+        const auto file = root / "burst.txt";
+        for (int index = 0; index < 100; ++index)
+            WriteFile(file, std::to_string(index));
+        WriteFile(root / "transient.txt", "gone");
+        std::filesystem::remove(root / "transient.txt");
+        std::filesystem::create_directories(root / "fresh" / "nested");
+        WriteFile(root / "fresh" / "nested" / "inner.txt", "inner");
+
+        const auto changes = Collect(handle);
+        const auto burst = changes.find(file.generic_string());
+        Require(burst != changes.end() && burst->second == created, "a burst of writes to a new file is one creation");
+        Require(!changes.contains((root / "transient.txt").generic_string()), "create then remove cancels out");
+        const auto inner = changes.find((root / "fresh" / "nested" / "inner.txt").generic_string());
+        Require(inner != changes.end() && inner->second == created, "files in new subdirectories are reported");
+
+        for (int index = 0; index < 100; ++index)
+            WriteFile(file, std::to_string(index * 7));
+        const auto rewrites = Collect(handle);
+        const auto rewritten = rewrites.find(file.generic_string());
+        Require(rewritten != rewrites.end() && rewritten->second == modified, "rewrites coalesce into one modification");
+        fs::WatchClose(handle);
+    }
+
+    void CloseWakesParkedWaiter(const std::filesystem::path& root)
+    {
+        void* handle = OpenWatch(root, true);
+        if (!fs::WatchUsesNotifications(handle))
+        {
+            fs::WatchClose(handle);
+            return;
+        }
+        auto next = async_fs::WatchNext(handle, 10);
+        const auto deadline = Clock::now() + std::chrono::seconds(10);
+        while (fs::WatchNotifyPendingCount() < 1 && Clock::now() < deadline)
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        Require(fs::WatchNotifyPendingCount() == 1, "an idle watch parks on the reactor");
+        fs::WatchClose(handle);
+        auto completion = wio::runtime::BlockOn(next);
+        Require(!async_fs::detail::Take(completion).succeeded, "close wakes a parked watch");
+        Require(fs::WatchNotifyPendingCount() == 0, "close releases the waiter");
+    }
+
+    struct Entry final
+    {
+        std::uintmax_t size = 0;
+        std::filesystem::file_time_type lastWriteTime;
+    };
+
+    using Snapshot = std::unordered_map<std::string, Entry>;
+
+    Snapshot Scan(const std::filesystem::path& root)
+    {
+        Snapshot snapshot;
+        for (const auto& entry : std::filesystem::recursive_directory_iterator(root))
+        {
+            if (entry.is_regular_file())
+                snapshot.emplace(entry.path().generic_string(), Entry{entry.file_size(), entry.last_write_time()});
+        }
+        return snapshot;
+    }
+
+    // The pre-notification shape: rescan the tree every interval and compare
+    // size and write time.
+    AsyncTask<std::size_t> PolledNext(const std::filesystem::path root, const std::uint64_t intervalMilliseconds)
+    {
+        const Snapshot baseline = Scan(root);
+        while (true)
+        {
+            wio::runtime::AsyncDelayAwaiter delay{std::chrono::milliseconds(intervalMilliseconds)};
+            co_await delay;
+            const Snapshot current = Scan(root);
+            std::size_t changes = 0;
+            for (const auto& [path, entry] : current)
+            {
+                const auto previous = baseline.find(path);
+                if (previous == baseline.end() || previous->second.size != entry.size ||
+                    previous->second.lastWriteTime != entry.lastWriteTime)
+                    ++changes;
+            }
+            if (changes != 0 || current.size() != baseline.size())
+                co_return changes;
+        }
+    }
+
+    AsyncTask<std::size_t> NotifiedNext(void* handle, const std::uint64_t intervalMilliseconds)
+    {
+        auto next = async_fs::WatchNext(handle, intervalMilliseconds);
+        auto completion = co_await next;
+        auto& result = async_fs::detail::Take(completion);
+        Require(result.succeeded, "watch completes");
+        co_return result.texts.size();
+    }
+
+    struct Report final
+    {
+        double idleCpuSeconds = 0.0;
+        double latencySeconds = 0.0;
+    };
+
+    // Starts the watch, leaves the tree idle, then touches one file and
+    // measures how long the watch takes to report it.
+    Report MeasureIdleAndLatency(
+        AsyncTask<std::size_t> next, const std::filesystem::path& touched, const std::size_t idleMilliseconds)
+    {
+        Report report;
+        const std::clock_t cpuStarted = std::clock();
+        std::this_thread::sleep_for(std::chrono::milliseconds(idleMilliseconds));
+        report.idleCpuSeconds = static_cast<double>(std::clock() - cpuStarted) / CLOCKS_PER_SEC;
+        const auto started = Clock::now();
+        WriteFile(touched, "touched-" + std::to_string(started.time_since_epoch().count()));
+        Require(wio::runtime::BlockOn(next) != 0, "the touched file is reported");
+        report.latencySeconds = std::chrono::duration<double>(Clock::now() - started).count();
+        return report;
+    }
+
+    void Print(const char* name, const Report& report)
+    {
+        std::cout << name
+                  << " idle_cpu_ms=" << static_cast<std::uint64_t>(report.idleCpuSeconds * 1000.0)
+                  << " latency_ms=" << static_cast<std::uint64_t>(report.latencySeconds * 1000.0)
+                  << '\n';
+    }
+
+    std::filesystem::path MakeRoot()
+    {
+        auto root = std::filesystem::temp_directory_path() / "wio-fs-watch-stress";
+#if !defined(_WIN32)
+        root += "-" + std::to_string(::getpid());
+#endif
+        std::filesystem::remove_all(root);
+        std::filesystem::create_directories(root);
+        return root;
+    }
+}
+
+int main()
+{
+    std::filesystem::path root;
+    try
+    {
+        root = MakeRoot();
+        const auto files = ReadCount("WIO_FS_WATCH_BENCH_FILES", 50000);
+        const auto idleMilliseconds = ReadCount("WIO_FS_WATCH_BENCH_IDLE_MS", 2000);
+        const auto interval = static_cast<std::uint64_t>(ReadCount("WIO_FS_WATCH_BENCH_INTERVAL_MS", 50));
+        const auto baseline = fs::LiveWatchCount();
+
+        CoalescesBursts(root / "behaviour");
+        CloseWakesParkedWaiter(root / "behaviour");
+
+        const auto tree = root / "tree";
+        constexpr std::size_t filesPerDirectory = 500;
+        for (std::size_t index = 0; index < files; ++index)
+        {
+            const auto directory = tree / ("d" + std::to_string(index / filesPerDirectory));
+            if (index % filesPerDirectory == 0)
+                std::filesystem::create_directories(directory);
+            WriteFile(directory / ("f" + std::to_string(index) + ".txt"), "x");
+        }
+        const auto touched = tree / "d0" / "f0.txt";
+
+        const auto polled = MeasureIdleAndLatency(PolledNext(tree, interval), touched, idleMilliseconds);
+
+        const auto setupStarted = Clock::now();
+        void* handle = OpenWatch(tree, true);
+        const auto setupMilliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(
+            Clock::now() - setupStarted).count();
+        const bool notified = fs::WatchUsesNotifications(handle);
+        const auto watched = MeasureIdleAndLatency(NotifiedNext(handle, interval), touched, idleMilliseconds);
+        fs::WatchClose(handle);
+
+        std::cout << "watch files=" << files << " interval_ms=" << interval
+                  << " notifications=" << (notified ? "inotify" : "polling")
+                  << " setup_ms=" << setupMilliseconds << '\n';
+        Print("polled", polled);
+        Print("watched", watched);
+
+        Require(fs::WatchNotifyPendingCount() == 0, "every watch waiter is released");
+        Require(fs::LiveWatchCount() == baseline, "every watch state is reclaimed");
+        wio::runtime::ShutdownAsyncRuntime();
+        std::filesystem::remove_all(root);
+        std::cout << "fs-watch-runtime-stress-ok\n";
+        return 0;
+    }
+    catch (const std::exception& error)
+    {
+        wio::runtime::ShutdownAsyncRuntime();
+        std::error_code ignored;
+        if (!root.empty())
+            std::filesystem::remove_all(root, ignored);
+        std::cerr << "fs watch runtime stress failed: " << error.what() << '\n';
+        return 1;
+    }
+}
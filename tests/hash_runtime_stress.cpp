@@ -0,0 +1,172 @@
+#include "std_hash.h"
+
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+namespace
+{
+    namespace hash = wio::runtime::std_hash;
+    using Clock = std::chrono::steady_clock;
+
+    void Require(const bool condition, const char* message)
+    {
+        if (!condition)
+            throw std::runtime_error(message);
+    }
+
+    std::size_t ReadCount(const char* name, const std::size_t fallback)
+    {
+        const char* value = std::getenv(name);
+        if (!value || !*value)
+            return fallback;
+        const auto parsed = std::strtoull(value, nullptr, 10);
+        return parsed == 0 ? fallback : static_cast<std::size_t>(parsed);
+    }
+
+    double SecondsSince(const Clock::time_point started)
+    {
+        return std::chrono::duration<double>(Clock::now() - started).count();
+    }
+
+    std::vector<std::uint8_t> RandomBytes(std::mt19937_64& random, const std::size_t size)
+    {
+        std::vector<std::uint8_t> bytes(size);
+        for (auto& value : bytes)
+            value = static_cast<std::uint8_t>(random());
+        return bytes;
+    }
+
+    void CheckVectors()
+    {
+        Require(hash::Sha256("") == "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855", "empty vector");
+        Require(hash::Sha256("abc") == "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad", "abc vector");
+        Require(hash::Sha256("abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq") ==
+                "248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1", "two block vector");
+
+        hash::Sha256Hasher hasher;
+        const std::string chunk(1000, 'a');
+        for (int i = 0; i < 1000; ++i)
+            hasher.Update(chunk);
+        const auto digest = hasher.Finish();
+        const std::vector<std::uint8_t> bytes(digest.begin(), digest.end());
+        Require(hash::Sha256DigestBytes(std::vector<std::uint8_t>(1000000, 'a')) == bytes, "million a one-shot");
+        Require(hash::Sha256(std::string(1000000, 'a')) ==
+                "cdc76e5c9914fb9281a1c7e284d73e67f1809a48a497200e046d39ccc7112cd0", "million a vector");
+    }
+
+    void CheckBackendsAndSplits()
+    {
+        std::mt19937_64 random(14);
+        const bool accelerated = hash::Sha256Accelerated();
+        for (std::size_t round = 0; round < 400; ++round)
+        {
+            const auto size = round < 200 ? round : static_cast<std::size_t>(random() % 20000);
+            const auto bytes = RandomBytes(random, size);
+
+            hash::SetSha256Acceleration(false);
+            const auto scalar = hash::Sha256DigestBytes(bytes);
+            hash::SetSha256Acceleration(true);
+            const auto dispatched = hash::Sha256DigestBytes(bytes);
+            Require(scalar == dispatched, "SHA-NI and scalar digests agree");
+
+            hash::Sha256Hasher hasher;
+            std::size_t offset = 0;
+            while (offset < bytes.size())
+            {
+                const auto take = std::min<std::size_t>(bytes.size() - offset, random() % 150);
+                hasher.Update(bytes.data() + offset, take);
+                offset += take;
+            }
+            const auto streamed = hasher.Finish();
+            Require(std::equal(streamed.begin(), streamed.end(), scalar.begin()), "incremental matches one-shot");
+        }
+        hash::SetSha256Acceleration(accelerated);
+    }
+
+    void CheckFast64()
+    {
+        Require(hash::Fast64("") == hash::Fast64Raw("", 0), "raw entry point matches");
+        Require(hash::Fast64("wio") != hash::Fast64Raw("wio", 3, 1), "seed changes the hash");
+
+        std::unordered_set<std::uint64_t> seen;
+        for (std::uint64_t value = 0; value < 200000; ++value)
+            Require(seen.insert(hash::Fast64(std::to_string(value))).second, "no collisions on decimal keys");
+
+        // Flipping any single input bit should flip roughly half the output bits.
+        std::mt19937_64 random(64);
+        std::uint64_t flipped = 0;
+        std::uint64_t trials = 0;
+        for (const std::size_t size : {3u, 8u, 16u, 17u, 49u, 200u})
+        {
+            auto bytes = RandomBytes(random, size);
+            const auto base = hash::Fast64Bytes(bytes);
+            for (std::size_t bit = 0; bit < size * 8u; ++bit)
+            {
+                bytes[bit / 8u] ^= static_cast<std::uint8_t>(1u << (bit % 8u));
+                flipped += static_cast<std::uint64_t>(std::popcount(base ^ hash::Fast64Bytes(bytes)));
+                bytes[bit / 8u] ^= static_cast<std::uint8_t>(1u << (bit % 8u));
+                ++trials;
+            }
+        }
+        const double average = static_cast<double>(flipped) / static_cast<double>(trials);
+        Require(average > 28.0 && average < 36.0, "single-bit avalanche");
+    }
+
+    double MeasureGigabytesPerSecond(const std::vector<std::uint8_t>& data, const std::size_t passes, auto&& body)
+    {
+        const auto started = Clock::now();
+        for (std::size_t pass = 0; pass < passes; ++pass)
+            body();
+        const double seconds = std::max(SecondsSince(started), 1e-9);
+        return static_cast<double>(data.size()) * static_cast<double>(passes) / seconds / 1e9;
+    }
+
+    void MeasureThroughput()
+    {
+        const auto megabytes = ReadCount("WIO_HASH_STRESS_MEGABYTES", 64);
+        const auto passes = ReadCount("WIO_HASH_STRESS_PASSES", 2);
+        std::mt19937_64 random(2);
+        const auto data = RandomBytes(random, megabytes * 1024u * 1024u);
+        const bool accelerated = hash::Sha256Accelerated();
+
+        std::uint64_t sink = 0;
+        hash::SetSha256Acceleration(false);
+        const double scalar = MeasureGigabytesPerSecond(data, passes, [&] { sink += hash::Sha256DigestBytes(data)[0]; });
+        hash::SetSha256Acceleration(true);
+        const double dispatched = MeasureGigabytesPerSecond(data, passes, [&] { sink += hash::Sha256DigestBytes(data)[0]; });
+        hash::SetSha256Acceleration(accelerated);
+        const double fast = MeasureGigabytesPerSecond(data, passes * 8u, [&] { sink += hash::Fast64Bytes(data); });
+        const double fnv = MeasureGigabytesPerSecond(data, passes, [&] { sink += hash::Fnv1a64Bytes(data); });
+
+        std::cout << "sha256 bytes=" << data.size() << " scalar_gbps=" << scalar
+                  << " dispatched_gbps=" << dispatched << " sha_ni=" << (hash::Sha256Accelerated() ? "yes" : "no") << '\n';
+        std::cout << "fast64 gbps=" << fast << " fnv1a64_gbps=" << fnv << " sink=" << (sink & 1u) << '\n';
+    }
+}
+
+int main()
+{
+    try
+    {
+        CheckVectors();
+        CheckBackendsAndSplits();
+        CheckFast64();
+        MeasureThroughput();
+        std::cout << "hash-runtime-stress-ok\n";
+        return 0;
+    }
+    catch (const std::exception& error)
+    {
+        std::cerr << error.what() << '\n';
+        return 1;
+    }
+}
@@ -0,0 +1,239 @@
+#include "std_json.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+    namespace json = wio::runtime::std_json;
+    using wio::runtime::Ref;
+    using Clock = std::chrono::steady_clock;
+
+    // Same field layout the compiler emits for std::json::Value.
+    struct TestValue : wio::runtime::RefCountedObject
+    {
+        json::NodeKind kind{};
+        bool booleanValue{};
+        std::string integerText{};
+        double numberValue{};
+        std::string stringValue{};
+        std::vector<Ref<TestValue>> arrayValue{};
+        std::unordered_map<std::string, Ref<TestValue>> objectValue{};
+    };
+
+    void Require(const bool condition, const char* message)
+    {
+        if (!condition)
+            throw std::runtime_error(message);
+    }
+
+    std::size_t ReadCount(const char* name, const std::size_t fallback)
+    {
+        const char* value = std::getenv(name);
+        if (!value || !*value)
+            return fallback;
+        const auto parsed = std::strtoull(value, nullptr, 10);
+        return parsed == 0 ? fallback : static_cast<std::size_t>(parsed);
+    }
+
+    double SecondsSince(const Clock::time_point started)
+    {
+        return std::chrono::duration<double>(Clock::now() - started).count();
+    }
+
+    std::int32_t Parse(const std::string& source, Ref<TestValue>& root, std::string& message,
+                       const json::DuplicateKeys duplicateKeys = json::DuplicateKeys::Reject,
+                       const std::size_t maxDepth = 128)
+    {
+        return json::ParseValue(source, maxDepth, std::size_t{1} << 30u, duplicateKeys, root, message);
+    }
+
+    std::string Write(const Ref<TestValue>& value, const bool pretty = false)
+    {
+        return json::WriteValue(value, pretty, 0, 2);
+    }
+
+    // Social-feed shape: many small objects, long strings with escapes and
+    // non-ASCII text, nested user records.
+    std::string FeedCorpus(const std::size_t statuses)
+    {
+        std::mt19937_64 random(1);
+        std::string out = "{\"statuses\":[";
+        for (std::size_t i = 0; i < statuses; ++i)
+        {
+            if (i > 0)
+                out += ",";
+            const auto id = 500000000000000000ull + random() % 1000000000ull;
+            out += "{\"id\":" + std::to_string(id) + ",\"id_str\":\"" + std::to_string(id) + "\",";
+            out += "\"text\":\"@wio_lang release notes \\\"v" + std::to_string(i % 40) +
+                   "\\\" are up \\u2014 caf\xc3\xa9 \xe6\x97\xa5\xe6\x9c\xac \\ud83d\\ude00 https:\\/\\/example.org\\/" +
+                   std::to_string(random() % 100000) + "\",";
+            out += "\"truncated\":false,\"in_reply_to\":null,\"retweet_count\":" + std::to_string(random() % 5000) + ",";
+            out += "\"user\":{\"id\":" + std::to_string(random() % 100000000) + ",\"name\":\"User " +
+                   std::to_string(i) + "\",\"screen_name\":\"user_" + std::to_string(i) +
+                   "\",\"followers_count\":" + std::to_string(random() % 100000) +
+                   ",\"verified\":" + ((i % 7 == 0) ? "true" : "false") +
+                   ",\"description\":\"Line one\\nLine two\\tTabbed\"},";
+            out += "\"entities\":{\"hashtags\":[{\"text\":\"wio\",\"indices\":[0,4]}],\"urls\":[]},";
+            out += "\"score\":" + std::to_string(static_cast<double>(random() % 100000) / 1000.0) + "}";
+        }
+        out += "]}";
+        return out;
+    }
+
+    // Geometry shape: deep arrays of full-precision coordinates.
+    std::string GeometryCorpus(const std::size_t rings)
+    {
+        std::mt19937_64 random(2);
+        std::uniform_real_distribution<double> longitude(-141.0, -52.0);
+        std::uniform_real_distribution<double> latitude(41.0, 83.0);
+        std::string out = "{\"type\":\"FeatureCollection\",\"features\":[{\"type\":\"Feature\",\"geometry\":"
+                          "{\"type\":\"Polygon\",\"coordinates\":[";
+        for (std::size_t ring = 0; ring < rings; ++ring)
+        {
+            if (ring > 0)
+                out += ",";
+            out += "[";
+            for (int point = 0; point < 64; ++point)
+            {
+                if (point > 0)
+                    out += ",";
+                char buffer[96];
+                std::snprintf(buffer, sizeof(buffer), "[%.15g,%.15g]", longitude(random), latitude(random));
+                out += buffer;
+            }
+            out += "]";
+        }
+        out += "]}}]}";
+        return out;
+    }
+
+    // Catalog shape: pretty-printed objects keyed by numeric ids with
+    // integer arrays, written with whitespace indentation.
+    std::string CatalogCorpus(const std::size_t events)
+    {
+        std::mt19937_64 random(3);
+        std::string out = "{\n    \"events\": {\n";
+        for (std::size_t i = 0; i < events; ++i)
+        {
+            const auto id = 138586341 + i * 3;
+            out += "        \"" + std::to_string(id) + "\": {\n";
+            out += "            \"id\": " + std::to_string(id) + ",\n";
+            out += "            \"name\": \"Event " + std::to_string(i) + "\",\n";
+            out += "            \"subTopicIds\": [\n";
+            for (int topic = 0; topic < 6; ++topic)
+                out += "                " + std::to_string(337184262 + random() % 1000) + (topic < 5 ? ",\n" : "\n");
+            out += "            ],\n";
+            out += "            \"logo\": null,\n";
+            out += "            \"subjectCode\": null\n";
+            out += "        }" + std::string(i + 1 < events ? ",\n" : "\n");
+        }
+        out += "    }\n}\n";
+        return out;
+    }
+
+    void CheckSemantics()
+    {
+        Ref<TestValue> root;
+        std::string message;
+
+        Require(Parse(R"({"b":[1,2.5,"x\u00e9\ud83d\ude00",true,null],"a":{}})", root, message) == 0, "parse sample");
+        Require(Write(root) == "{\"a\":{},\"b\":[1,2.5,\"x\xc3\xa9\xf0\x9f\x98\x80\",true,null]}", "compact output sorts keys");
+        Require(Write(root, true) ==
+                "{\n  \"a\": {},\n  \"b\": [\n    1,\n    2.5,\n    \"x\xc3\xa9\xf0\x9f\x98\x80\",\n    true,\n    null\n  ]\n}",
+                "pretty output layout");
+
+        Require(Parse("{\"n\":900719925474099312345}", root, message) == 0, "big integer");
+        Require(root->objectValue.at("n")->integerText == "900719925474099312345", "integer text is exact");
+
+        Require(Parse("{\"x\":1,\"x\":2}", root, message) == 1, "duplicates rejected");
+        Require(message.find("Duplicate object key 'x'") != std::string::npos, "duplicate message");
+        Require(Parse("{\"x\":1,\"x\":2}", root, message, json::DuplicateKeys::KeepFirst) == 0 &&
+                root->objectValue.at("x")->integerText == "1", "keep first");
+        Require(Parse("{\"x\":1,\"x\":2}", root, message, json::DuplicateKeys::KeepLast) == 0 &&
+                root->objectValue.at("x")->integerText == "2", "keep last");
+
+        std::string wide = "{";
+        for (int i = 0; i < 40; ++i)
+            wide += "\"k" + std::to_string(i) + "\":" + std::to_string(i) + ",";
+        Require(Parse(wide + "\"k3\":0}", root, message) == 1, "duplicates rejected past the linear window");
+        Require(Parse(wide + "\"k40\":0}", root, message) == 0 && root->objectValue.size() == 41, "wide object");
+
+        Require(Parse("[[[1]]]", root, message, json::DuplicateKeys::Reject, 2) == 1 &&
+                message.find("Maximum nesting depth exceeded.") != std::string::npos, "depth limit");
+        Require(json::ParseValue(std::string("[1,2,3]"), 128, 4, json::DuplicateKeys::Reject, root, message) == 2,
+                "byte limit");
+        Require(Parse("\"\xff\"", root, message) == 2, "invalid UTF-8");
+        Require(Parse("{\"x\": [1,}", root, message) == 1, "invalid syntax");
+        Require(Parse("true trailing", root, message) == 1 && message.find("Trailing characters.") != std::string::npos,
+                "trailing data");
+        Require(Parse("\"a\nb\"", root, message) == 1, "raw newline in string");
+        Require(Parse("\"\\q\"", root, message) == 1, "invalid escape");
+        Require(Parse("1e400", root, message) == 1, "out of range number");
+        Require(Parse("-01", root, message) == 1, "leading zero");
+        Require(Parse(" [ ] ", root, message) == 0 && Write(root) == "[]", "empty array");
+    }
+
+    void MeasureCorpus(const char* name, const std::string& source, const std::size_t passes)
+    {
+        Ref<TestValue> root;
+        std::string message;
+        Require(Parse(source, root, message) == 0, "corpus parses");
+        const std::string compact = Write(root);
+        Ref<TestValue> again;
+        Require(Parse(compact, again, message) == 0 && Write(again) == compact, "corpus round trip is stable");
+
+        json::Document document;
+        json::ParseLimits limits;
+        limits.maxBytes = source.size();
+        auto started = Clock::now();
+        for (std::size_t pass = 0; pass < passes; ++pass)
+            Require(json::ParseDocument(source, limits, document, message) == 0, "document parse");
+        const double documentSeconds = SecondsSince(started);
+
+        started = Clock::now();
+        for (std::size_t pass = 0; pass < passes; ++pass)
+            Require(Parse(source, root, message) == 0, "tree parse");
+        const double treeSeconds = SecondsSince(started);
+
+        std::size_t written = 0;
+        started = Clock::now();
+        for (std::size_t pass = 0; pass < passes; ++pass)
+            written += Write(root).size();
+        const double writeSeconds = SecondsSince(started);
+
+        const double megabytes = static_cast<double>(source.size()) * static_cast<double>(passes) / 1e6;
+        std::cout << name << " bytes=" << source.size() << " nodes=" << document.nodes.size()
+                  << " scan_mbps=" << static_cast<std::uint64_t>(megabytes / documentSeconds)
+                  << " tree_mbps=" << static_cast<std::uint64_t>(megabytes / treeSeconds)
+                  << " write_mbps=" << static_cast<std::uint64_t>(static_cast<double>(written) / 1e6 / writeSeconds)
+                  << '\n';
+    }
+}
+
+int main()
+{
+    try
+    {
+        CheckSemantics();
+        const auto passes = ReadCount("WIO_JSON_STRESS_PASSES", 5);
+        const auto scale = ReadCount("WIO_JSON_STRESS_SCALE", 1);
+        MeasureCorpus("feed", FeedCorpus(4000 * scale), passes);
+        MeasureCorpus("geometry", GeometryCorpus(600 * scale), passes);
+        MeasureCorpus("catalog", CatalogCorpus(6000 * scale), passes);
+        std::cout << "json-runtime-stress-ok\n";
+        return 0;
+    }
+    catch (const std::exception& error)
+    {
+        std::cerr << error.what() << '\n';
+        return 1;
+    }
+}
@@ -0,0 +1,140 @@
+#include "wio/common/logger.h"
+#include "wio/common/name.h"
+#include "wio/lexer/lexer.h"
+#include "wio/parser/parser.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace
+{
+    namespace fs = std::filesystem;
+    using Clock = std::chrono::steady_clock;
+
+    struct SourceFile
+    {
+        std::string name;
+        std::string text;
+    };
+
+    void Require(const bool condition, const char* message)
+    {
+        if (!condition)
+            throw std::runtime_error(message);
+    }
+
+    std::size_t ReadCount(const char* name, const std::size_t fallback)
+    {
+        const char* value = std::getenv(name);
+        if (!value || !*value)
+            return fallback;
+        const auto parsed = std::strtoull(value, nullptr, 10);
+        return parsed == 0 ? fallback : static_cast<std::size_t>(parsed);
+    }
+
+    double SecondsSince(const Clock::time_point started)
+    {
+        return std::chrono::duration<double>(Clock::now() - started).count();
+    }
+
+    std::vector<SourceFile> LoadTree(const fs::path& root)
+    {
+        std::vector<SourceFile> files;
+        for (const auto& entry : fs::recursive_directory_iterator(root))
+        {
+            if (!entry.is_regular_file() || entry.path().extension() != ".wio")
+                continue;
+            std::ifstream input(entry.path(), std::ios::binary);
+            files.push_back({ entry.path().filename().string(),
+                              std::string(std::istreambuf_iterator<char>(input), std::istreambuf_iterator<char>()) });
+        }
+        std::ranges::sort(files, {}, &SourceFile::name);
+        return files;
+    }
+
+    // Every lexeme-backed token must be a view of its own source range, which
+    // is what lets the token cache and diagnostics slice instead of copy.
+    void CheckSourceRanges(const std::string& source, const std::vector<wio::Token>& tokens)
+    {
+        for (const auto& token : tokens)
+        {
+            if (token.type != wio::TokenType::identifier && !token.isKeyword() && !token.isOperator())
+                continue;
+            Require(static_cast<std::size_t>(token.offset) + token.length <= source.size() &&
+                    std::string_view(source).substr(token.offset, token.length) == token.value,
+                    "token value matches its source range");
+        }
+    }
+}
+
+int main(int argc, char** argv)
+{
+    try
+    {
+        const fs::path root = argc > 1 ? fs::path(argv[1]) : fs::path("std");
+        const auto passes = ReadCount("WIO_LEXER_BENCH_PASSES", 5);
+        const auto files = LoadTree(root);
+        Require(!files.empty(), "std tree contains modules");
+
+        std::string corpus;
+        for (const auto& file : files)
+            corpus += file.text + "\n";
+        const double megabytes = static_cast<double>(corpus.size()) / 1e6;
+
+        std::size_t tokenCount = 0;
+        double lexSeconds = 0.0;
+        for (std::size_t pass = 0; pass < passes; ++pass)
+        {
+            const auto started = Clock::now();
+            wio::Lexer lexer(corpus, "std.wio");
+            const auto tokens = lexer.lex();
+            lexSeconds += SecondsSince(started);
+            tokenCount = tokens.size();
+            if (pass == 0)
+                CheckSourceRanges(corpus, tokens);
+        }
+
+        // Modules are parsed one at a time: each is a separate program.
+        double parseSeconds = 0.0;
+        std::size_t statements = 0;
+        for (std::size_t pass = 0; pass < passes; ++pass)
+        {
+            statements = 0;
+            const auto started = Clock::now();
+            for (const auto& file : files)
+            {
+                wio::Lexer lexer(file.text, file.name);
+                wio::Parser parser(lexer.lex());
+                const auto program = parser.parseProgram();
+                statements += program->statements.size();
+            }
+            parseSeconds += SecondsSince(started);
+        }
+        Require(wio::Logger::get().getErrorCount() == 0, "std modules parse cleanly");
+        Require(statements > files.size(), "std modules produce statements");
+
+        std::cout << "lexer-parser std files=" << files.size()
+                  << " kb=" << corpus.size() / 1024
+                  << " tokens=" << tokenCount
+                  << " names=" << wio::common::Name::InternedCount()
+                  << " lex_mbps=" << static_cast<std::uint64_t>(megabytes * static_cast<double>(passes) / lexSeconds)
+                  << " lex_parse_mbps=" << static_cast<std::uint64_t>(megabytes * static_cast<double>(passes) / parseSeconds)
+                  << '\n';
+        std::cout << "lexer-parser-throughput-ok\n";
+        return 0;
+    }
+    catch (const std::exception& error)
+    {
+        std::cerr << error.what() << '\n';
+        return 1;
+    }
+}
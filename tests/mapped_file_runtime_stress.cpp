@@ -0,0 +1,263 @@
+#include "std_io.h"
+
+#include <charconv>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+    namespace stdio = wio::runtime::std_io;
+    namespace fs = std::filesystem;
+    using Clock = std::chrono::steady_clock;
+
+    void Require(const bool condition, const char* message)
+    {
+        if (!condition)
+            throw std::runtime_error(message);
+    }
+
+    std::size_t ReadCount(const char* name, const std::size_t fallback)
+    {
+        const char* value = std::getenv(name);
+        if (!value || !*value)
+            return fallback;
+        const auto parsed = std::strtoull(value, nullptr, 10);
+        return parsed == 0 ? fallback : static_cast<std::size_t>(parsed);
+    }
+
+    double SecondsSince(const Clock::time_point started)
+    {
+        return std::chrono::duration<double>(Clock::now() - started).count();
+    }
+
+    void WriteFile(const fs::path& path, const std::string& contents)
+    {
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        out << contents;
+        Require(static_cast<bool>(out), "write fixture");
+    }
+
+    std::vector<std::string> MappedLines(const stdio::MappedFile& file, const bool trimCarriageReturn)
+    {
+        std::vector<std::string> lines;
+        std::size_t offset = 0, start = 0, count = 0;
+        while (stdio::NextLine(file.View(), offset, trimCarriageReturn, start, count))
+            lines.emplace_back(file.View().substr(start, count));
+        return lines;
+    }
+
+    std::vector<std::string> ReadLines(const fs::path& path, const bool trimCarriageReturn)
+    {
+        auto file = stdio::Open(path.string(), stdio::open_read_binary);
+        const auto size = stdio::Size(file);
+        std::vector<std::string> lines;
+        while (static_cast<std::uint64_t>(stdio::Tell(file)) < size)
+            lines.push_back(stdio::ReadLine(file, trimCarriageReturn));
+        stdio::Close(file);
+        return lines;
+    }
+
+    // Mapped iteration must agree with ReadLine on every shape of line ending.
+    void CheckSemantics(const fs::path& directory)
+    {
+        const std::vector<std::string> samples = {
+            "",
+            "single",
+            "single\n",
+            "a\nb\nc",
+            "a\r\nb\r\n\r\n",
+            "\n\n\n",
+            "trailing\r",
+            std::string(70000, 'x') + "\n" + std::string(5000, 'y'),
+        };
+
+        const auto path = directory / "sample.txt";
+        for (const auto& sample : samples)
+        {
+            WriteFile(path, sample);
+            const stdio::MappedFile mapped(path.string());
+            Require(mapped.Size() == sample.size() && mapped.View() == sample, "mapped bytes");
+            Require(mapped.IsMapped() == !sample.empty(), "regular files map unless empty");
+            for (const bool trim : {false, true})
+                Require(MappedLines(mapped, trim) == ReadLines(path, trim), "lines agree with ReadLine");
+            Require(stdio::CountLines(mapped.View()) == ReadLines(path, false).size(), "line count");
+        }
+
+        WriteFile(path, "a,,b,\nc");
+        auto* handle = stdio::MapFile(path.string());
+        std::size_t start = 0, count = 0;
+        std::vector<std::string> fields;
+        for (std::size_t index = 0; stdio::MappingField(handle, 0, 5, ',', index, start, count); ++index)
+            fields.push_back(stdio::MappingText(handle, start, count));
+        Require((fields == std::vector<std::string>{"a", "", "b", ""}), "fields include empty ones");
+        Require(stdio::MappingField(handle, 6, 1, ',', 0, start, count) && start == 6 && count == 1, "last record field");
+        Require(stdio::MappingText(handle, 5, 100) == "\nc", "text is clamped");
+        Require(stdio::MappingText(handle, 100, 1).empty(), "text past end");
+        std::int64_t integer = 0;
+        Require(!stdio::MappingParseI64(handle, 0, 1, integer), "non-numeric field");
+        stdio::ReleaseMapping(handle);
+
+        WriteFile(path, " -42 |+17|9223372036854775808|3.5e2|");
+        handle = stdio::MapFile(path.string());
+        double number = 0;
+        Require(stdio::MappingParseI64(handle, 0, 5, integer) && integer == -42, "padded integer");
+        Require(stdio::MappingParseI64(handle, 6, 3, integer) && integer == 17, "plus sign");
+        Require(!stdio::MappingParseI64(handle, 10, 19, integer), "integer overflow");
+        Require(stdio::MappingParseF64(handle, 30, 5, number) && number == 350.0, "float");
+        Require(!stdio::MappingParseF64(handle, 35, 1, number), "separator is not a number");
+        stdio::ReleaseMapping(handle);
+
+        stdio::FileError error{};
+        stdio::NativeErrorCode nativeError = 0;
+        std::string message;
+        handle = stdio::MapFile((directory / "missing.txt").string());
+        Require(!stdio::TryValidateMapping(handle, error, nativeError, message), "missing file fails");
+        Require(error == stdio::FileError::open_failed && !message.empty(), "missing file error");
+        Require(stdio::MappingSize(handle) == 0 && !stdio::MappingNextLine(handle, start, true, start, count),
+                "failed mapping is empty");
+        stdio::ReleaseMapping(handle);
+
+#if defined(__linux__)
+        // procfs reports a zero size but has contents: the read fallback.
+        const stdio::MappedFile status("/proc/self/status");
+        Require(!status.IsMapped() && status.View().find("Name:") != std::string_view::npos, "procfs fallback");
+#endif
+
+        stdio::MappedFile moved(path.string());
+        stdio::MappedFile target(std::move(moved));
+        Require(moved.Size() == 0 && target.Size() == 36 && target.View().starts_with(" -42"), "move keeps the view");
+        WriteFile(path, "short");
+        stdio::MappedFile small(path.string());
+        target = std::move(small);
+        Require(target.View() == "short", "move assignment");
+    }
+
+    // Log-shaped records: timestamp,level,latency_us,bytes. Sized in MiB by
+    // WIO_MMAP_STRESS_MB; set it to a few thousand for a multi-GB run.
+    std::uint64_t WriteCorpus(const fs::path& path, const std::size_t megabytes, std::uint64_t& expectedSum)
+    {
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        const char* levels[] = {"INFO", "WARN", "DEBUG", "ERROR"};
+        std::string chunk;
+        std::uint64_t lines = 0, written = 0, state = 88172645463325252ull;
+        expectedSum = 0;
+        while (written < megabytes * 1024u * 1024u)
+        {
+            chunk.clear();
+            for (int i = 0; i < 4096; ++i)
+            {
+                state ^= state << 13u;
+                state ^= state >> 7u;
+                state ^= state << 17u;
+                const auto latency = state % 250000u;
+                expectedSum += latency;
+                chunk += "2026-10-18T12:00:";
+                chunk += std::to_string(lines % 60u);
+                chunk += ',';
+                chunk += levels[state >> 62u];
+                chunk += ',';
+                chunk += std::to_string(latency);
+                chunk += ',';
+                chunk += std::to_string(state % 65536u);
+                chunk += '\n';
+                ++lines;
+            }
+            out << chunk;
+            written += chunk.size();
+        }
+        Require(static_cast<bool>(out), "write corpus");
+        return lines;
+    }
+
+    std::uint64_t ThirdField(const std::string_view line)
+    {
+        std::size_t start = 0;
+        for (int field = 0; field < 2; ++field)
+            start = line.find(',', start) + 1u;
+        const auto end = line.find(',', start);
+        std::uint64_t value = 0;
+        std::from_chars(line.data() + start, line.data() + end, value);
+        return value;
+    }
+
+    void Measure(const fs::path& directory)
+    {
+        const auto megabytes = ReadCount("WIO_MMAP_STRESS_MB", 8);
+        const auto path = directory / "corpus.log";
+        std::uint64_t expectedSum = 0;
+        const auto expectedLines = WriteCorpus(path, megabytes, expectedSum);
+        const double size = static_cast<double>(fs::file_size(path)) / 1e6;
+
+        auto started = Clock::now();
+        std::uint64_t lines = 0, sum = 0;
+        {
+            auto file = stdio::Open(path.string(), stdio::open_read_binary);
+            const auto total = stdio::Size(file);
+            while (static_cast<std::uint64_t>(stdio::Tell(file)) < total)
+            {
+                const auto line = stdio::ReadLine(file, true);
+                ++lines;
+                sum += ThirdField(line);
+            }
+            stdio::Close(file);
+        }
+        const double readLineSeconds = SecondsSince(started);
+        Require(lines == expectedLines && sum == expectedSum, "ReadLine totals");
+
+        started = Clock::now();
+        lines = 0;
+        sum = 0;
+        {
+            const stdio::MappedFile mapped(path.string());
+            std::size_t offset = 0, start = 0, count = 0;
+            while (stdio::NextLine(mapped.View(), offset, true, start, count))
+            {
+                ++lines;
+                sum += ThirdField(mapped.View().substr(start, count));
+            }
+        }
+        const double mappedSeconds = SecondsSince(started);
+        Require(lines == expectedLines && sum == expectedSum, "mapped totals");
+
+        started = Clock::now();
+        const auto counted = stdio::CountLines(stdio::MappedFile(path.string()).View());
+        const double countSeconds = SecondsSince(started);
+        Require(counted == expectedLines, "CountLines total");
+
+        std::cout << "corpus mb=" << static_cast<std::uint64_t>(size) << " lines=" << lines
+                  << " readline_mbps=" << static_cast<std::uint64_t>(size / readLineSeconds)
+                  << " mapped_mbps=" << static_cast<std::uint64_t>(size / mappedSeconds)
+                  << " count_mbps=" << static_cast<std::uint64_t>(size / countSeconds) << '\n';
+        fs::remove(path);
+    }
+}
+
+int main()
+{
+    const auto directory = fs::temp_directory_path() / ("wio_mapped_file_stress_" + std::to_string(
+        static_cast<unsigned long long>(Clock::now().time_since_epoch().count())));
+    try
+    {
+        fs::create_directories(directory);
+        CheckSemantics(directory);
+        Measure(directory);
+        fs::remove_all(directory);
+        std::cout << "mapped-file-runtime-stress-ok\n";
+        return 0;
+    }
+    catch (const std::exception& error)
+    {
+        std::error_code ignored;
+        fs::remove_all(directory, ignored);
+        std::cerr << error.what() << '\n';
+        return 1;
+    }
+}
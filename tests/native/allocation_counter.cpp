@@ -0,0 +1,51 @@
+// Counts every global operator new and reports the total on exit. Linked
+// into a Wio program through --backend-arg to compare heap traffic between
+// builds, e.g. by cmake/RunWioStackObjectBench.cmake.
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+    std::atomic<unsigned long long> gAllocations{0};
+
+    void* CountedAllocate(const std::size_t size)
+    {
+        gAllocations.fetch_add(1, std::memory_order_relaxed);
+        if (void* memory = std::malloc(size == 0 ? 1 : size))
+            return memory;
+        throw std::bad_alloc();
+    }
+
+    void* CountedAllocate(const std::size_t size, const std::align_val_t alignment)
+    {
+        gAllocations.fetch_add(1, std::memory_order_relaxed);
+        const auto align = static_cast<std::size_t>(alignment);
+        if (void* memory = std::aligned_alloc(align, (size + align - 1) / align * align + (size == 0 ? align : 0)))
+            return memory;
+        throw std::bad_alloc();
+    }
+
+    struct Reporter final
+    {
+        ~Reporter()
+        {
+            std::fprintf(stderr, "wio-heap-allocations: %llu\n", gAllocations.load());
+        }
+    } gReporter;
+}
+
+void* operator new(const std::size_t size) { return CountedAllocate(size); }
+void* operator new[](const std::size_t size) { return CountedAllocate(size); }
+void* operator new(const std::size_t size, const std::align_val_t alignment) { return CountedAllocate(size, alignment); }
+void* operator new[](const std::size_t size, const std::align_val_t alignment) { return CountedAllocate(size, alignment); }
+
+void operator delete(void* memory) noexcept { std::free(memory); }
+void operator delete[](void* memory) noexcept { std::free(memory); }
+void operator delete(void* memory, std::size_t) noexcept { std::free(memory); }
+void operator delete[](void* memory, std::size_t) noexcept { std::free(memory); }
+void operator delete(void* memory, std::align_val_t) noexcept { std::free(memory); }
+void operator delete[](void* memory, std::align_val_t) noexcept { std::free(memory); }
+void operator delete(void* memory, std::size_t, std::align_val_t) noexcept { std::free(memory); }
+void operator delete[](void* memory, std::size_t, std::align_val_t) noexcept { std::free(memory); }
@@ -0,0 +1,48 @@
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <wio_sdk.h>
+
+int main(int argc, char** argv)
+{
+    if (argc < 3)
+    {
+        std::cerr << "SDK hot reload watch host expected two library paths." << '\n';
+        return EXIT_FAILURE;
+    }
+
+    try
+    {
+        namespace fs = std::filesystem;
+        const fs::path first = fs::absolute(argv[1]);
+        const fs::path live = first.parent_path() / "sdk_hot_reload_watch" / first.filename();
+        fs::create_directories(live.parent_path());
+        fs::copy_file(first, live, fs::copy_options::overwrite_existing);
+
+        auto module = wio::sdk::HotReloadModule::load(live);
+        const bool unchanged = module.reload_if_changed();
+
+        // Replace the library the way a rebuild would, with a strictly newer
+        // write time even on filesystems with coarse timestamps.
+        const auto loadedWriteTime = fs::last_write_time(live);
+        fs::copy_file(argv[2], live, fs::copy_options::overwrite_existing);
+        fs::last_write_time(live, loadedWriteTime + std::chrono::seconds(2));
+
+        const bool changed = module.reload_if_changed();
+        const bool again = module.reload_if_changed();
+
+        std::cout << "SDK reload watch: unchanged=" << unchanged
+                  << " changed=" << changed
+                  << " again=" << again
+                  << " generation=" << module.generation()
+                  << '\n';
+    }
+    catch (const std::exception& ex)
+    {
+        std::cerr << ex.what() << '\n';
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -67,11 +67,13 @@ namespace
     {
         void* child = SpawnSelf({"--wait-child"});
         auto task = startOperation(child);
-        process::ProcessClose(child);
-        Require(process::LiveProcessCount() == baseline + 1,
+        // Sampled before Close, which wakes the parked operation at once and
+        // lets it drop its lease.
+        Require(process::LiveProcessCount() == baseline + 1 && process::ProcessLeaseCount(child) == 1,
             "async process operation acquires ownership before returning");
-        const auto result = wio::runtime::std_async_process::detail::Decode(
-            wio::runtime::BlockOn(task));
+        process::ProcessClose(child);
+        auto completion = wio::runtime::BlockOn(task);
+        const auto& result = wio::runtime::std_async_process::detail::Take(completion);
         Require(!result.succeeded && result.error == process::ProcessError::process_closed,
             "pre-leased asynchronous operation observes process close");
         Require(process::LiveProcessCount() == baseline,
@@ -133,11 +135,11 @@ int main(const int argc, char* argv[])
         {
             void* waitingChild = SpawnSelf({"--wait-child"});
             auto readTask = wio::runtime::std_async_process::ReadStdout(waitingChild, 32);
-            process::ProcessClose(waitingChild);
-            Require(process::LiveProcessCount() == baseline + 1,
+            Require(process::LiveProcessCount() == baseline + 1 && process::ProcessLeaseCount(waitingChild) == 1,
                 "async stdout read acquires ownership before returning");
-            const auto result = wio::runtime::std_async_process::detail::Decode(
-                wio::runtime::BlockOn(readTask));
+            process::ProcessClose(waitingChild);
+            auto completion = wio::runtime::BlockOn(readTask);
+            const auto& result = wio::runtime::std_async_process::detail::Take(completion);
             Require(!result.succeeded && result.error == process::ProcessError::process_closed,
                 "close interrupts a pre-leased asynchronous pipe read");
         }
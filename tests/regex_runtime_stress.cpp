@@ -0,0 +1,331 @@
+#include "std_regex.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <regex>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace
+{
+    namespace rx = wio::runtime::std_regex;
+    using Clock = std::chrono::steady_clock;
+
+    void Require(const bool condition, const std::string& message)
+    {
+        if (!condition)
+            throw std::runtime_error(message);
+    }
+
+    std::size_t ReadCount(const char* name, const std::size_t fallback)
+    {
+        const char* value = std::getenv(name);
+        if (!value || !*value)
+            return fallback;
+        const auto parsed = std::strtoull(value, nullptr, 10);
+        return parsed == 0 ? fallback : static_cast<std::size_t>(parsed);
+    }
+
+    double SecondsSince(const Clock::time_point started)
+    {
+        return std::chrono::duration<double>(Clock::now() - started).count();
+    }
+
+    // Everything the std::regex-only implementation reported for one
+    // pattern and input, used as the reference for the automaton.
+    struct Outcome
+    {
+        bool valid = true;
+        bool matched = false;
+        bool found = false;
+        std::size_t index = 0;
+        std::size_t length = 0;
+        std::vector<std::string> groups;
+        std::vector<std::string> all;
+        std::string replaced;
+        std::vector<std::string> split;
+
+        bool operator==(const Outcome&) const = default;
+    };
+
+    constexpr const char* replacement = "<$&|$1|$2|$`|$'|$$|$9>";
+
+    Outcome Reference(const std::string& input, const std::string& pattern, const bool ignoreCase)
+    {
+        Outcome outcome;
+        std::regex expression;
+        try
+        {
+            auto flags = std::regex_constants::ECMAScript;
+            if (ignoreCase)
+                flags |= std::regex_constants::icase;
+            expression = std::regex(pattern, flags);
+        }
+        catch (const std::regex_error&)
+        {
+            outcome.valid = false;
+            return outcome;
+        }
+
+        outcome.matched = std::regex_search(input, expression);
+        std::smatch match;
+        outcome.found = std::regex_search(input, match, expression);
+        if (outcome.found)
+        {
+            outcome.index = static_cast<std::size_t>(match.position());
+            outcome.length = static_cast<std::size_t>(match.length());
+            for (std::size_t i = 1; i < match.size(); ++i)
+                outcome.groups.push_back(match[i].matched ? match[i].str() : std::string{});
+        }
+        for (std::sregex_iterator it(input.begin(), input.end(), expression), end; it != end; ++it)
+            outcome.all.push_back(it->str());
+        outcome.replaced = std::regex_replace(input, expression, std::string(replacement));
+        for (std::sregex_token_iterator it(input.begin(), input.end(), expression, -1), end; it != end; ++it)
+            outcome.split.push_back(it->str());
+        return outcome;
+    }
+
+    Outcome Actual(const std::string& input, const std::string& pattern, const bool ignoreCase)
+    {
+        Outcome outcome;
+        rx::RegexError error{};
+        std::string message;
+        std::string value;
+        if (!rx::TryIsMatch(input, pattern, ignoreCase, outcome.matched, error, message))
+        {
+            Require(error == rx::RegexError::invalid_pattern, "unexpected error kind for " + pattern);
+            outcome = Outcome{};
+            outcome.valid = false;
+            return outcome;
+        }
+        Require(rx::TryFind(input, pattern, ignoreCase, outcome.found, outcome.index, outcome.length, value,
+                            outcome.groups, error, message), "find failed");
+        if (!outcome.found)
+        {
+            outcome.index = 0;
+            outcome.length = 0;
+        }
+        Require(rx::TryFindAll(input, pattern, ignoreCase, outcome.all, error, message), "find all failed");
+        Require(rx::TryReplace(input, pattern, replacement, ignoreCase, outcome.replaced, error, message),
+                "replace failed");
+        Require(rx::TrySplit(input, pattern, ignoreCase, outcome.split, error, message), "split failed");
+        return outcome;
+    }
+
+    void Compare(const std::string& input, const std::string& pattern, const bool ignoreCase)
+    {
+        Require(Actual(input, pattern, ignoreCase) == Reference(input, pattern, ignoreCase),
+                "engine differs from std::regex for /" + pattern + "/ on \"" + input + "\"" +
+                (ignoreCase ? " (icase)" : ""));
+    }
+
+    bool Linear(const std::string& pattern)
+    {
+        void* handle = rx::Compile(pattern, false);
+        const bool linear = rx::UsesLinearEngine(handle);
+        rx::Release(handle);
+        return linear;
+    }
+
+    void CheckSemantics()
+    {
+        const std::vector<std::string> patterns = {
+            "", "a", "abc", "a|b", "a||b", "|", "(a|ab)(c|bcd)?", "((a)|b)+", "a*?", "a+?b",
+            "(.*?)-(\\d+)", "^(.*?)\\s+([A-Za-z_]\\w*)$", "^abc", "abc$", "^$", "$^", "^", "$", "\\bfoo\\b",
+            "\\Bo", "\\b", "[a-c]+", "[^a-c]+", "[-a]", "[a-]", "[\\w-]+", "[\\s\\S]*?x", "[\\]]", "\\x41\\x2d",
+            "a{2}", "a{2,}", "a{1,3}?", "a{0}", "(?:ab){2,3}", "(a)(b)?(c)", "\\d+(?:\\.\\d+)?", "()", "(?:)",
+            "x*", ".", "a.c", "[.]", "\\.", "\\/\\*[\\s\\S]*?\\*\\/", "//[^\\r\\n]*", "namespace\\s+([A-Za-z_]\\w*)\\s*\\{",
+            "([a-z]+)-(\\d+)", "[Z-a]+", "(TODO|FIXME|HACK)", "\\w+@\\w+\\.com", "(a+)+$"};
+        const std::vector<std::string> inputs = {
+            "", "a", "ab", "abc", "aab", "xabcx", "aaa", "b-12 c-345", "foo food foo", "Wio-2026 x-1",
+            "// line\n/* block\n comment */ code", "namespace  wio_core {", "int  value", "A-B ]a]", "a\nb\rc",
+            "TODO: fix; FIXME later; hack", "me@example.com you@wio.com", "aaaaaaaab", "Zz[\\]^_`aA",
+            "caf\xc3\xa9 t\xc3\xa9"};
+
+        for (const auto& pattern : patterns)
+        {
+            Require(Linear(pattern), "expected the automaton to cover /" + pattern + "/");
+            for (const auto& input : inputs)
+            {
+                Compare(input, pattern, false);
+                Compare(input, pattern, true);
+            }
+        }
+
+        // Outside the automaton syntax: std::regex still runs these.
+        for (const std::string pattern : {"(a)\\1", "(a*)*", "(a|)*b", "a(?=b)", "a(?!b)", "[[:alpha:]]+", "a**", "\\cJ"})
+        {
+            Require(!Linear(pattern), "expected a std::regex fallback for /" + pattern + "/");
+            for (const auto& input : inputs)
+                Compare(input, pattern, false);
+        }
+
+        // Invalid patterns report std::regex's error through both entry points.
+        for (const std::string pattern : {"[", "(", "a)", "x{", "^*", "a{2,1}", "[z-a]"})
+        {
+            bool matched = false;
+            rx::RegexError error{};
+            std::string message;
+            Require(!rx::TryIsMatch("x", pattern, false, matched, error, message) &&
+                    error == rx::RegexError::invalid_pattern && !message.empty(), "invalid pattern /" + pattern + "/");
+            void* handle = rx::Compile(pattern, false);
+            Require(!rx::TryValidate(handle, error, message) && error == rx::RegexError::invalid_pattern,
+                    "invalid compiled pattern /" + pattern + "/");
+            Require(!rx::TryIsMatchCompiled(handle, "x", matched, error, message), "invalid handle matches");
+            rx::Release(handle);
+        }
+
+        // Nested quantifiers stay linear: this input takes std::regex's
+        // backtracking engine exponential time.
+        const std::string pathological = std::string(64, 'a') + "!";
+        bool matched = true;
+        rx::RegexError error{};
+        std::string message;
+        Require(rx::TryIsMatch(pathological, "^(a+)+$", false, matched, error, message) && !matched,
+                "nested quantifier on a near miss");
+        Require(rx::PatternLooksSafe("(a+)+") && !rx::PatternLooksSafe("(a+)+\\1"), "safety check");
+
+        rx::ClearPatternCache();
+        for (int i = 0; i < 200; ++i)
+            Require(rx::TryIsMatch("x", "x" + std::to_string(i), false, matched, error, message), "cache fill");
+        Require(rx::CachedPatternCount() == 64u, "cache is bounded");
+    }
+
+    // Small random patterns over a two-letter alphabet against random
+    // inputs; every operation must agree with std::regex.
+    void Fuzz(const std::size_t rounds)
+    {
+        std::mt19937 random(7);
+        const std::vector<std::string> atoms = {"a", "b", ".", "[ab]", "[^a]", "\\w", "\\s", "(a|b)", "(?:ab|a)",
+                                                "(a*)", "\\b", "^", "$", "()", "(b|)"};
+        const std::vector<std::string> quantifiers = {"", "", "", "*", "+", "?", "*?", "+?", "??", "{2}", "{1,2}",
+                                                      "{0,}?"};
+        for (std::size_t round = 0; round < rounds; ++round)
+        {
+            std::string pattern;
+            const auto length = 1u + random() % 5u;
+            for (std::size_t i = 0; i < length; ++i)
+            {
+                const auto& atom = atoms[random() % atoms.size()];
+                pattern += atom;
+                if (atom != "\\b" && atom != "^" && atom != "$")
+                    pattern += quantifiers[random() % quantifiers.size()];
+                if (random() % 6u == 0u)
+                    pattern += "|";
+            }
+            std::string input;
+            const auto inputLength = random() % 9u;
+            for (std::size_t i = 0; i < inputLength; ++i)
+                input.push_back("ab -A"[random() % 5u]);
+            Compare(input, pattern, random() % 4u == 0u);
+        }
+    }
+
+    std::string LogCorpus(const std::size_t lines)
+    {
+        std::mt19937_64 random(11);
+        static constexpr const char* levels[] = {"DEBUG", "INFO", "INFO", "INFO", "WARN", "ERROR"};
+        static constexpr const char* paths[] = {"/api/v1/users", "/api/v2/orders/search", "/static/app.js",
+                                                "/api/v1/health", "/login"};
+        std::string corpus;
+        for (std::size_t i = 0; i < lines; ++i)
+        {
+            char line[256];
+            const auto level = levels[random() % 6u];
+            const auto status = (random() % 20u == 0u) ? 500u + random() % 4u : 200u + random() % 5u;
+            std::snprintf(line, sizeof(line),
+                          "2026-03-%02u T%02u:%02u:%02u.%03uZ %s [worker-%u] %s %s HTTP/1.1 user=user_%u status=%u "
+                          "latency=%ums%s\n",
+                          static_cast<unsigned>(1u + random() % 28u), static_cast<unsigned>(random() % 24u),
+                          static_cast<unsigned>(random() % 60u), static_cast<unsigned>(random() % 60u),
+                          static_cast<unsigned>(random() % 1000u), level, static_cast<unsigned>(random() % 16u),
+                          random() % 3u == 0u ? "POST" : "GET", paths[random() % 5u],
+                          static_cast<unsigned>(random() % 5000u), static_cast<unsigned>(status),
+                          static_cast<unsigned>(random() % 900u),
+                          random() % 50u == 0u ? " timeout after 30000ms" : "");
+            corpus += line;
+        }
+        return corpus;
+    }
+
+    void MeasurePattern(const std::string& pattern, const std::vector<std::string>& lines, const std::size_t passes)
+    {
+        const std::regex reference(pattern, std::regex_constants::ECMAScript);
+        void* handle = rx::Compile(pattern, false);
+        Require(rx::UsesLinearEngine(handle), "benchmark pattern runs on the automaton");
+
+        std::size_t expected = 0;
+        auto started = Clock::now();
+        for (std::size_t pass = 0; pass < passes; ++pass)
+            for (const auto& line : lines)
+                expected += std::regex_search(line, reference) ? 1u : 0u;
+        const double referenceSeconds = SecondsSince(started);
+
+        std::size_t compiledHits = 0;
+        rx::RegexError error{};
+        std::string message;
+        started = Clock::now();
+        for (std::size_t pass = 0; pass < passes; ++pass)
+            for (const auto& line : lines)
+            {
+                bool matched = false;
+                Require(rx::TryIsMatchCompiled(handle, line, matched, error, message), "compiled match");
+                compiledHits += matched ? 1u : 0u;
+            }
+        const double compiledSeconds = SecondsSince(started);
+
+        std::size_t cachedHits = 0;
+        started = Clock::now();
+        for (std::size_t pass = 0; pass < passes; ++pass)
+            for (const auto& line : lines)
+            {
+                bool matched = false;
+                Require(rx::TryIsMatch(line, pattern, false, matched, error, message), "cached match");
+                cachedHits += matched ? 1u : 0u;
+            }
+        const double cachedSeconds = SecondsSince(started);
+        rx::Release(handle);
+
+        Require(compiledHits == expected && cachedHits == expected, "benchmark hit counts differ for " + pattern);
+        const double count = static_cast<double>(lines.size() * passes);
+        std::cout << "pattern=/" << pattern << "/ hits=" << expected / passes
+                  << " std_regex_lines_per_sec=" << static_cast<std::uint64_t>(count / referenceSeconds)
+                  << " compiled_lines_per_sec=" << static_cast<std::uint64_t>(count / compiledSeconds)
+                  << " cached_lines_per_sec=" << static_cast<std::uint64_t>(count / cachedSeconds)
+                  << " speedup=" << referenceSeconds / compiledSeconds << '\n';
+    }
+}
+
+int main()
+{
+    try
+    {
+        CheckSemantics();
+        Fuzz(ReadCount("WIO_REGEX_STRESS_FUZZ", 3000));
+
+        const auto passes = ReadCount("WIO_REGEX_STRESS_PASSES", 2);
+        const auto corpus = LogCorpus(ReadCount("WIO_REGEX_STRESS_LINES", 20000));
+        std::vector<std::string> lines;
+        for (std::size_t begin = 0; begin < corpus.size();)
+        {
+            const auto end = corpus.find('\n', begin);
+            lines.push_back(corpus.substr(begin, end - begin));
+            begin = end + 1u;
+        }
+        for (const std::string pattern : {"ERROR", "timeout after \\d+ms", "status=5\\d\\d",
+                                          "^\\d{4}-\\d{2}-\\d{2} T[0-9:.]+Z (WARN|ERROR) ",
+                                          "(GET|POST) /api/v\\d+/[a-z/]+ HTTP", "user=(\\w+) .*latency=\\d{3}ms"})
+            MeasurePattern(pattern, lines, passes);
+        std::cout << "regex-runtime-stress-ok\n";
+        return 0;
+    }
+    catch (const std::exception& error)
+    {
+        std::cerr << error.what() << '\n';
+        return 1;
+    }
+}
@@ -0,0 +1,196 @@
+#include "format.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+    std::atomic<std::uint64_t> gAllocations{0};
+
+    using Clock = std::chrono::steady_clock;
+    namespace rt = wio::runtime;
+
+    enum class Level : std::int8_t { Info = 1, Error = 4 };
+    enum class Marker : char { Open = '[', Close = ']' };
+
+    struct Named
+    {
+        std::string _WF_ToString() const { return "named"; }
+    };
+
+    void Require(const bool condition, const char* message)
+    {
+        if (!condition)
+            throw std::runtime_error(message);
+    }
+
+    std::size_t ReadCount(const char* name, const std::size_t fallback)
+    {
+        const char* value = std::getenv(name);
+        if (!value || !*value)
+            return fallback;
+        const auto parsed = std::strtoull(value, nullptr, 10);
+        return parsed == 0 ? fallback : static_cast<std::size_t>(parsed);
+    }
+
+    template <typename TValue>
+    void RequireSameText(const TValue& value, const char* message)
+    {
+        Require(rt::Concat(value) == rt::Format("{}", value), message);
+    }
+
+    // Concat must print every value exactly as the Format-based lowering did.
+    void CheckSemantics()
+    {
+        RequireSameText(std::int32_t{-5}, "negative int");
+        RequireSameText(std::numeric_limits<std::int64_t>::min(), "int64 min");
+        RequireSameText(std::numeric_limits<std::uint64_t>::max(), "uint64 max");
+        RequireSameText(static_cast<signed char>(-3), "i8 prints as a number");
+        RequireSameText(static_cast<unsigned char>(200), "u8 prints as a number");
+        RequireSameText('x', "char prints as a character");
+        RequireSameText(true, "bool");
+        for (const double value : {0.1 + 0.2, 2.5, -0.0, 1e20, 1e-7, 123456789.0, 1.0 / 3.0,
+                                   std::numeric_limits<double>::infinity()})
+            RequireSameText(value, "double uses the stream format");
+        for (const float value : {3.14159f, 0.1f, 1e10f})
+            RequireSameText(value, "float uses the stream format");
+        RequireSameText(Level::Error, "enum prints its value");
+        RequireSameText(Marker::Open, "char enum prints its character");
+        RequireSameText(std::string("text"), "string");
+        RequireSameText(std::string_view("view"), "string view");
+        RequireSameText(static_cast<const char*>(nullptr), "null C string");
+        RequireSameText(Named{}, "ToString");
+        RequireSameText(std::vector<int>{1, 2, 3}, "array");
+        RequireSameText((std::map<std::string, int>{{"a", 1}, {"b", 2}}), "dictionary");
+
+        Require(rt::Concat().empty(), "no pieces");
+        Require(rt::Concat("a{}b", 1, "{}") == "a{}b1{}", "braces in literal text are not markers");
+        Require(rt::Concat("id=", 42, ", ok=", false, ", ratio=", 0.5, ", tag=", 'q') ==
+                    "id=42, ok=false, ratio=0.5, tag=q",
+                "mixed pieces");
+    }
+
+    std::string Wrap(const std::string& value)
+    {
+        return rt::Concat("[", value, "]");
+    }
+
+    struct Shape
+    {
+        const char* name;
+        std::string (*before)(std::size_t);
+        std::string (*after)(std::size_t);
+    };
+
+    const std::string kMessage = "unexpected character while reading an object key";
+    const std::string kLevel = "INFO";
+    const std::string kLogger = "std::json";
+    const std::string kJoined = "alpha,beta,gamma,delta,epsilon,zeta,eta,theta,iota,kappa,lambda,mu,nu,xi";
+
+    // Each pair is the old lowering of one source expression and its Concat
+    // lowering: interpolations went through Format, `+` chains through
+    // nested std::string temporaries.
+    const Shape kShapes[] = {
+        {
+            "json_error",
+            [](std::size_t i) { return rt::Format("JSON parse error at byte {}: {}", i, kMessage); },
+            [](std::size_t i) { return rt::Concat("JSON parse error at byte ", i, ": ", kMessage); },
+        },
+        {
+            "bracket_join",
+            [](std::size_t) { return (std::string((std::string("[") + kJoined)) + "]"); },
+            [](std::size_t) { return rt::Concat("[", kJoined, "]"); },
+        },
+        {
+            "log_line",
+            [](std::size_t i)
+            {
+                return rt::Format("2026-10-18T12:00:00 [{}] {}: {} ({} ms)", kLevel, kLogger, kMessage,
+                                  static_cast<double>(i % 1000) / 8.0);
+            },
+            [](std::size_t i)
+            {
+                return rt::Concat("2026-10-18T12:00:00 [", kLevel, "] ", kLogger, ": ", kMessage, " (",
+                                  static_cast<double>(i % 1000) / 8.0, " ms)");
+            },
+        },
+        {
+            "nested_interpolation",
+            [](std::size_t) { return rt::Format("nested=value={}", rt::Format("[{}]", std::string("deep"))); },
+            [](std::size_t) { return rt::Concat("nested=value=", Wrap("deep")); },
+        },
+    };
+
+    void Measure()
+    {
+        const auto iterations = ReadCount("WIO_CONCAT_STRESS_ITERATIONS", 200000);
+        for (const auto& shape : kShapes)
+        {
+            Require(shape.before(7) == shape.after(7), "lowerings agree");
+
+            std::uint64_t lengths = 0;
+            auto allocations = gAllocations.load(std::memory_order_relaxed);
+            auto started = Clock::now();
+            for (std::size_t i = 0; i < iterations; ++i)
+                lengths += shape.before(i).size();
+            const double beforeSeconds = std::chrono::duration<double>(Clock::now() - started).count();
+            const auto beforeAllocations = gAllocations.load(std::memory_order_relaxed) - allocations;
+
+            allocations = gAllocations.load(std::memory_order_relaxed);
+            started = Clock::now();
+            for (std::size_t i = 0; i < iterations; ++i)
+                lengths -= shape.after(i).size();
+            const double afterSeconds = std::chrono::duration<double>(Clock::now() - started).count();
+            const auto afterAllocations = gAllocations.load(std::memory_order_relaxed) - allocations;
+
+            Require(lengths == 0, "same lengths");
+            // Every result outgrows the small-string buffer; Wrap's does not.
+            Require(afterAllocations == iterations, "Concat allocates once per result");
+            Require(afterAllocations < beforeAllocations, "Concat allocates less than the old lowering");
+
+            std::cout << shape.name
+                      << " before_allocs_per_op=" << static_cast<double>(beforeAllocations) / static_cast<double>(iterations)
+                      << " after_allocs_per_op=" << static_cast<double>(afterAllocations) / static_cast<double>(iterations)
+                      << " before_ns_per_op=" << static_cast<std::uint64_t>(beforeSeconds * 1e9 / static_cast<double>(iterations))
+                      << " after_ns_per_op=" << static_cast<std::uint64_t>(afterSeconds * 1e9 / static_cast<double>(iterations))
+                      << '\n';
+        }
+    }
+}
+
+void* operator new(const std::size_t size)
+{
+    gAllocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* memory = std::malloc(size == 0 ? 1 : size))
+        return memory;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* memory) noexcept { std::free(memory); }
+void operator delete(void* memory, std::size_t) noexcept { std::free(memory); }
+
+int main()
+{
+    try
+    {
+        CheckSemantics();
+        Measure();
+        std::cout << "string-concat-runtime-stress-ok\n";
+        return 0;
+    }
+    catch (const std::exception& error)
+    {
+        std::cerr << error.what() << '\n';
+        return 1;
+    }
+}
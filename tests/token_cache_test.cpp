@@ -0,0 +1,91 @@
+#include "wio/lexer/token_cache.h"
+
+#include <chrono>
+#include <filesystem>
+#include <iostream>
+#include <string>
+
+int main()
+{
+    namespace fs = std::filesystem;
+
+    const std::string source = "import std::console;\nfn main() { let text = \"cached\"; }\n";
+    const std::string identity = "test-compiler";
+
+    const wio::TokenCache disabled;
+    const auto reference = disabled.lex(source, "reference.wio");
+    if (disabled.enabled() || disabled.hitCount() != 0 || disabled.missCount() != 0 || reference.empty())
+    {
+        std::cerr << "a disabled cache must lex without counting lookups\n";
+        return 1;
+    }
+
+    const auto data = wio::TokenCache::serialize(identity, source, reference);
+    const auto restored = wio::TokenCache::deserialize(data, identity, source, "restored.wio");
+    if (!restored || restored->size() != reference.size())
+    {
+        std::cerr << "serialized tokens must round-trip\n";
+        return 1;
+    }
+    for (size_t index = 0; index < reference.size(); ++index)
+    {
+        const auto& expected = reference[index];
+        const auto& actual = (*restored)[index];
+        if (actual.type != expected.type || actual.value != expected.value ||
+            actual.isUnicodeString != expected.isUnicodeString ||
+            actual.loc.line != expected.loc.line || actual.loc.column != expected.loc.column ||
+            actual.offset != expected.offset || actual.length != expected.length ||
+            actual.loc.file != "restored.wio")
+        {
+            std::cerr << "round-tripped token " << index << " differs from the lexer output\n";
+            return 1;
+        }
+    }
+
+    // Identifier lexemes are stored as source ranges, not copied bytes.
+    if (data.find("main") != std::string::npos || reference[0].value != source.substr(reference[0].offset, reference[0].length))
+    {
+        std::cerr << "lexeme tokens must reference the source buffer\n";
+        return 1;
+    }
+
+    if (wio::TokenCache::deserialize(data, "other-compiler", source, "x.wio") ||
+        wio::TokenCache::deserialize(data, identity, source + " ", "x.wio") ||
+        wio::TokenCache::deserialize(data.substr(0, data.size() - 1), identity, source, "x.wio") ||
+        wio::TokenCache::deserialize(data + "x", identity, source, "x.wio"))
+    {
+        std::cerr << "mismatched identity, source, or truncated data must be rejected\n";
+        return 1;
+    }
+
+    auto forged = reference;
+    forged.front().type = static_cast<wio::TokenType>(0xff);
+    if (wio::TokenCache::deserialize(wio::TokenCache::serialize(identity, source, forged), identity, source, "x.wio"))
+    {
+        std::cerr << "an out-of-range token type must be rejected\n";
+        return 1;
+    }
+
+    const auto unique = std::chrono::steady_clock::now().time_since_epoch().count();
+    const fs::path root = fs::temp_directory_path() / ("wio-token-cache-" + std::to_string(unique));
+    std::error_code cleanupError;
+
+    const wio::TokenCache cache(root, identity);
+    const auto first = cache.lex(source, "first.wio");
+    const auto second = cache.lex(source, "second.wio");
+    const auto edited = cache.lex(source + "// edited\n", "first.wio");
+    fs::remove_all(root, cleanupError);
+
+    if (cache.missCount() != 2 || cache.hitCount() != 1)
+    {
+        std::cerr << "identical sources must hit and edited sources must miss\n";
+        return 1;
+    }
+    if (second.size() != first.size() || second.front().loc.file != "second.wio" || edited.size() < first.size())
+    {
+        std::cerr << "cache hits must be re-attributed to the requesting file\n";
+        return 1;
+    }
+
+    return 0;
+}
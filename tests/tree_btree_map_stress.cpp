@@ -0,0 +1,315 @@
+#include <wio_btree_map.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <iterator>
+#include <map>
+#include <new>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace
+{
+    std::atomic<std::int64_t> gLiveBytes{0};
+    std::atomic<std::int64_t> gLiveAllocations{0};
+
+    using Clock = std::chrono::steady_clock;
+
+    void Require(const bool condition, const char* message)
+    {
+        if (!condition)
+            throw std::runtime_error(message);
+    }
+
+    std::size_t ReadCount(const char* name, const std::size_t fallback)
+    {
+        const char* value = std::getenv(name);
+        if (!value || !*value)
+            return fallback;
+        const auto parsed = std::strtoull(value, nullptr, 10);
+        return parsed == 0 ? fallback : static_cast<std::size_t>(parsed);
+    }
+
+    template <typename Tree, typename Map>
+    void RequireSame(const Tree& tree, const Map& map, const char* message)
+    {
+        Require(tree.size() == map.size(), message);
+        auto expected = map.begin();
+        for (const auto& [key, value] : tree)
+        {
+            Require(key == expected->first && value == expected->second, message);
+            ++expected;
+        }
+        auto reversed = map.rbegin();
+        for (auto it = tree.rbegin(); it != tree.rend(); ++it, ++reversed)
+            Require(it->first == reversed->first, message);
+    }
+
+    template <typename Tree, typename Map, typename Key>
+    void RequireSameBounds(const Tree& tree, const Map& map, const Key& key)
+    {
+        const auto lower = tree.lower_bound(key);
+        const auto expectedLower = map.lower_bound(key);
+        Require((lower == tree.end()) == (expectedLower == map.end()), "lower_bound end");
+        Require(lower == tree.end() || lower->first == expectedLower->first, "lower_bound key");
+        const auto upper = tree.upper_bound(key);
+        const auto expectedUpper = map.upper_bound(key);
+        Require((upper == tree.end()) == (expectedUpper == map.end()), "upper_bound end");
+        Require(upper == tree.end() || upper->first == expectedUpper->first, "upper_bound key");
+    }
+
+    // Replays random inserts, erases and bound queries against std::map so
+    // every split, borrow and merge path runs at several tree heights.
+    template <typename Key, typename MakeKey>
+    void CheckAgainstStdMap(const std::uint64_t keyRange, MakeKey makeKey)
+    {
+        std::mt19937_64 random(keyRange);
+        wio::BTreeMap<Key, std::string> tree;
+        std::map<Key, std::string> map;
+        for (std::size_t step = 0; step < 60000; ++step)
+        {
+            const Key key = makeKey(random() % keyRange);
+            const auto action = random() % 10;
+            if (action < 4)
+            {
+                const auto inserted = tree.try_emplace(key, std::to_string(step));
+                Require(inserted.second == map.try_emplace(key, std::to_string(step)).second, "try_emplace result");
+                Require(inserted.first->first == key && inserted.first->second == map[key], "try_emplace entry");
+            }
+            else if (action < 7)
+            {
+                Require(tree.erase(key) == map.erase(key), "erase by key");
+            }
+            else if (action < 8)
+            {
+                RequireSameBounds(tree, map, key);
+            }
+            else if (action < 9)
+            {
+                auto position = tree.lower_bound(key);
+                if (position != tree.end())
+                {
+                    const auto next = tree.erase(position);
+                    const auto expected = map.erase(map.lower_bound(key));
+                    Require((next == tree.end()) == (expected == map.end()), "erase returns the next entry");
+                    Require(next == tree.end() || next->first == expected->first, "erase returns the next key");
+                }
+            }
+            else
+            {
+                tree[key] += "x";
+                map[key] += "x";
+            }
+            if (step % 4096 == 0)
+                RequireSame(tree, map, "random operations");
+        }
+        RequireSame(tree, map, "random operations");
+
+        auto copy = tree;
+        Require(copy == tree, "copies compare equal");
+        for (auto it = copy.begin(); it != copy.end();)
+            it = copy.erase(it);
+        Require(copy.empty() && copy.begin() == copy.end() && tree.size() == map.size(), "erase everything");
+    }
+
+    void CheckSemantics()
+    {
+        wio::BTreeMap<std::int32_t, std::int32_t> empty;
+        Require(empty.begin() == empty.end() && empty.lower_bound(1) == empty.end(), "empty tree");
+
+        for (const std::uint64_t range : {16u, 300u, 20000u})
+        {
+            CheckAgainstStdMap<std::int64_t>(range, [](const std::uint64_t value) { return static_cast<std::int64_t>(value); });
+            CheckAgainstStdMap<std::string>(range, [](const std::uint64_t value) { return "key-" + std::to_string(value); });
+        }
+
+        wio::BTreeMap<std::int32_t, std::int32_t> ascending;
+        for (std::int32_t key = 0; key < 100000; ++key)
+            ascending.emplace(key, key);
+        for (std::int32_t key = 99999; key >= 0; key -= 2)
+            ascending.erase(key);
+        std::int32_t expected = 0;
+        for (const auto& [key, value] : ascending)
+        {
+            Require(key == expected && value == expected, "ascending inserts stay ordered");
+            expected += 2;
+        }
+        Require(std::prev(ascending.end())->first == 99998, "last entry through end()");
+    }
+
+    struct Report final
+    {
+        double orderedInsertSeconds = 0.0;
+        double randomInsertSeconds = 0.0;
+        double lookupSeconds = 0.0;
+        double scanSeconds = 0.0;
+        double bytesPerEntry = 0.0;
+        double allocationsPerEntry = 0.0;
+    };
+
+    double Since(const Clock::time_point started)
+    {
+        return std::chrono::duration<double>(Clock::now() - started).count();
+    }
+
+    // Time-series shaped load: ascending timestamps, point lookups in random
+    // order, and windows of consecutive entries starting at random keys.
+    template <typename Map>
+    Report Measure(const std::vector<std::int64_t>& keys, const std::vector<std::size_t>& order,
+                   const std::vector<std::int64_t>& windowStarts, const std::size_t windowLength)
+    {
+        Report report;
+        std::int64_t checksum = 0;
+        {
+            const auto bytesBefore = gLiveBytes.load();
+            const auto allocationsBefore = gLiveAllocations.load();
+            Map map;
+            auto started = Clock::now();
+            for (const std::int64_t key : keys)
+                map.emplace(key, key);
+            report.orderedInsertSeconds = Since(started);
+            report.bytesPerEntry = static_cast<double>(gLiveBytes.load() - bytesBefore) / static_cast<double>(keys.size());
+            report.allocationsPerEntry =
+                static_cast<double>(gLiveAllocations.load() - allocationsBefore) / static_cast<double>(keys.size());
+
+            started = Clock::now();
+            for (const std::size_t index : order)
+            {
+                const auto found = map.find(keys[index]);
+                checksum += found == map.end() ? -1 : found->second;
+            }
+            report.lookupSeconds = Since(started);
+
+            started = Clock::now();
+            for (const std::int64_t start : windowStarts)
+            {
+                std::size_t visited = 0;
+                for (auto it = map.lower_bound(start); it != map.end() && visited < windowLength; ++it, ++visited)
+                    checksum += it->second;
+            }
+            report.scanSeconds = Since(started);
+        }
+        {
+            Map map;
+            const auto started = Clock::now();
+            for (const std::size_t index : order)
+                map.emplace(keys[index], keys[index]);
+            report.randomInsertSeconds = Since(started);
+            Require(map.size() == keys.size(), "every shuffled key is inserted");
+        }
+        Require(checksum != 0, "benchmark checksum");
+        return report;
+    }
+
+    void Print(const char* name, const std::size_t entries, const std::size_t scanned, const Report& report)
+    {
+        const auto perSecond = [](const std::size_t count, const double seconds)
+        {
+            return seconds <= 0.0 ? 0ull : static_cast<unsigned long long>(static_cast<double>(count) / seconds);
+        };
+        std::cout << name
+                  << " ordered_insert_per_s=" << perSecond(entries, report.orderedInsertSeconds)
+                  << " random_insert_per_s=" << perSecond(entries, report.randomInsertSeconds)
+                  << " lookup_per_s=" << perSecond(entries, report.lookupSeconds)
+                  << " scan_entries_per_s=" << perSecond(scanned, report.scanSeconds)
+                  << " bytes_per_entry=" << static_cast<unsigned long long>(report.bytesPerEntry)
+                  << " allocations_per_entry=" << report.allocationsPerEntry
+                  << '\n';
+    }
+}
+
+// Live byte and block counting for the memory-per-entry figures; each block
+// carries its size in a header so delete can subtract it.
+namespace
+{
+    constexpr std::size_t kHeader = alignof(std::max_align_t);
+
+    void* CountedAllocate(const std::size_t size, const std::size_t alignment)
+    {
+        const std::size_t header = alignment > kHeader ? alignment : kHeader;
+        auto* block = static_cast<unsigned char*>(std::aligned_alloc(header, (size + header * 2 - 1) / header * header));
+        if (!block)
+            throw std::bad_alloc();
+        *reinterpret_cast<std::size_t*>(block + header - sizeof(std::size_t)) = size;
+        gLiveBytes.fetch_add(static_cast<std::int64_t>(size), std::memory_order_relaxed);
+        gLiveAllocations.fetch_add(1, std::memory_order_relaxed);
+        return block + header;
+    }
+
+    void CountedFree(void* memory, const std::size_t alignment) noexcept
+    {
+        if (!memory)
+            return;
+        const std::size_t header = alignment > kHeader ? alignment : kHeader;
+        auto* block = static_cast<unsigned char*>(memory) - header;
+        gLiveBytes.fetch_sub(static_cast<std::int64_t>(*reinterpret_cast<std::size_t*>(block + header - sizeof(std::size_t))),
+            std::memory_order_relaxed);
+        gLiveAllocations.fetch_sub(1, std::memory_order_relaxed);
+        std::free(block);
+    }
+}
+
+void* operator new(const std::size_t size) { return CountedAllocate(size, kHeader); }
+void* operator new(const std::size_t size, const std::align_val_t alignment)
+{
+    return CountedAllocate(size, static_cast<std::size_t>(alignment));
+}
+
+void operator delete(void* memory) noexcept { CountedFree(memory, kHeader); }
+void operator delete(void* memory, std::size_t) noexcept { CountedFree(memory, kHeader); }
+void operator delete(void* memory, const std::align_val_t alignment) noexcept
+{
+    CountedFree(memory, static_cast<std::size_t>(alignment));
+}
+void operator delete(void* memory, std::size_t, const std::align_val_t alignment) noexcept
+{
+    CountedFree(memory, static_cast<std::size_t>(alignment));
+}
+
+int main()
+{
+    try
+    {
+        CheckSemantics();
+
+        const auto entries = ReadCount("WIO_TREE_BENCH_ENTRIES", 1000000);
+        const auto windowLength = ReadCount("WIO_TREE_BENCH_WINDOW", 1000);
+        std::vector<std::int64_t> keys(entries);
+        std::mt19937_64 random(0x5eed);
+        std::int64_t timestamp = 1700000000000;
+        for (auto& key : keys)
+        {
+            timestamp += 1 + static_cast<std::int64_t>(random() % 16);
+            key = timestamp;
+        }
+        std::vector<std::size_t> order(entries);
+        std::iota(order.begin(), order.end(), std::size_t{0});
+        std::shuffle(order.begin(), order.end(), random);
+        std::vector<std::int64_t> windowStarts(std::max<std::size_t>(1, entries / windowLength * 4));
+        for (auto& start : windowStarts)
+            start = keys[random() % entries];
+
+        const auto node = Measure<std::map<std::int64_t, std::int64_t>>(keys, order, windowStarts, windowLength);
+        const auto btree = Measure<wio::BTreeMap<std::int64_t, std::int64_t>>(keys, order, windowStarts, windowLength);
+        const auto scanned = windowStarts.size() * windowLength;
+        std::cout << "tree entries=" << entries << " window=" << windowLength << " windows=" << windowStarts.size() << '\n';
+        Print("  std::map ", entries, scanned, node);
+        Print("  btree_map", entries, scanned, btree);
+        Require(btree.allocationsPerEntry < node.allocationsPerEntry, "b-tree does not allocate per entry");
+        Require(btree.bytesPerEntry < node.bytesPerEntry, "b-tree uses less memory per entry");
+
+        std::cout << "tree-btree-map-stress-ok\n";
+        return 0;
+    }
+    catch (const std::exception& error)
+    {
+        std::cerr << "tree btree map stress failed: " << error.what() << '\n';
+        return 1;
+    }
+}